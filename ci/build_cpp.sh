@@ -137,6 +137,7 @@ cmake -G "${CMAKE_GENERATOR:-Ninja}" \
       -Dvt_trace_only="${VT_BUILD_TRACE_ONLY:-0}" \
       -Dvt_doxygen_enabled="${VT_DOXYGEN_ENABLED:-0}" \
       -Dvt_mimalloc_enabled="${VT_MIMALLOC_ENABLED:-0}" \
+      -Dvt_alloc_tracking_enabled="${VT_ALLOC_TRACKING_ENABLED:-0}" \
       -Dvt_asan_enabled="${VT_ASAN_ENABLED:-0}" \
       -Dvt_ubsan_enabled="${VT_UBSAN_ENABLED:-0}" \
       -Dvt_werror_enabled="${VT_WERROR_ENABLED:-0}" \
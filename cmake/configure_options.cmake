@@ -69,6 +69,10 @@ define_option(vt_fcontext_enabled "fcontext (ULT)" "Build VT with fcontext (ULT)
 define_option(vt_mimalloc_enabled "mimalloc" "Build VT with fcontext (ULT) enabled"
     OFF vt_feature_cmake_mimalloc
 )
+define_option(vt_alloc_tracking_enabled "allocation tracking"
+    "Build VT with global operator new/delete replaced to attribute heap usage to tasks"
+    OFF vt_feature_cmake_alloc_tracking
+)
 
 if (vt_mpi_guards AND NOT PERL_FOUND)
     # No perl? Can't generate wrapper source file.
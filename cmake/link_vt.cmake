@@ -30,6 +30,7 @@ function(link_target_with_vt)
     LINK_CLI11
     LINK_YAMLCPP
     LINK_DL
+    LINK_THREADS
     LINK_ZOLTAN
     LINK_FORT
     LINK_JSON
@@ -146,6 +147,16 @@ function(link_target_with_vt)
     )
   endif()
 
+  if (NOT DEFINED ARG_LINK_THREADS AND ${ARG_DEFAULT_LINK_SET} OR ARG_LINK_THREADS)
+    if (${ARG_DEBUG_LINK})
+      message(STATUS "link_target_with_vt: threads=${ARG_LINK_THREADS}")
+    endif()
+
+    target_link_libraries(
+      ${ARG_TARGET} PUBLIC ${ARG_BUILD_TYPE} Threads::Threads
+    )
+  endif()
+
   if (NOT DEFINED ARG_LINK_MPI AND ${ARG_DEFAULT_LINK_SET} OR ARG_LINK_MPI)
     if (${ARG_DEBUG_LINK})
       message(STATUS "link_target_with_vt: MPI=${ARG_LINK_MPI}")
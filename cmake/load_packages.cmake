@@ -6,6 +6,9 @@ include(cmake/load_mpi_package.cmake)
 # ZLIB package
 find_package(ZLIB REQUIRED)
 
+# Threads package, for the LB strategy thread pool
+find_package(Threads REQUIRED)
+
 # Perl is used to build the PMPI wrappers
 find_package(Perl)
 
@@ -54,6 +54,19 @@ CollectiveAlg::CollectiveAlg()
     barrier::Barrier()
 { }
 
+void CollectiveAlg::initialize() {
+  // Number of times local reduce contributions were pre-combined into one
+  // accumulator before entering the spanning tree
+  reduceLocalCombineCount = registerCounter(
+    "reduce_local_combines", "reduce local pre-combines"
+  );
+
+  // Number of local reduce contributions folded by those pre-combines
+  reduceLocalFoldedCount = registerCounter(
+    "reduce_local_folded", "reduce local contributions folded"
+  );
+}
+
 CollectiveScope CollectiveAlg::makeCollectiveScope(TagType in_scope_tag) {
   bool is_user_tag = true;
   auto scope_tag = in_scope_tag;
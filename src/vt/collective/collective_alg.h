@@ -98,6 +98,8 @@ struct CollectiveAlg :
 
   std::string name() override { return "Collective"; }
 
+  void initialize() override;
+
 public:
   /**
    * \brief Create a new scope for sequenced MPI operations. Each scope has a
@@ -148,7 +150,9 @@ public:
     s | next_system_scope_
       | user_scope_
       | system_scope_
-      | postponed_collectives_;
+      | postponed_collectives_
+      | reduceLocalCombineCount
+      | reduceLocalFoldedCount;
   }
 
 private:
@@ -158,6 +162,10 @@ private:
   ScopeMapType user_scope_;           /**< Live scopes with user tag */
   ScopeMapType system_scope_;         /**< Live scopes with system tag */
   std::vector<MsgSharedPtr<CollectiveMsg>> postponed_collectives_;
+
+public:
+  diagnostic::Counter reduceLocalCombineCount;
+  diagnostic::Counter reduceLocalFoldedCount;
 };
 
 using ReduceMsg = reduce::ReduceMsg;
@@ -99,6 +99,9 @@ void printOverwrittens(
   printIfOverwritten(vt_print_memory_threshold);
   printIfOverwritten(vt_print_memory_sched_poll);
   printIfOverwritten(vt_print_memory_footprint);
+  printIfOverwritten(vt_alloc_tracking);
+  printIfOverwritten(vt_alloc_tracking_top);
+  printIfOverwritten(vt_alloc_tracking_lb);
   printIfOverwritten(vt_no_warn_stack);
   printIfOverwritten(vt_no_assert_stack);
   printIfOverwritten(vt_no_abort_stack);
@@ -142,14 +145,24 @@ void printOverwrittens(
   printIfOverwritten(vt_lb_statistics_dir);
   printIfOverwritten(vt_lb_statistics_freq);
   printIfOverwritten(vt_lb_self_migration);
+  printIfOverwritten(vt_lb_memory_capacity);
+  printIfOverwritten(vt_lb_threads);
+  printIfOverwritten(vt_lb_imbalance_threshold);
+  printIfOverwritten(vt_lb_incremental);
+  printIfOverwritten(vt_lb_topology);
   printIfOverwritten(vt_help_lb_args);
   printIfOverwritten(vt_no_detect_hang);
   printIfOverwritten(vt_print_no_progress);
   printIfOverwritten(vt_epoch_graph_on_hang);
   printIfOverwritten(vt_epoch_graph_terse);
+  printIfOverwritten(vt_epoch_graph_summary);
+  printIfOverwritten(vt_epoch_graph_max_classes);
   printIfOverwritten(vt_term_rooted_use_ds);
   printIfOverwritten(vt_term_rooted_use_wave);
   printIfOverwritten(vt_hang_freq);
+  printIfOverwritten(vt_term_batch_waves);
+  printIfOverwritten(vt_term_adaptive);
+  printIfOverwritten(vt_term_adaptive_max_sec);
   printIfOverwritten(vt_diag_enable);
   printIfOverwritten(vt_diag_print_summary);
   printIfOverwritten(vt_diag_summary_csv_file);
@@ -159,6 +172,16 @@ void printOverwrittens(
   printIfOverwritten(vt_no_assert_fail);
   printIfOverwritten(vt_throw_on_abort);
   printIfOverwritten(vt_max_mpi_send_size);
+  printIfOverwritten(vt_no_dense_elm_holder);
+  printIfOverwritten(vt_bcast_bulk_local);
+  printIfOverwritten(vt_rdma_shm);
+  printIfOverwritten(vt_shm_am);
+  printIfOverwritten(vt_shm_am_ring_size);
+  printIfOverwritten(vt_rndv_threshold);
+  printIfOverwritten(vt_rndv_chunk_size);
+  printIfOverwritten(vt_rndv_max_inflight);
+  printIfOverwritten(vt_poll_completion_budget);
+  printIfOverwritten(vt_async_op_poll_budget);
   printIfOverwritten(vt_debug_level);
   printIfOverwritten(vt_debug_all);
   printIfOverwritten(vt_debug_none);
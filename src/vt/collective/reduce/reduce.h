@@ -496,6 +496,36 @@ struct Reduce : virtual collective::tree::Tree {
     MsgT* msg, bool const local, ReduceNumType num_contrib = -1
   );
 
+  /**
+   * \internal \brief Fold a local contribution into the single accumulator
+   * message for a reduction as soon as it arrives; once every local
+   * contribution is in, hand the accumulator to the messages that get merged
+   * with the children in the spanning tree
+   *
+   * \param[in] state the reduction state
+   * \param[in] msg the local contribution
+   * \param[in] id the reduction stamp
+   */
+  template <typename MsgT>
+  void combineLocal(
+    ReduceStateType& state, MsgSharedPtr<ReduceMsg> msg,
+    detail::ReduceStamp id
+  );
+
+  /**
+   * \internal \brief Chain a list of messages and run the combine handler
+   * inline, leaving the combined value in the first message
+   *
+   * \param[in] msgs the messages to combine, reduced to one on return
+   * \param[in] handler the combine handler
+   * \param[in] id the reduction stamp
+   */
+  template <typename MsgT>
+  void combineMsgs(
+    ReduceStateType::ReduceVecType& msgs, HandlerType handler,
+    detail::ReduceStamp id
+  );
+
   /**
    * \internal \brief Combine and send up the tree if ready
    *
@@ -203,23 +203,118 @@ void Reduce::reduceAddMsg(
   auto& state = state_.find(lookup);
   auto msg_ptr = promoteMsg(msg);
 
-  // Run-time cast with lasting type info to ReduceMsg for holder
-  state.msgs.push_back(msg_ptr.template to<ReduceMsg>());
   if (num_contrib != -1) {
     state.num_contrib_ = num_contrib;
   }
+  state.combine_handler_ = msg->combine_handler_;
+  state.reduce_root_ = msg->reduce_root_;
+
   if (local) {
     state.num_local_contrib_++;
   }
-  state.combine_handler_ = msg->combine_handler_;
-  state.reduce_root_ = msg->reduce_root_;
+
+  // Run-time cast with lasting type info to ReduceMsg for holder
+  if (local and state.num_contrib_ > 1) {
+    // Fold local contributions into one accumulator as they arrive, so only
+    // one message per reduction is held until the children have reported
+    combineLocal<MsgT>(state, msg_ptr.template to<ReduceMsg>(), lookup);
+  } else {
+    state.msgs.push_back(msg_ptr.template to<ReduceMsg>());
+  }
+
   vt_debug_print(
     verbose, reduce,
     "reduceAddMsg: scope={}, stamp={}, msg={}, contrib={}, msgs.size()={}, "
-    "ref={}\n",
+    "local_held={}, ref={}\n",
     scope_.str(), detail::stringizeStamp(lookup), print_ptr(msg),
-    state.num_contrib_, state.msgs.size(), envelopeGetRef(msg->env)
+    state.num_contrib_, state.msgs.size(), state.num_local_held_,
+    envelopeGetRef(msg->env)
+  );
+}
+
+template <typename MsgT>
+void Reduce::combineLocal(
+  ReduceStateType& state, MsgSharedPtr<ReduceMsg> msg, detail::ReduceStamp id
+) {
+  if (state.local_acc_ == nullptr) {
+    state.local_acc_ = msg;
+  } else {
+    ReduceStateType::ReduceVecType pair = {state.local_acc_, msg};
+    combineMsgs<MsgT>(pair, state.combine_handler_, id);
+    state.local_acc_ = pair[0];
+  }
+  state.num_local_held_++;
+
+  vt_debug_print(
+    verbose, reduce,
+    "combineLocal: scope={}, stamp={}, local_held={}\n",
+    scope_.str(), detail::stringizeStamp(id), state.num_local_held_
   );
+
+  if (state.num_local_held_ == state.num_contrib_) {
+    state.msgs.push_back(state.local_acc_);
+    state.local_acc_ = nullptr;
+    state.num_local_folded_ += state.num_local_held_;
+
+    theCollective()->reduceLocalCombineCount.increment(1);
+    theCollective()->reduceLocalFoldedCount.increment(state.num_local_held_);
+
+    state.num_local_held_ = 0;
+  }
+}
+
+template <typename MsgT>
+void Reduce::combineMsgs(
+  ReduceStateType::ReduceVecType& msgs, HandlerType handler,
+  detail::ReduceStamp id
+) {
+  if (msgs.size() <= 1) {
+    return;
+  }
+
+  auto size = msgs.size();
+  for (decltype(size) i = 0; i < size; i++) {
+    bool const has_next = i+1 < size;
+    // Collection is of MsgPtr<ReduceMsg>
+    auto typed_msg = static_cast<MsgT*>(msgs[i].get());
+    if (has_next) {
+      typed_msg->next_ = static_cast<MsgT*>(msgs[i+1].get());
+    } else {
+      typed_msg->next_ = nullptr;
+    }
+    typed_msg->count_ = size - i;
+    typed_msg->is_root_ = false;
+
+    vt_debug_print(
+      verbose, reduce,
+      "scope={}, stamp={}: i={} next={} has_next={} count={} msgs.size()={} "
+      "ref={}\n",
+      scope_.str(), detail::stringizeStamp(id),
+      i, print_ptr(typed_msg->next_), has_next, typed_msg->count_,
+      size, envelopeGetRef(typed_msg->env)
+    );
+  }
+
+  vt_debug_print(
+    verbose, reduce,
+    "scope={}, stamp={}, msgs.size()={}\n",
+    scope_.str(), detail::stringizeStamp(id), size
+  );
+
+  /*
+   *  Invoke user handler to run the functor that combines messages,
+   *  applying the reduction operator
+   */
+  auto const from_node = theContext()->getFromNodeCurrentTask();
+
+  // this needs to run inline.. threaded not allowed for reduction
+  // combination
+  runnable::makeRunnable(msgs[0], false, handler, from_node)
+    .withTDEpochFromMsg()
+    .run();
+
+  // The combined value lives in the first message; drop the rest
+  msgs.resize(1);
 }
 
 template <typename MsgT>
@@ -227,7 +322,11 @@ void Reduce::startReduce(detail::ReduceStamp id, bool use_num_contrib) {
   auto lookup = id;
   auto& state = state_.find(lookup);
 
-  std::size_t nmsgs = state.msgs.size();
+  // Local contributions that were pre-combined count as one message
+  std::size_t nmsgs = state.msgs.size() + state.num_local_held_;
+  if (state.num_local_folded_ > 0) {
+    nmsgs += state.num_local_folded_ - 1;
+  }
   auto const contrib =
     use_num_contrib ? state.num_contrib_ : state.num_local_contrib_;
   std::size_t total = getNumChildren() + contrib;
@@ -236,57 +335,23 @@ void Reduce::startReduce(detail::ReduceStamp id, bool use_num_contrib) {
   vt_debug_print(
     normal, reduce,
     "startReduce: scope={}, stamp={}, msg={}, children={}, "
-    "contrib_={}, local_contrib_={}, nmsgs={}, ready={}\n",
+    "contrib_={}, local_contrib_={}, folded={}, nmsgs={}, ready={}\n",
     scope_.str(), detail::stringizeStamp(id), state.msgs.size(),
-    getNumChildren(), state.num_contrib_, state.num_local_contrib_, nmsgs, ready
+    getNumChildren(), state.num_contrib_, state.num_local_contrib_,
+    state.num_local_folded_, nmsgs, ready
   );
 
   if (ready) {
-    // Combine messages
-    if (state.msgs.size() > 1) {
-      auto size = state.msgs.size();
-      for (decltype(size) i = 0; i < size; i++) {
-        bool const has_next = i+1 < size;
-        // Collection is of MsgPtr<ReduceMsg>
-        auto typed_msg = static_cast<MsgT*>(state.msgs[i].get());
-        if (has_next) {
-          typed_msg->next_ = static_cast<MsgT*>(state.msgs[i+1].get());
-        } else {
-          typed_msg->next_ = nullptr;
-        }
-        typed_msg->count_ = size - i;
-        typed_msg->is_root_ = false;
-
-        vt_debug_print(
-          verbose, reduce,
-          "scope={}, stamp={}: i={} next={} has_next={} count={} msgs.size()={} "
-          "ref={}\n",
-          scope_.str(), detail::stringizeStamp(id),
-          i, print_ptr(typed_msg->next_), has_next, typed_msg->count_,
-          size, envelopeGetRef(typed_msg->env)
-        );
-      }
-
-      vt_debug_print(
-        verbose, reduce,
-        "scope={}, stamp={}, msgs.size()={}\n",
-        scope_.str(), detail::stringizeStamp(id), size
-      );
-
-      /*
-       *  Invoke user handler to run the functor that combines messages,
-       *  applying the reduction operator
-       */
-      auto const handler = state.combine_handler_;
-      auto const from_node = theContext()->getFromNodeCurrentTask();
-
-      // this needs to run inline.. threaded not allowed for reduction
-      // combination
-      runnable::makeRunnable(state.msgs[0], false, handler, from_node)
-        .withTDEpochFromMsg()
-        .run();
+    // A partial accumulator joins the final combine
+    if (state.local_acc_ != nullptr) {
+      state.msgs.push_back(state.local_acc_);
+      state.local_acc_ = nullptr;
+      state.num_local_held_ = 0;
     }
 
+    // Combine messages
+    combineMsgs<MsgT>(state.msgs, state.combine_handler_, id);
+
     // Send to parent
     // Collection is of MsgPtr<ReduceMsg>, re-type and drop collection owner.
     auto msg = state.msgs[0];
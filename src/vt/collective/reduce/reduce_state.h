@@ -62,8 +62,11 @@ struct ReduceState {
   { }
 
   ReduceVecType msgs               = {};
+  MsgSharedPtr<ReduceMsg> local_acc_ = nullptr; /**< Local msgs folded so far */
   ReduceNumType num_contrib_       = 1;
   ReduceNumType num_local_contrib_ = 0;
+  ReduceNumType num_local_held_    = 0; /**< Local msgs in \c local_acc_ */
+  ReduceNumType num_local_folded_  = 0; /**< Local msgs folded into one msg */
   HandlerType combine_handler_     = uninitialized_handler;
   NodeType reduce_root_            = uninitialized_destination;
 };
@@ -46,13 +46,75 @@
 
 namespace vt { namespace collective { namespace reduce {
 
+std::optional<ReduceStateHolder::ReduceStateType>*
+ReduceStateHolder::findDense(ReduceIDType const& id) {
+  auto seq = std::get_if<detail::StrongSeq>(&id);
+  if (seq == nullptr or dense_states_.empty() or seq->get() < dense_base_) {
+    return nullptr;
+  }
+
+  auto const offset = seq->get() - dense_base_;
+  if (offset >= dense_states_.size()) {
+    return nullptr;
+  }
+
+  auto& slot = dense_states_[offset];
+  return slot.has_value() ? &slot : nullptr;
+}
+
+std::optional<ReduceStateHolder::ReduceStateType>*
+ReduceStateHolder::makeDense(ReduceIDType const& id) {
+  auto seq = std::get_if<detail::StrongSeq>(&id);
+  if (seq == nullptr) {
+    return nullptr;
+  }
+
+  auto const val = seq->get();
+
+  if (dense_states_.empty()) {
+    dense_base_ = val;
+    dense_states_.emplace_back();
+    return &dense_states_.front();
+  }
+
+  if (val < dense_base_) {
+    auto const grow = dense_base_ - val;
+    if (grow + dense_states_.size() > max_dense_window) {
+      return nullptr;
+    }
+    // push_front on a deque does not invalidate references to live states
+    for (SeqType i = 0; i < grow; i++) {
+      dense_states_.emplace_front();
+    }
+    dense_base_ = val;
+    return &dense_states_.front();
+  }
+
+  auto const offset = val - dense_base_;
+  if (offset >= max_dense_window) {
+    return nullptr;
+  }
+  while (offset >= dense_states_.size()) {
+    dense_states_.emplace_back();
+  }
+
+  auto& slot = dense_states_[offset];
+  return slot.has_value() ? nullptr : &slot;
+}
+
 bool ReduceStateHolder::exists(ReduceIDType const& id) {
+  if (findDense(id) != nullptr) {
+    return true;
+  }
   auto iter = state_lookup_.find(id);
   return iter != state_lookup_.end();
 }
 
 ReduceStateHolder::ReduceStateType&
 ReduceStateHolder::find(ReduceIDType const& id) {
+  if (auto slot = findDense(id); slot != nullptr) {
+    return **slot;
+  }
   auto iter = state_lookup_.find(id);
   vtAssertExpr(iter != state_lookup_.end());
   return iter->second;
@@ -61,6 +123,20 @@ ReduceStateHolder::find(ReduceIDType const& id) {
 void ReduceStateHolder::erase(
   ReduceIDType const& id
 ) {
+  if (auto slot = findDense(id); slot != nullptr) {
+    slot->reset();
+    num_dense_--;
+    // Retire completed sequences at both ends so the window tracks live ones
+    while (not dense_states_.empty() and not dense_states_.front()) {
+      dense_states_.pop_front();
+      dense_base_++;
+    }
+    while (not dense_states_.empty() and not dense_states_.back()) {
+      dense_states_.pop_back();
+    }
+    return;
+  }
+
   auto iter = state_lookup_.find(id);
   if (iter != state_lookup_.end()) {
     state_lookup_.erase(iter);
@@ -68,6 +144,14 @@ void ReduceStateHolder::erase(
 }
 
 void ReduceStateHolder::insert(ReduceIDType const& id, ReduceStateType&& state) {
+  if (state_lookup_.find(id) == state_lookup_.end()) {
+    if (auto slot = makeDense(id); slot != nullptr) {
+      slot->emplace(std::move(state));
+      num_dense_++;
+      return;
+    }
+  }
+
   state_lookup_.emplace(
     std::piecewise_construct,
     std::forward_as_tuple(id),
@@ -49,12 +49,29 @@
 #include "vt/collective/reduce/reduce_scope.h"
 
 #include <unordered_map>
+#include <deque>
+#include <optional>
 
 namespace vt { namespace collective { namespace reduce {
 
+/**
+ * \struct ReduceStateHolder
+ *
+ * \brief Holds the live reduction states for a single reduction scope.
+ *
+ * Sequenced stamps (\c StrongSeq, used by collections and generated
+ * reductions) are stored in a dense window indexed by the sequence number
+ * relative to the oldest live sequence, avoiding a hash of the stamp variant
+ * on every contribution. Any other stamp kind, or a sequence too far outside
+ * the current window, falls back to the hash map.
+ */
 struct ReduceStateHolder {
   using ReduceIDType    = detail::ReduceStamp;
   using ReduceStateType = ReduceState;
+  using SeqType         = SequentialIDType;
+
+  /// Max distance from the oldest live sequence stored in the dense window
+  static constexpr SeqType const max_dense_window = 4096;
 
 public:
   bool exists(ReduceIDType const& id);
@@ -65,7 +82,38 @@ public:
 
   void insert(ReduceIDType const& id, ReduceStateType&& state);
 
+  /**
+   * \brief Number of live reduction states in this holder
+   *
+   * \return the number of states
+   */
+  std::size_t size() const { return num_dense_ + state_lookup_.size(); }
+
+private:
+  /**
+   * \internal \brief Get the slot in the dense window for a stamp if it is a
+   * sequenced stamp that falls in the window
+   *
+   * \param[in] id the reduction stamp
+   *
+   * \return pointer to the slot; \c nullptr if not in the dense window
+   */
+  std::optional<ReduceStateType>* findDense(ReduceIDType const& id);
+
+  /**
+   * \internal \brief Try to make room for a sequenced stamp in the dense
+   * window, growing it at either end
+   *
+   * \param[in] id the reduction stamp
+   *
+   * \return pointer to the (empty) slot; \c nullptr if it does not fit
+   */
+  std::optional<ReduceStateType>* makeDense(ReduceIDType const& id);
+
 private:
+  SeqType dense_base_ = 0;   /**< Sequence number of first slot in window */
+  std::size_t num_dense_ = 0; /**< Number of live states in the dense window */
+  std::deque<std::optional<ReduceState>> dense_states_;
   std::unordered_map<detail::ReduceStamp, ReduceState> state_lookup_;
 };
 
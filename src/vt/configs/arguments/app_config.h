@@ -109,6 +109,9 @@ struct AppConfig {
   std::string vt_print_memory_threshold = "1 GiB";
   int32_t vt_print_memory_sched_poll    = 100;
   bool vt_print_memory_footprint  = false;
+  bool vt_alloc_tracking          = false;
+  int32_t vt_alloc_tracking_top   = 10;
+  bool vt_alloc_tracking_lb       = false;
 
   bool vt_no_warn_stack     = false;
   bool vt_no_assert_stack   = false;
@@ -162,15 +165,25 @@ struct AppConfig {
   bool vt_lb_spec                = false;
   std::string vt_lb_spec_file    = "";
   bool vt_lb_run_lb_first_phase = false;
+  std::size_t vt_lb_memory_capacity = 0;
+  int32_t vt_lb_threads = 1;
+  double vt_lb_imbalance_threshold = 0.0;
+  bool vt_lb_incremental = false;
+  bool vt_lb_topology = false;
 
 
   bool vt_no_detect_hang       = false;
   bool vt_print_no_progress    = true;
   bool vt_epoch_graph_on_hang  = true;
   bool vt_epoch_graph_terse    = false;
+  bool vt_epoch_graph_summary  = false;
+  int64_t vt_epoch_graph_max_classes = 256;
   bool vt_term_rooted_use_ds   = false;
   bool vt_term_rooted_use_wave = false;
   int64_t vt_hang_freq         = 1024;
+  bool vt_term_batch_waves     = false;
+  bool vt_term_adaptive        = false;
+  double vt_term_adaptive_max_sec = 0.01;
 
 #if (vt_diagnostics_runtime != 0)
   bool vt_diag_enable = true;
@@ -186,6 +199,16 @@ struct AppConfig {
   bool vt_no_assert_fail = false;
   bool vt_throw_on_abort = false;
   std::size_t vt_max_mpi_send_size = 1ull << 30;
+  bool vt_no_dense_elm_holder = false;
+  bool vt_bcast_bulk_local = false;
+  bool vt_rdma_shm = false;
+  bool vt_shm_am = false;
+  std::size_t vt_shm_am_ring_size = 1ull << 14;
+  std::size_t vt_rndv_threshold = 1ull << 20;
+  std::size_t vt_rndv_chunk_size = 1ull << 22;
+  int vt_rndv_max_inflight = 4;
+  int vt_poll_completion_budget = 0;
+  int vt_async_op_poll_budget = 0;
 
 #if (vt_feature_fcontext != 0)
   bool vt_ult_disable = false;
@@ -290,6 +313,9 @@ struct AppConfig {
       | vt_print_memory_threshold
       | vt_print_memory_sched_poll
       | vt_print_memory_footprint
+      | vt_alloc_tracking
+      | vt_alloc_tracking_top
+      | vt_alloc_tracking_lb
 
       | vt_no_warn_stack
       | vt_no_assert_stack
@@ -338,14 +364,24 @@ struct AppConfig {
       | vt_lb_statistics_freq
       | vt_help_lb_args
       | vt_lb_self_migration
+      | vt_lb_memory_capacity
+      | vt_lb_threads
+      | vt_lb_imbalance_threshold
+      | vt_lb_incremental
+      | vt_lb_topology
 
       | vt_no_detect_hang
       | vt_print_no_progress
       | vt_epoch_graph_on_hang
       | vt_epoch_graph_terse
+      | vt_epoch_graph_summary
+      | vt_epoch_graph_max_classes
       | vt_term_rooted_use_ds
       | vt_term_rooted_use_wave
       | vt_hang_freq
+      | vt_term_batch_waves
+      | vt_term_adaptive
+      | vt_term_adaptive_max_sec
 
       | vt_diag_enable
       | vt_diag_print_summary
@@ -357,6 +393,16 @@ struct AppConfig {
       | vt_no_assert_fail
       | vt_throw_on_abort
       | vt_max_mpi_send_size
+      | vt_no_dense_elm_holder
+      | vt_bcast_bulk_local
+      | vt_rdma_shm
+      | vt_shm_am
+      | vt_shm_am_ring_size
+      | vt_rndv_threshold
+      | vt_rndv_chunk_size
+      | vt_rndv_max_inflight
+      | vt_poll_completion_budget
+      | vt_async_op_poll_budget
 
       | vt_debug_level
       | vt_debug_level_val
@@ -81,6 +81,9 @@ static const std::string vt_allow_memory_report_with_ps_label = "Allow Memory Re
 static const std::string vt_print_memory_threshold_label = "Print Memory Threshold";
 static const std::string vt_print_memory_sched_poll_label = "Print Memory Scheduler Poll";
 static const std::string vt_print_memory_footprint_label = "Print Memory Footprint";
+static const std::string vt_alloc_tracking_label = "Allocation Tracking";
+static const std::string vt_alloc_tracking_top_label = "Allocation Tracking Top";
+static const std::string vt_alloc_tracking_lb_label = "Allocation Tracking LB Data";
 
 // Dump Stack Backtrace
 static const std::string vt_no_warn_stack_label = "Enable Stack Output on Warning";
@@ -173,6 +176,11 @@ static const std::string vt_lb_statistics_freq_label = "Frequency";
 static const std::string vt_lb_self_migration_label = "Enable Self Migration";
 static const std::string vt_lb_spec_label = "Enable Specification";
 static const std::string vt_lb_spec_file_label = "Specification File";
+static const std::string vt_lb_memory_capacity_label = "Memory Capacity";
+static const std::string vt_lb_threads_label = "Strategy Threads";
+static const std::string vt_lb_imbalance_threshold_label = "Imbalance Threshold";
+static const std::string vt_lb_incremental_label = "Incremental";
+static const std::string vt_lb_topology_label = "Topology";
 
 // Diagnostics
 static const std::string vt_diag_enable_label = "Enabled";
@@ -187,8 +195,13 @@ static const std::string vt_term_rooted_use_ds_label = "Use DS for Rooted";
 static const std::string vt_term_rooted_use_wave_label = "Use Wave for Rooted";
 static const std::string vt_epoch_graph_on_hang_label = "Output Epoch Graph on Hang";
 static const std::string vt_epoch_graph_terse_label = "Terse Epoch Graph Output";
+static const std::string vt_epoch_graph_summary_label = "Summarized Epoch Graph Output";
+static const std::string vt_epoch_graph_max_classes_label = "Epoch Graph Summary Max Classes";
 static const std::string vt_print_no_progress_label = "Print No Progress";
 static const std::string vt_hang_freq_label = "Hang Check Frequency";
+static const std::string vt_term_batch_waves_label = "Batch Termination Waves";
+static const std::string vt_term_adaptive_label = "Adaptive Termination Waves";
+static const std::string vt_term_adaptive_max_sec_label = "Adaptive Termination Max Backoff";
 
 // Debugging/Launch
 static const std::string vt_pause_label = "Pause";
@@ -204,6 +217,16 @@ static const std::string vt_output_config_file_label = "File";
 
 // Runtime
 static const std::string vt_max_mpi_send_size_label = "Max MPI Send Size";
+static const std::string vt_no_dense_elm_holder_label = "No Dense Element Holder";
+static const std::string vt_bcast_bulk_local_label = "Bulk Local Broadcast";
+static const std::string vt_rdma_shm_label = "Shared Memory RDMA Handles";
+static const std::string vt_shm_am_label = "Shared Memory Active Messages";
+static const std::string vt_shm_am_ring_size_label = "Shared Memory Ring Size";
+static const std::string vt_rndv_threshold_label = "Rendezvous Threshold";
+static const std::string vt_rndv_chunk_size_label = "Rendezvous Chunk Size";
+static const std::string vt_rndv_max_inflight_label = "Rendezvous Max In-flight Chunks";
+static const std::string vt_poll_completion_budget_label = "Poll Completion Budget";
+static const std::string vt_async_op_poll_budget_label = "Async Op Poll Budget";
 static const std::string vt_no_assert_fail_label = "Disable Assert Failure";
 static const std::string vt_throw_on_abort_label = "Throw on Abort";
 
@@ -462,6 +485,9 @@ void parseYaml(AppConfig& appConfig, std::string const& inputFile) {
   }
   update_config(appConfig.vt_print_memory_sched_poll, vt_print_memory_sched_poll_label, memory_usage_reporting);
   update_config(appConfig.vt_print_memory_footprint, vt_print_memory_footprint_label, memory_usage_reporting);
+  update_config(appConfig.vt_alloc_tracking, vt_alloc_tracking_label, memory_usage_reporting);
+  update_config(appConfig.vt_alloc_tracking_top, vt_alloc_tracking_top_label, memory_usage_reporting);
+  update_config(appConfig.vt_alloc_tracking_lb, vt_alloc_tracking_lb_label, memory_usage_reporting);
 
   // Dump Stack Backtrace
   YAML::Node dump_stack_backtrace = yaml_input["Dump Stack Backtrace"];
@@ -560,6 +586,11 @@ void parseYaml(AppConfig& appConfig, std::string const& inputFile) {
   update_config(appConfig.vt_lb_self_migration, vt_lb_self_migration_label, load_balancing);
   update_config(appConfig.vt_lb_spec, vt_lb_spec_label, load_balancing);
   update_config(appConfig.vt_lb_spec_file, vt_lb_spec_file_label, load_balancing);
+  update_config(appConfig.vt_lb_memory_capacity, vt_lb_memory_capacity_label, load_balancing);
+  update_config(appConfig.vt_lb_threads, vt_lb_threads_label, load_balancing);
+  update_config(appConfig.vt_lb_imbalance_threshold, vt_lb_imbalance_threshold_label, load_balancing);
+  update_config(appConfig.vt_lb_incremental, vt_lb_incremental_label, load_balancing);
+  update_config(appConfig.vt_lb_topology, vt_lb_topology_label, load_balancing);
 
 
   YAML::Node lb_output = load_balancing["LB Data Output"];
@@ -595,8 +626,13 @@ void parseYaml(AppConfig& appConfig, std::string const& inputFile) {
   update_config(appConfig.vt_term_rooted_use_wave, vt_term_rooted_use_wave_label, termination);
   update_config(appConfig.vt_epoch_graph_on_hang, vt_epoch_graph_on_hang_label, termination);
   update_config(appConfig.vt_epoch_graph_terse, vt_epoch_graph_terse_label, termination);
+  update_config(appConfig.vt_epoch_graph_summary, vt_epoch_graph_summary_label, termination);
+  update_config(appConfig.vt_epoch_graph_max_classes, vt_epoch_graph_max_classes_label, termination);
   update_config(appConfig.vt_print_no_progress, vt_print_no_progress_label, termination);
   update_config(appConfig.vt_hang_freq, vt_hang_freq_label, termination);
+  update_config(appConfig.vt_term_batch_waves, vt_term_batch_waves_label, termination);
+  update_config(appConfig.vt_term_adaptive, vt_term_adaptive_label, termination);
+  update_config(appConfig.vt_term_adaptive_max_sec, vt_term_adaptive_max_sec_label, termination);
 
   // Debugging/Launch
   YAML::Node launch = yaml_input["Launch"];
@@ -619,6 +655,16 @@ void parseYaml(AppConfig& appConfig, std::string const& inputFile) {
   // Runtime
   YAML::Node runtime = yaml_input["Runtime"];
   update_config(appConfig.vt_max_mpi_send_size, vt_max_mpi_send_size_label, runtime);
+  update_config(appConfig.vt_no_dense_elm_holder, vt_no_dense_elm_holder_label, runtime);
+  update_config(appConfig.vt_bcast_bulk_local, vt_bcast_bulk_local_label, runtime);
+  update_config(appConfig.vt_rdma_shm, vt_rdma_shm_label, runtime);
+  update_config(appConfig.vt_shm_am, vt_shm_am_label, runtime);
+  update_config(appConfig.vt_shm_am_ring_size, vt_shm_am_ring_size_label, runtime);
+  update_config(appConfig.vt_rndv_threshold, vt_rndv_threshold_label, runtime);
+  update_config(appConfig.vt_rndv_chunk_size, vt_rndv_chunk_size_label, runtime);
+  update_config(appConfig.vt_rndv_max_inflight, vt_rndv_max_inflight_label, runtime);
+  update_config(appConfig.vt_poll_completion_budget, vt_poll_completion_budget_label, runtime);
+  update_config(appConfig.vt_async_op_poll_budget, vt_async_op_poll_budget_label, runtime);
   update_config(appConfig.vt_no_assert_fail, vt_no_assert_fail_label, runtime);
   update_config(appConfig.vt_throw_on_abort, vt_throw_on_abort_label, runtime);
 
@@ -673,6 +719,9 @@ void addMemUsageArgs(CLI::App& app, AppConfig& appConfig) {
   auto mem_thresh    = "The threshold increments to print memory usage: \"<value> {GiB,MiB,KiB,B}\"";
   auto mem_sched     = "The frequency to query the memory threshold check (some memory reporters might be expensive)";
   auto mem_footprint = "Print live components' memory footprint after initialization and before shutdown";
+  auto mem_alloc     = "Attribute heap allocations to the running handler, object group or collection element (requires building with vt_alloc_tracking_enabled)";
+  auto mem_alloc_top = "Number of contexts with the most live bytes to print each phase with --vt_alloc_tracking";
+  auto mem_alloc_lb  = "Add each collection element's live allocated bytes to the LB data as \"alloc_live_bytes\"";
   auto mm = app.add_option("--vt_memory_reporters",          appConfig.vt_memory_reporters, mem_desc)->capture_default_str();
   auto mn = app.add_flag("--vt_print_memory_each_phase",     appConfig.vt_print_memory_each_phase, mem_phase);
   auto mo = app.add_option("--vt_print_memory_node",         appConfig.vt_print_memory_node, mem_node)->capture_default_str();
@@ -681,6 +730,9 @@ void addMemUsageArgs(CLI::App& app, AppConfig& appConfig) {
   auto mr = app.add_option("--vt_print_memory_threshold",    appConfig.vt_print_memory_threshold, mem_thresh)->capture_default_str();
   auto ms = app.add_option("--vt_print_memory_sched_poll",   appConfig.vt_print_memory_sched_poll, mem_sched)->capture_default_str();
   auto mf = app.add_flag("--vt_print_memory_footprint",      appConfig.vt_print_memory_footprint, mem_footprint);
+  auto ma = app.add_flag("--vt_alloc_tracking",              appConfig.vt_alloc_tracking, mem_alloc);
+  auto mt = app.add_option("--vt_alloc_tracking_top",        appConfig.vt_alloc_tracking_top, mem_alloc_top)->capture_default_str();
+  auto ml = app.add_flag("--vt_alloc_tracking_lb",           appConfig.vt_alloc_tracking_lb, mem_alloc_lb);
   auto memoryGroup = "Memory Usage Reporting";
   mm->group(memoryGroup);
   mn->group(memoryGroup);
@@ -690,6 +742,9 @@ void addMemUsageArgs(CLI::App& app, AppConfig& appConfig) {
   mr->group(memoryGroup);
   ms->group(memoryGroup);
   mf->group(memoryGroup);
+  ma->group(memoryGroup);
+  mt->group(memoryGroup);
+  ml->group(memoryGroup);
 }
 
 void addStackDumpArgs(CLI::App& app, AppConfig& appConfig) {
@@ -926,6 +981,11 @@ void addLbArgs(CLI::App& app, AppConfig& appConfig) {
   auto lb_spec      = "Enable LB spec file (defines which phases output LB data)";
   auto lb_spec_file = "File containing LB spec; --vt_lb_spec to enable";
   auto lb_first_phase_info = "Force LB to run on the first phase (phase 0)";
+  auto lb_memory_capacity = "Memory capacity of each rank in bytes that LB transfers must respect (0 disables)";
+  auto lb_imbalance_threshold = "Skip the LB on phases where the modeled rank imbalance (max/avg - 1) is below this value (0 disables)";
+  auto lb_incremental = "When the imbalance threshold is met, rebalance locally from overloaded ranks to their neighbors instead of running the strategy";
+  auto lb_topology = "Discover the physical node and NUMA domain of each rank at startup for topology-aware LB models and strategies";
+  auto lb_threads = "Number of threads (including the calling one) that LB strategies may use to compute a new distribution";
   auto s  = app.add_flag("--vt_lb", appConfig.vt_lb, lb);
   auto t1 = app.add_flag("--vt_lb_quiet", appConfig.vt_lb_quiet, lb_quiet);
   auto u  = app.add_option("--vt_lb_file_name", appConfig.vt_lb_file_name, lb_file_name)->capture_default_str()->check(CLI::ExistingFile);
@@ -950,6 +1010,11 @@ void addLbArgs(CLI::App& app, AppConfig& appConfig) {
   auto lbspec = app.add_flag("--vt_lb_spec",            appConfig.vt_lb_spec,                lb_spec);
   auto lbspecfile = app.add_option("--vt_lb_spec_file", appConfig.vt_lb_spec_file,           lb_spec_file)->capture_default_str()->check(CLI::ExistingFile);
   auto lb_first_phase = app.add_flag("--vt_lb_run_lb_first_phase", appConfig.vt_lb_run_lb_first_phase, lb_first_phase_info);
+  auto lbmem = app.add_option("--vt_lb_memory_capacity", appConfig.vt_lb_memory_capacity, lb_memory_capacity)->capture_default_str();
+  auto lbimb = app.add_option("--vt_lb_imbalance_threshold", appConfig.vt_lb_imbalance_threshold, lb_imbalance_threshold)->capture_default_str();
+  auto lbinc = app.add_flag("--vt_lb_incremental", appConfig.vt_lb_incremental, lb_incremental);
+  auto lbtopo = app.add_flag("--vt_lb_topology", appConfig.vt_lb_topology, lb_topology);
+  auto lbthreads = app.add_option("--vt_lb_threads", appConfig.vt_lb_threads, lb_threads)->capture_default_str()->check(CLI::PositiveNumber);
 
   // --vt_lb_name excludes --vt_lb_file_name, and vice versa
   v->excludes(u);
@@ -980,6 +1045,11 @@ void addLbArgs(CLI::App& app, AppConfig& appConfig) {
   lbspec->group(debugLB);
   lbspecfile->group(debugLB);
   lb_first_phase->group(debugLB);
+  lbmem->group(debugLB);
+  lbthreads->group(debugLB);
+  lbimb->group(debugLB);
+  lbinc->group(debugLB);
+  lbtopo->group(debugLB);
 
   // help options deliberately omitted from the debugLB group above so that
   // they appear grouped with --vt_help when --vt_help is used
@@ -1018,14 +1088,24 @@ void addTerminationArgs(CLI::App& app, AppConfig& appConfig) {
   auto wave         = "Force use of 4-counter algorithm for rooted epoch termination detection";
   auto graph_on     = "Output epoch graph to file (DOT) when hang is detected";
   auto terse        = "Output epoch graph to file in terse mode";
+  auto summary      = "Output epoch graph collapsed by epoch label with counts (bounded memory)";
+  auto max_classes  = "Maximum number of label classes kept in the summarized epoch graph";
   auto progress     = "Print termination counts when progress is stalled";
+  auto batch        = "Coalesce the termination waves of all epochs into one message per tree edge per progress cycle";
+  auto adaptive     = "Back off termination waves while the scheduler has work and run them eagerly when idle";
+  auto adaptive_max = "Maximum time (seconds) termination waves are held back while the scheduler has work";
   auto x  = app.add_flag("--vt_no_detect_hang",        appConfig.vt_no_detect_hang,       hang);
   auto x1 = app.add_flag("--vt_term_rooted_use_ds",    appConfig.vt_term_rooted_use_ds,   ds);
   auto x2 = app.add_flag("--vt_term_rooted_use_wave",  appConfig.vt_term_rooted_use_wave, wave);
   auto x3 = app.add_option("--vt_epoch_graph_on_hang", appConfig.vt_epoch_graph_on_hang,  graph_on)->capture_default_str();
   auto x4 = app.add_flag("--vt_epoch_graph_terse",     appConfig.vt_epoch_graph_terse,    terse);
+  auto x6 = app.add_flag("--vt_epoch_graph_summary",   appConfig.vt_epoch_graph_summary,  summary);
+  auto x7 = app.add_option("--vt_epoch_graph_max_classes", appConfig.vt_epoch_graph_max_classes, max_classes)->capture_default_str();
   auto x5 = app.add_option("--vt_print_no_progress",   appConfig.vt_print_no_progress,    progress)->capture_default_str();
   auto y = app.add_option("--vt_hang_freq",            appConfig.vt_hang_freq,            hang_freq)->capture_default_str();
+  auto y1 = app.add_flag("--vt_term_batch_waves",      appConfig.vt_term_batch_waves,     batch);
+  auto y2 = app.add_flag("--vt_term_adaptive",         appConfig.vt_term_adaptive,        adaptive);
+  auto y3 = app.add_option("--vt_term_adaptive_max_sec", appConfig.vt_term_adaptive_max_sec, adaptive_max)->capture_default_str();
   auto debugTerm = "Termination";
   x->group(debugTerm);
   x1->group(debugTerm);
@@ -1033,7 +1113,12 @@ void addTerminationArgs(CLI::App& app, AppConfig& appConfig) {
   x3->group(debugTerm);
   x4->group(debugTerm);
   x5->group(debugTerm);
+  x6->group(debugTerm);
+  x7->group(debugTerm);
   y->group(debugTerm);
+  y1->group(debugTerm);
+  y2->group(debugTerm);
+  y3->group(debugTerm);
 }
 
 void addDebuggerArgs(CLI::App& app, AppConfig& appConfig) {
@@ -1104,6 +1189,28 @@ void addRuntimeArgs(CLI::App& app, AppConfig& appConfig) {
                   "into multiple MPI sends)";
   auto assert = "Do not abort the program when vtAssert(..) is invoked";
   auto throw_on_abort = "Throw an exception when vtAbort(..) is called";
+  auto no_dense = "Always store local collection elements in a hash map (disable "
+                  "the dense array for bounded collections)";
+  auto bulk_bcast = "Deliver a collection broadcast to all local elements in "
+                    "one scheduler unit sharing the message";
+  auto rdma_shm = "Allocate RDMA handle windows in shared memory so operations "
+                  "on ranks of the same node are direct loads/stores";
+  auto shm_am = "Send small active messages to ranks on the same node through "
+                "shared-memory rings instead of MPI";
+  auto shm_ring = "Bytes of each shared-memory ring (one per pair of ranks on a "
+                  "node); messages up to half of it use the ring";
+  auto rndv_threshold = "Messages of at least this many bytes are sent with a "
+                        "rendezvous: the payload is posted once the "
+                        "destination is ready to receive it";
+  auto rndv_chunk = "Bytes per chunk when pipelining rendezvous messages (0 "
+                    "sends no rendezvous and splits messages larger than "
+                    "--vt_max_mpi_send_size unpipelined)";
+  auto rndv_inflight = "Maximum number of chunks of a pipelined message in "
+                       "flight at once";
+  auto completion_budget = "Maximum number of completed MPI requests of each "
+                           "kind handled per progress call (0 is unlimited)";
+  auto async_budget = "Maximum number of asynchronous operations without an "
+                      "MPI request polled per progress call (0 is unlimited)";
 
 
   auto a1 = app.add_option(
@@ -1115,12 +1222,49 @@ void addRuntimeArgs(CLI::App& app, AppConfig& appConfig) {
   auto a3 = app.add_flag(
     "--vt_throw_on_abort", appConfig.vt_throw_on_abort, throw_on_abort
   );
-
+  auto a4 = app.add_flag(
+    "--vt_no_dense_elm_holder", appConfig.vt_no_dense_elm_holder, no_dense
+  );
+  auto a5 = app.add_flag(
+    "--vt_bcast_bulk_local", appConfig.vt_bcast_bulk_local, bulk_bcast
+  );
+  auto a6 = app.add_flag("--vt_rdma_shm", appConfig.vt_rdma_shm, rdma_shm);
+  auto a7 = app.add_flag("--vt_shm_am", appConfig.vt_shm_am, shm_am);
+  auto a8 = app.add_option(
+    "--vt_shm_am_ring_size", appConfig.vt_shm_am_ring_size, shm_ring
+  )->capture_default_str();
+  auto a9 = app.add_option(
+    "--vt_rndv_chunk_size", appConfig.vt_rndv_chunk_size, rndv_chunk
+  )->capture_default_str();
+  auto a10 = app.add_option(
+    "--vt_rndv_max_inflight", appConfig.vt_rndv_max_inflight, rndv_inflight
+  )->capture_default_str();
+  auto a11 = app.add_option(
+    "--vt_poll_completion_budget", appConfig.vt_poll_completion_budget,
+    completion_budget
+  )->capture_default_str();
+  auto a12 = app.add_option(
+    "--vt_async_op_poll_budget", appConfig.vt_async_op_poll_budget,
+    async_budget
+  )->capture_default_str();
+  auto a13 = app.add_option(
+    "--vt_rndv_threshold", appConfig.vt_rndv_threshold, rndv_threshold
+  )->capture_default_str();
 
   auto configRuntime = "Runtime";
   a1->group(configRuntime);
   a2->group(configRuntime);
   a3->group(configRuntime);
+  a4->group(configRuntime);
+  a5->group(configRuntime);
+  a6->group(configRuntime);
+  a7->group(configRuntime);
+  a8->group(configRuntime);
+  a9->group(configRuntime);
+  a10->group(configRuntime);
+  a11->group(configRuntime);
+  a12->group(configRuntime);
+  a13->group(configRuntime);
 }
 
 void addTVArgs(CLI::App& app, AppConfig& appConfig) {
@@ -1201,6 +1345,9 @@ std::string convertConfigToYamlString(AppConfig& appConfig) {
       {"Memory Usage Reporting", vt_print_memory_threshold_label, static_cast<variantArg_t>(appConfig.vt_print_memory_threshold)},
       {"Memory Usage Reporting", vt_print_memory_sched_poll_label, static_cast<variantArg_t>(appConfig.vt_print_memory_sched_poll)},
       {"Memory Usage Reporting", vt_print_memory_footprint_label, static_cast<variantArg_t>(appConfig.vt_print_memory_footprint)},
+      {"Memory Usage Reporting", vt_alloc_tracking_label, static_cast<variantArg_t>(appConfig.vt_alloc_tracking)},
+      {"Memory Usage Reporting", vt_alloc_tracking_top_label, static_cast<variantArg_t>(appConfig.vt_alloc_tracking_top)},
+      {"Memory Usage Reporting", vt_alloc_tracking_lb_label, static_cast<variantArg_t>(appConfig.vt_alloc_tracking_lb)},
 
       // Dump Stack Backtrace
       {"Dump Stack Backtrace", vt_no_warn_stack_label, static_cast<variantArg_t>(appConfig.vt_no_warn_stack)},
@@ -1292,6 +1439,11 @@ std::string convertConfigToYamlString(AppConfig& appConfig) {
       {"Load Balancing", vt_lb_self_migration_label, static_cast<variantArg_t>(appConfig.vt_lb_self_migration)},
       {"Load Balancing", vt_lb_spec_label, static_cast<variantArg_t>(appConfig.vt_lb_spec)},
       {"Load Balancing", vt_lb_spec_file_label, static_cast<variantArg_t>(appConfig.vt_lb_spec_file)},
+      {"Load Balancing", vt_lb_memory_capacity_label, static_cast<variantArg_t>(appConfig.vt_lb_memory_capacity)},
+      {"Load Balancing", vt_lb_threads_label, static_cast<variantArg_t>(appConfig.vt_lb_threads)},
+      {"Load Balancing", vt_lb_imbalance_threshold_label, static_cast<variantArg_t>(appConfig.vt_lb_imbalance_threshold)},
+      {"Load Balancing", vt_lb_incremental_label, static_cast<variantArg_t>(appConfig.vt_lb_incremental)},
+      {"Load Balancing", vt_lb_topology_label, static_cast<variantArg_t>(appConfig.vt_lb_topology)},
 
       // Diagnostics
       {"Diagnostics", vt_diag_enable_label, static_cast<variantArg_t>(appConfig.vt_diag_enable)},
@@ -1306,8 +1458,13 @@ std::string convertConfigToYamlString(AppConfig& appConfig) {
       {"Termination", vt_term_rooted_use_wave_label, static_cast<variantArg_t>(appConfig.vt_term_rooted_use_wave)},
       {"Termination", vt_epoch_graph_on_hang_label, static_cast<variantArg_t>(appConfig.vt_epoch_graph_on_hang)},
       {"Termination", vt_epoch_graph_terse_label, static_cast<variantArg_t>(appConfig.vt_epoch_graph_terse)},
+      {"Termination", vt_epoch_graph_summary_label, static_cast<variantArg_t>(appConfig.vt_epoch_graph_summary)},
+      {"Termination", vt_epoch_graph_max_classes_label, static_cast<variantArg_t>(appConfig.vt_epoch_graph_max_classes)},
       {"Termination", vt_print_no_progress_label, static_cast<variantArg_t>(appConfig.vt_print_no_progress)},
       {"Termination", vt_hang_freq_label, static_cast<variantArg_t>(appConfig.vt_hang_freq)},
+      {"Termination", vt_term_batch_waves_label, static_cast<variantArg_t>(appConfig.vt_term_batch_waves)},
+      {"Termination", vt_term_adaptive_label, static_cast<variantArg_t>(appConfig.vt_term_adaptive)},
+      {"Termination", vt_term_adaptive_max_sec_label, static_cast<variantArg_t>(appConfig.vt_term_adaptive_max_sec)},
 
       // Debugging/Launch
       {"Launch", vt_pause_label, static_cast<variantArg_t>(appConfig.vt_pause)},
@@ -1336,6 +1493,16 @@ std::string convertConfigToYamlString(AppConfig& appConfig) {
       {"Runtime", vt_max_mpi_send_size_label, static_cast<variantArg_t>(appConfig.vt_max_mpi_send_size)},
       {"Runtime", vt_no_assert_fail_label, static_cast<variantArg_t>(appConfig.vt_no_assert_fail)},
       {"Runtime", vt_throw_on_abort_label, static_cast<variantArg_t>(appConfig.vt_throw_on_abort)},
+      {"Runtime", vt_no_dense_elm_holder_label, static_cast<variantArg_t>(appConfig.vt_no_dense_elm_holder)},
+      {"Runtime", vt_bcast_bulk_local_label, static_cast<variantArg_t>(appConfig.vt_bcast_bulk_local)},
+      {"Runtime", vt_rdma_shm_label, static_cast<variantArg_t>(appConfig.vt_rdma_shm)},
+      {"Runtime", vt_shm_am_label, static_cast<variantArg_t>(appConfig.vt_shm_am)},
+      {"Runtime", vt_shm_am_ring_size_label, static_cast<variantArg_t>(appConfig.vt_shm_am_ring_size)},
+      {"Runtime", vt_rndv_threshold_label, static_cast<variantArg_t>(appConfig.vt_rndv_threshold)},
+      {"Runtime", vt_rndv_chunk_size_label, static_cast<variantArg_t>(appConfig.vt_rndv_chunk_size)},
+      {"Runtime", vt_rndv_max_inflight_label, static_cast<variantArg_t>(appConfig.vt_rndv_max_inflight)},
+      {"Runtime", vt_poll_completion_budget_label, static_cast<variantArg_t>(appConfig.vt_poll_completion_budget)},
+      {"Runtime", vt_async_op_poll_budget_label, static_cast<variantArg_t>(appConfig.vt_async_op_poll_budget)},
 
       // Visualization
       {"Visualization", vt_tv_label, static_cast<variantArg_t>(appConfig.vt_tv)},
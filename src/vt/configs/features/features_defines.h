@@ -64,6 +64,7 @@
 #define vt_feature_priorities          0 || vt_feature_cmake_priorities
 #define vt_feature_fcontext            0 || vt_feature_cmake_fcontext
 #define vt_feature_mimalloc            0 || vt_feature_cmake_mimalloc
+#define vt_feature_alloc_tracking      0 || vt_feature_cmake_alloc_tracking
 #define vt_feature_mpi_access_guards   0 || vt_feature_cmake_mpi_access_guards
 #define vt_feature_zoltan              0 || vt_feature_cmake_zoltan
 #define vt_feature_ci_build            0 || vt_feature_cmake_ci_build
@@ -54,6 +54,7 @@
 #define vt_feature_str_lblite             "Load Balancing for Collections"
 #define vt_feature_str_memory_pool        "Memory Pooling"
 #define vt_feature_str_mimalloc           "mimalloc memory allocator"
+#define vt_feature_str_alloc_tracking     "Heap allocation tracking"
 #define vt_feature_str_mpi_access_guards  "MPI access guards"
 #define vt_feature_str_mpi_rdma           "Native RDMA with MPI"
 #define vt_feature_str_no_feature         "No feature"
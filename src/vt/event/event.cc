@@ -191,11 +191,13 @@ EventType AsyncEvent::attachAction(EventType const& event, ActionType callable)
 /*virtual*/ AsyncEvent::~AsyncEvent() { }
 
 void AsyncEvent::finalize() {
-  while (polling_event_container_.size() > 0) {
+  while (polling_slots_.size() > 0) {
     testEventsTrigger();
   }
-  lookup_container_.clear();
-  event_container_.clear();
+  pages_.clear();
+  free_slots_.clear();
+  num_slots_ = 0;
+  num_live_normal_ = 0;
 }
 
 int AsyncEvent::progress([[maybe_unused]] TimeType current_time) {
@@ -204,7 +206,7 @@ int AsyncEvent::progress([[maybe_unused]] TimeType current_time) {
 }
 
 bool AsyncEvent::isLocalTerm() {
-  return event_container_.size() == 0;
+  return num_live_normal_ == 0;
 }
 
 NodeType AsyncEvent::getOwningNode(EventType const& event) {
@@ -219,25 +221,89 @@ bool AsyncEvent::needsPolling(EventRecordTypeType const& type) {
 EventType AsyncEvent::createEvent(
   EventRecordTypeType const& type, NodeType const& node
 ) {
-  EventType const event = EventManagerType::makeEvent(cur_event_, node);
-  cur_event_++;
-
-  auto et = std::make_unique<EventRecordType>(type, event);
+  EventSlotType slot = 0;
+  if (free_slots_.empty()) {
+    vtAbortIf(
+      num_slots_ >= (std::size_t{1} << event_slot_num_bits),
+      "Exceeded the maximum number of outstanding events"
+    );
+    if (num_slots_ % slots_per_page == 0) {
+      pages_.emplace_back(std::make_unique<EventSlot[]>(slots_per_page));
+    }
+    slot = static_cast<EventSlotType>(num_slots_++);
+  } else {
+    slot = free_slots_.back();
+    free_slots_.pop_back();
+  }
 
-  auto& container = needsPolling(type)
-    ? polling_event_container_ : event_container_;
+  auto& entry = slotAt(slot);
+  EventType const event = EventManagerType::makeEvent(
+    slot, entry.generation, node
+  );
 
-  container.emplace_back(EventHolderType(std::move(et)));
+  entry.holder.reset(type, event);
+  entry.live = true;
+  entry.polled = needsPolling(type);
 
-  lookup_container_.emplace(
-    std::piecewise_construct,
-    std::forward_as_tuple(event),
-    std::forward_as_tuple(--container.end())
-  );
+  if (entry.polled) {
+    entry.polling_pos = polling_slots_.size();
+    polling_slots_.push_back(slot);
+  } else {
+    num_live_normal_++;
+  }
 
   return event;
 }
 
+AsyncEvent::EventSlot* AsyncEvent::findSlot(EventType const& event) {
+  if (getOwningNode(event) != theContext()->getNode()) {
+    return nullptr;
+  }
+
+  auto const slot = EventManagerType::getEventSlot(event);
+  if (slot >= num_slots_) {
+    return nullptr;
+  }
+
+  auto& entry = slotAt(slot);
+  if (not entry.live or
+      entry.generation != EventManagerType::getEventGeneration(event)) {
+    return nullptr;
+  }
+  return &entry;
+}
+
+void AsyncEvent::unlinkPolling(EventSlotType slot) {
+  auto& entry = slotAt(slot);
+  if (entry.polling_pos == not_polling) {
+    return;
+  }
+
+  auto const last = polling_slots_.back();
+  polling_slots_[entry.polling_pos] = last;
+  slotAt(last).polling_pos = entry.polling_pos;
+  polling_slots_.pop_back();
+  entry.polling_pos = not_polling;
+}
+
+void AsyncEvent::freeSlot(EventSlotType slot) {
+  auto& entry = slotAt(slot);
+  vtAssert(entry.live, "Event slot must be live to free it");
+
+  if (entry.polled) {
+    unlinkPolling(slot);
+  } else {
+    num_live_normal_--;
+  }
+
+  auto const gen_mask =
+    (EventGenerationType{1} << event_generation_num_bits) - 1;
+  entry.holder.release();
+  entry.live = false;
+  entry.generation = (entry.generation + 1) & gen_mask;
+  free_slots_.push_back(slot);
+}
+
 EventType AsyncEvent::createMPIEvent(NodeType const& node) {
   return createEvent(EventRecordTypeType::MPI_EventRecord, node);
 }
@@ -251,10 +317,8 @@ EventType AsyncEvent::createParentEvent(NodeType const& node) {
 }
 
 void AsyncEvent::removeEventID(EventType const& event) {
-  auto iter = lookup_container_.find(event);
-  if (iter != lookup_container_.end()) {
-    event_container_.erase(iter->second);
-    lookup_container_.erase(event);
+  if (findSlot(event) != nullptr) {
+    freeSlot(EventManagerType::getEventSlot(event));
   }
 }
 
@@ -271,17 +335,15 @@ AsyncEvent::EventHolderType& AsyncEvent::getEventHolder(EventType const& event)
     vtAssert(0, "Event does not belong to this node");
   }
 
-  auto container_iter = lookup_container_.find(event);
+  auto entry = findSlot(event);
 
-  vtAssert(
-    container_iter != lookup_container_.end(), "Event must exist in container"
-  );
+  vtAssert(entry != nullptr, "Event must exist in container");
 
-  return *container_iter->second;
+  return entry->holder;
 }
 
 bool AsyncEvent::holderExists(EventType const& event) {
-  return lookup_container_.find(event) != lookup_container_.end();
+  return findSlot(event) != nullptr;
 }
 
 AsyncEvent::EventStateType AsyncEvent::testEventComplete(EventType const& event) {
@@ -311,15 +373,15 @@ void AsyncEvent::testEventsTrigger(int const& num_events) {
 # endif
 
   int cur = 0;
-  auto& cont = polling_event_container_;
 
-  if (cont.size() > 0) {
-    eventSizeGauge.update(cont.size());
+  if (polling_slots_.size() > 0) {
+    eventSizeGauge.update(polling_slots_.size());
   }
 
-  for (auto iter = cont.begin(); iter != cont.end(); ) {
-    auto& holder = *iter;
-    auto event = holder.get_event();
+  for (std::size_t i = 0; i < polling_slots_.size(); ) {
+    auto const slot = polling_slots_[i];
+    auto& entry = slotAt(slot);
+    auto event = entry.holder.get_event();
     auto id = event->getEventID();
 
     eventPollCount.increment(1);
@@ -332,9 +394,13 @@ void AsyncEvent::testEventsTrigger(int const& num_events) {
       );
 #     endif
 
-      holder.executeActions();
-      iter = polling_event_container_.erase(iter);
-      lookup_container_.erase(id);
+      // Unlink before the actions run since they may create or complete other
+      // events; the last polling slot moves to this position
+      unlinkPolling(slot);
+      entry.holder.executeActions();
+      if (findSlot(id) != nullptr) {
+        freeSlot(slot);
+      }
 
 #     if vt_check_enabled(trace_enabled)
       if (theConfig()->vt_trace_event_polling) {
@@ -343,7 +409,7 @@ void AsyncEvent::testEventsTrigger(int const& num_events) {
 #     endif
 
     } else {
-      iter++;
+      i++;
     }
 
     cur++;
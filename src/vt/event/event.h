@@ -54,9 +54,7 @@
 
 #include <memory>
 #include <vector>
-#include <list>
 #include <functional>
-#include <unordered_map>
 
 #include <mpi.h>
 
@@ -81,6 +79,15 @@ enum class EventState : int8_t {
  * \brief Used to track events
  *
  * Component to track events in the system to trigger actions or other events
+ *
+ * Events live in a table of fixed-size pages of slots that are reused through
+ * a free list, so creating, looking up and removing an event does not
+ * allocate once the table has grown to the number of outstanding events. An
+ * \c EventType encodes the slot and the slot's generation, which is bumped
+ * each time the slot is freed, so an identifier of a removed event no longer
+ * matches its slot. The generation only wraps after 2^28 reuses of a slot. A
+ * freed slot drops its actions and managed message right away. The slots of events that need polling are kept in a
+ * separate dense list that \c testEventsTrigger iterates.
  */
 struct AsyncEvent : runtime::component::PollableComponent<AsyncEvent> {
   using EventRecordTypeType = eEventRecord;
@@ -90,9 +97,9 @@ struct AsyncEvent : runtime::component::PollableComponent<AsyncEvent> {
   using EventRecordPtrType = std::unique_ptr<EventRecordType>;
   using EventHolderType = EventHolder;
   using EventHolderPtrType = EventHolder*;
-  using TypedEventContainerType = std::list<EventHolderType>;
-  using EventContIter = typename TypedEventContainerType::iterator;
-  using EventContainerType = std::unordered_map<EventType, EventContIter>;
+
+  /// The number of slots allocated at once when the table grows
+  static constexpr std::size_t const slots_per_page = 1024;
 
   AsyncEvent() = default;
 
@@ -188,13 +195,13 @@ struct AsyncEvent : runtime::component::PollableComponent<AsyncEvent> {
 
   template <typename SerializerT>
   void serialize(SerializerT& s) {
-    s | cur_event_
-      | event_container_
-      | polling_event_container_
+    s | num_slots_
+      | free_slots_
+      | polling_slots_
+      | num_live_normal_
       | eventPollCount
       | eventSizeGauge
-      | mpiEventWaitTime
-      | lookup_container_;
+      | mpiEventWaitTime;
 
   # if vt_check_enabled(trace_enabled)
     s | trace_event_polling;
@@ -202,17 +209,63 @@ struct AsyncEvent : runtime::component::PollableComponent<AsyncEvent> {
   }
 
 private:
-  // next event id
-  EventType cur_event_ = 0;
+  static constexpr std::size_t const not_polling = ~std::size_t{0};
+
+  /**
+   * \internal \struct EventSlot
+   *
+   * \brief An entry in the event table
+   */
+  struct EventSlot {
+    EventHolderType holder;
+    EventGenerationType generation = 0;
+    bool live = false;
+    bool polled = false;                    /**< Whether its type is polled */
+    std::size_t polling_pos = not_polling;  /**< Index in polling_slots_ */
+  };
+
+  EventSlot& slotAt(EventSlotType slot) {
+    return pages_[slot / slots_per_page][slot % slots_per_page];
+  }
+
+  /**
+   * \internal \brief Find the live slot of an event on this node
+   *
+   * \param[in] event the event identifier
+   *
+   * \return the slot or \c nullptr if the event does not exist
+   */
+  EventSlot* findSlot(EventType const& event);
+
+  /**
+   * \internal \brief Take a slot out of the polling list
+   *
+   * \param[in] slot the slot
+   */
+  void unlinkPolling(EventSlotType slot);
+
+  /**
+   * \internal \brief Free a slot for reuse and invalidate its identifier
+   *
+   * \param[in] slot the slot
+   */
+  void freeSlot(EventSlotType slot);
+
+private:
+  // pages of event slots; a page never moves so holders stay put
+  std::vector<std::unique_ptr<EventSlot[]>> pages_;
+
+  // number of slots handed out so far
+  std::size_t num_slots_ = 0;
 
-  // std::list of events
-  TypedEventContainerType event_container_;
+  // slots available for reuse
+  std::vector<EventSlotType> free_slots_;
 
-  // list of events that need polling for progress
-  TypedEventContainerType polling_event_container_;
+  // slots of events that need polling for progress
+  std::vector<EventSlotType> polling_slots_;
 
-  // container to lookup events by EventType
-  EventContainerType lookup_container_;
+  // number of live events that do not need polling
+  std::size_t num_live_normal_ = 0;
 
 # if vt_check_enabled(trace_enabled)
   vt::trace::UserEventIDType trace_event_polling = 0;
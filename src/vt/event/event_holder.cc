@@ -51,6 +51,22 @@ EventHolder::EventRecordType* EventHolder::get_event() const {
   return event_.get();
 }
 
+void EventHolder::reset(eEventRecord const& type, EventType const& id) {
+  if (event_ == nullptr) {
+    event_ = std::make_unique<EventRecordType>(type, id);
+  } else {
+    event_->reset(type, id);
+  }
+  actions_.clear();
+}
+
+void EventHolder::release() {
+  if (event_ != nullptr) {
+    event_->release();
+  }
+  actions_.clear();
+}
+
 void EventHolder::attachAction(ActionType action) {
   actions_.emplace_back(action);
 }
@@ -64,6 +64,8 @@ struct EventHolder {
   { }
 
   EventRecordType* get_event() const;
+  void reset(eEventRecord const& type, EventType const& id);
+  void release();
   void attachAction(ActionType action);
   void makeReadyTrigger();
   void executeActions();
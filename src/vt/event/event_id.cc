@@ -89,4 +89,34 @@ namespace vt { namespace event {
   >(event);
 }
 
+/*static*/ EventType EventIDManager::makeEvent(
+  EventSlotType const& slot, EventGenerationType const& gen,
+  NodeType const& node
+) {
+  EventType new_event_id = 0;
+  EventIDManager::setEventNode(new_event_id, node);
+  BitPackerType::setField<EventIDBitsType::EventSlot, event_slot_num_bits>(
+    new_event_id, slot
+  );
+  BitPackerType::setField<
+    EventIDBitsType::EventGeneration, event_generation_num_bits
+  >(new_event_id, gen);
+  return new_event_id;
+}
+
+/*static*/ EventSlotType EventIDManager::getEventSlot(EventType const& event) {
+  return BitPackerType::getField<
+    EventIDBitsType::EventSlot, event_slot_num_bits, EventSlotType
+  >(event);
+}
+
+/*static*/ EventGenerationType EventIDManager::getEventGeneration(
+  EventType const& event
+) {
+  return BitPackerType::getField<
+    EventIDBitsType::EventGeneration, event_generation_num_bits,
+    EventGenerationType
+  >(event);
+}
+
 }} //end namespace vt::event
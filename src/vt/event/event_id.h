@@ -50,12 +50,28 @@
 namespace vt { namespace event {
 
 using EventIdentifierType = int32_t;
+using EventSlotType = uint32_t;
+using EventGenerationType = uint32_t;
 
 static constexpr BitCountType const event_identifier_num_bits = 32;
 
+/// The identifier is a slot in the event table and the slot's generation,
+/// which changes each time the slot is reused so stale identifiers miss. The
+/// generation takes all bits above the slot, so it only wraps after a slot
+/// was reused 2^28 times
+static constexpr BitCountType const event_slot_num_bits = 20;
+static constexpr BitCountType const event_generation_num_bits =
+  sizeof(EventType) * 8 - node_num_bits - event_slot_num_bits;
+
+static_assert(
+  event_generation_num_bits >= 24, "Event generations must not wrap quickly"
+);
+
 enum eEventIDBits {
-  Node       = 0,
-  EventIdent = eEventIDBits::Node       + node_num_bits
+  Node            = 0,
+  EventIdent      = eEventIDBits::Node       + node_num_bits,
+  EventSlot       = eEventIDBits::EventIdent,
+  EventGeneration = eEventIDBits::EventSlot  + event_slot_num_bits
 };
 
 struct EventIDManager {
@@ -69,6 +85,13 @@ struct EventIDManager {
   static void setEventIdentifier(EventType& event, EventIdentifierType const& id);
   static EventIdentifierType getEventIdentifier(EventType const& event);
 
+  static EventType makeEvent(
+    EventSlotType const& slot, EventGenerationType const& gen,
+    NodeType const& node
+  );
+  static EventSlotType getEventSlot(EventType const& event);
+  static EventGenerationType getEventGeneration(EventType const& event);
+
 };
 
 }} //end namespace vt::event
@@ -55,12 +55,48 @@ namespace vt { namespace event {
 EventRecord::EventRecord(EventRecordType const& type, EventType const& id)
   : event_id_(id), type_(type)
 {
+  init();
+}
+
+void EventRecord::reset(EventRecordType const& type, EventType const& id) {
+  // A parent event keeps its list, and the list's capacity, when reused for
+  // another parent event
+  bool const reuse_list =
+    type_ == EventRecordType::ParentEventRecord and
+    type == EventRecordType::ParentEventRecord;
 
+  if (type_ == EventRecordType::ParentEventRecord and not reuse_list) {
+    delete event_union_.event_list;
+  }
+
+  ready = false;
+  msg_ = nullptr;
+  event_id_ = id;
+  type_ = type;
+
+  if (reuse_list) {
+    event_union_.event_list->clear();
+#   if vt_check_enabled(diagnostics)
+    creation_time_stamp_ = timing::getCurrentTime();
+#   endif
+  } else {
+    init();
+  }
+}
+
+void EventRecord::release() {
+  msg_ = nullptr;
+  if (type_ == EventRecordType::ParentEventRecord) {
+    event_union_.event_list->clear();
+  }
+}
+
+void EventRecord::init() {
 # if vt_check_enabled(diagnostics)
   creation_time_stamp_ = timing::getCurrentTime();
 # endif
 
-  switch (type) {
+  switch (type_) {
   case EventRecordType::MPI_EventRecord:
     event_union_.mpi_req = MPI_REQUEST_NULL;
     break;
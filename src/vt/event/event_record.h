@@ -86,6 +86,21 @@ struct EventRecord {
 
   EventRecord(EventRecordType const& type, EventType const& id);
 
+  /**
+   * \internal \brief Reinitialize the record in place for a new event so the
+   * event table can reuse it without allocating
+   *
+   * \param[in] type the type of the new event
+   * \param[in] id the identifier of the new event
+   */
+  void reset(EventRecordType const& type, EventType const& id);
+
+  /**
+   * \internal \brief Drop what the record refers to once its event is
+   * removed, keeping its storage for the next event in the slot
+   */
+  void release();
+
   bool testMPIEventReady();
   bool testNormalEventReady();
   bool testParentEventReady();
@@ -122,6 +137,9 @@ struct EventRecord {
   # endif
   }
 
+private:
+  void init();
+
 private:
   bool ready = false;
 
@@ -51,6 +51,7 @@
 #include "vt/group/global/group_default.h"
 #include "vt/group/global/group_default_msg.h"
 #include "vt/scheduler/scheduler.h"
+#include "vt/termination/termination.h"
 #include "vt/collective/collective_alg.h"
 
 #include <mpi.h>
@@ -124,6 +125,58 @@ void GroupManager::deleteGroupCollective(GroupType group_id) {
   }
 }
 
+GroupType GroupManager::newGroupSparse(RegionPtrType in_region) {
+  auto const hash = in_region->hash();
+  auto const group = GroupIDBuilder::createSparseGroupID(hash);
+
+  // The ID keeps only part of the hash: a live group with the same ID must
+  // be the same region
+  auto existing = sparse_groups_.find(group);
+  vtAbortIf(
+    existing != sparse_groups_.end() and existing->second.hash != hash,
+    fmt::format(
+      "Sparse group ID collision: group={:x}, hash={:x}, other hash={:x}",
+      group, hash,
+      existing != sparse_groups_.end() ? existing->second.hash : 0
+    )
+  );
+
+  auto tree = sparse_tree_cache_.find(hash);
+  if (tree == nullptr) {
+    tree = std::make_shared<sparse::SparseTree const>(in_region->makeList());
+    sparse_tree_cache_.insert(hash, tree);
+  } else {
+    vtAbortIf(
+      not tree->matches(in_region.get()),
+      fmt::format("Sparse group region hash collision: hash={:x}", hash)
+    );
+  }
+
+  vt_debug_print(
+    normal, group,
+    "GroupManager::newGroupSparse: group={:x}, size={}, cache hits={}\n",
+    group, tree->getSize(), sparse_tree_cache_.getHits()
+  );
+
+  sparse_groups_[group] = SparseGroupType{hash, tree};
+
+  // Forward broadcasts that arrived before this node created the group
+  auto pending = pending_sparse_.find(group);
+  if (pending != pending_sparse_.end()) {
+    auto actions = std::move(pending->second);
+    pending_sparse_.erase(pending);
+    for (auto&& action : actions) {
+      action();
+    }
+  }
+
+  return group;
+}
+
+void GroupManager::deleteGroupSparse(GroupType group_id) {
+  sparse_groups_.erase(group_id);
+}
+
 std::optional<GroupType>
 GroupManager::GetTempGroupForRange(const region::Region::ListType& range) {
   const auto it = temporary_groups_.find(range);
@@ -135,6 +188,10 @@ GroupManager::GetTempGroupForRange(const region::Region::ListType& range) {
 }
 
 bool GroupManager::inGroup(GroupType const group) {
+  auto sparse_iter = sparse_groups_.find(group);
+  if (sparse_iter != sparse_groups_.end()) {
+    return sparse_iter->second.tree->isMember(theContext()->getNode());
+  }
   auto iter = local_collective_group_info_.find(group);
   vtAssert(iter != local_collective_group_info_.end(), "Must exist");
   return iter->second->inGroup();
@@ -152,6 +209,10 @@ GroupManager::ReducePtrType GroupManager::groupReducer(GroupType const group) {
 }
 
 NodeType GroupManager::groupRoot(GroupType const group) const {
+  auto sparse_iter = sparse_groups_.find(group);
+  if (sparse_iter != sparse_groups_.end()) {
+    return sparse_iter->second.tree->getLowest();
+  }
   auto iter = local_collective_group_info_.find(group);
   vtAssert(iter != local_collective_group_info_.end(), "Must exist");
   auto const& root = iter->second->getRoot();
@@ -286,6 +347,8 @@ void GroupManager::initializeLocalGroup(
       *deliver = !root;
       if (group == default_group) {
         return global::DefaultGroup::broadcast(base,from,root,deliver);
+      } else if (GroupIDBuilder::isSparse(group)) {
+        return theGroup()->sendGroupSparse(base,from,root,deliver);
       } else {
         auto const& is_collective_group = GroupIDBuilder::isCollective(group);
         if (is_collective_group) {
@@ -433,6 +496,70 @@ EventType GroupManager::sendGroupCollective(
   }
 }
 
+EventType GroupManager::sendGroupSparse(
+  MsgSharedPtr<BaseMsgType> const& base, NodeType const from,
+  bool const is_root,
+  bool* const deliver
+) {
+  auto const& send_tag = static_cast<messaging::MPI_TagType>(
+    messaging::MPITag::ActiveMsgTag
+  );
+  auto const& this_node = theContext()->getNode();
+  auto const& msg = base.get();
+  auto const& group = envelopeGetGroup(msg->env);
+  auto const& dest = envelopeGetDest(msg->env);
+
+  auto iter = sparse_groups_.find(group);
+  if (iter == sparse_groups_.end()) {
+    vtAbortIf(is_root, "A sparse group must be created before sending to it");
+
+    /*
+     *  Only members receive a sparse group broadcast, so this is a member that
+     *  has not created the group yet: deliver now and forward to the children
+     *  once it does. Hold the epoch open until the message is forwarded.
+     */
+    auto const epoch = envelopeIsEpochType(msg->env) ?
+      envelopeGetEpoch(msg->env) : term::any_epoch_sentinel;
+    theTerm()->produce(epoch);
+    pending_sparse_[group].push_back([base,from,epoch]{
+      // Do not capture deliver, it's a pointer to stack memory
+      bool dummy;
+      theGroup()->sendGroupSparse(base,from,false,&dummy);
+      theTerm()->consume(epoch);
+    });
+    *deliver = true;
+    return no_event;
+  }
+
+  auto const& tree = *iter->second.tree;
+
+  vt_debug_print(
+    terse, group,
+    "GroupManager::sendGroupSparse: group={:x}, is_root={}, dest={}, from={}, "
+    "member={}\n",
+    group, is_root, dest, from, tree.isMember(this_node)
+  );
+
+  if (not tree.isMember(this_node)) {
+    vtAssert(is_root, "Only members receive a sparse group broadcast");
+    /*
+     *  Forward to the lowest member, which roots the tree for senders outside
+     *  the group; do not deliver on this node.
+     */
+    *deliver = false;
+    return theMsg()->sendMsgBytesWithPut(tree.getLowest(), base, send_tag);
+  }
+
+  // A member that broadcasts roots the tree; otherwise the lowest member does
+  auto const root = tree.isMember(dest) ? dest : tree.getLowest();
+  tree.foreachChild(root, this_node, [&](NodeType child){
+    theMsg()->sendMsgBytesWithPut(child, base, send_tag);
+  });
+
+  *deliver = is_root ? envelopeGetDeliverBcast(msg->env) : true;
+  return no_event;
+}
+
 EventType GroupManager::sendGroup(
   MsgSharedPtr<BaseMsgType> const& base, NodeType const from,
   bool const is_root,
@@ -53,6 +53,7 @@
 #include "vt/group/msg/group_msg.h"
 #include "vt/group/global/group_default.h"
 #include "vt/group/global/group_default_msg.h"
+#include "vt/group/sparse/group_sparse_tree.h"
 #include "vt/registry/auto/auto_registry_interface.h"
 #include "vt/messaging/message.h"
 #include "vt/messaging/message/smart_ptr.h"
@@ -100,6 +101,14 @@ struct GroupManager : runtime::component::Component<GroupManager> {
   using ReduceType = collective::reduce::Reduce;
   using ReducePtrType = ReduceType*;
   using CollectiveScopeType = collective::CollectiveScope;
+  using SparseTreePtrType = sparse::SparseTreeCache::TreePtrType;
+
+  /// A sparse group's tree and the full hash of its region, which the group
+  /// ID only holds part of
+  struct SparseGroupType {
+    std::size_t hash = 0;
+    SparseTreePtrType tree = nullptr;
+  };
 
   /**
    * \internal \brief Construct the GroupManager
@@ -180,6 +189,42 @@ struct GroupManager : runtime::component::Component<GroupManager> {
    */
   void deleteGroupCollective(GroupType group_id);
 
+  /**
+   * \brief Create a sparse group locally without communication.
+   *
+   * The group ID and spanning tree are derived from the region alone, so the
+   * group is usable as soon as this returns. Every member, and every node that
+   * broadcasts to the group, must create it with the same region encoding
+   * (e.g., the same \c region::Range or \c region::Bitmap); members that
+   * receive a broadcast before creating it deliver it and forward it to their
+   * children once they do. Trees of recently created regions are cached, so
+   * re-creating a group over the same region is a hash lookup. Aborts if the
+   * region's ID or hash collides with that of a different region on this
+   * node, since nodes could not agree on a different ID without communicating.
+   *
+   * Sparse groups have no MPI communicator or reducer; use
+   * \c newGroupCollective for those.
+   *
+   * \param[in] in_region the nodes in the group
+   *
+   * \return the group ID
+   */
+  GroupType newGroupSparse(RegionPtrType in_region);
+
+  /**
+   * \brief Delete a sparse group on this node
+   *
+   * \param[in] group_id the id for the group
+   */
+  void deleteGroupSparse(GroupType group_id);
+
+  /**
+   * \brief Get the cache of sparse group spanning trees
+   */
+  sparse::SparseTreeCache const& getSparseTreeCache() const {
+    return sparse_tree_cache_;
+  }
+
   /**
    * \internal \brief Generate the next group ID
    *
@@ -359,6 +404,22 @@ private:
     bool* const deliver
   );
 
+  /**
+   * \internal \brief Send message to a sparse group
+   *
+   * \param[in] base the message to send
+   * \param[in] from sender node
+   * \param[in] is_root whether this node is the root
+   * \param[out] deliver whether the caller should deliver locally
+   *
+   * \return the event ID for any generated events (like MPI_Requests)
+   */
+  EventType sendGroupSparse(
+    MsgSharedPtr<BaseMsgType> const& base, NodeType const from,
+    bool const is_root,
+    bool* const deliver
+  );
+
 public:
   /**
    * \brief Get the reducer associated with a group to reduce over it
@@ -450,6 +511,9 @@ private:
   CollectiveScopeType   collective_scope_;
   std::unordered_map<region::Region::ListType, GroupType, region::ListHash>
     temporary_groups_ = {};
+  std::unordered_map<GroupType, SparseGroupType> sparse_groups_ = {};
+  std::unordered_map<GroupType, ActionListType> pending_sparse_ = {};
+  sparse::SparseTreeCache sparse_tree_cache_;
 };
 
 /**
@@ -107,6 +107,22 @@ namespace vt { namespace group {
   >(group);
 }
 
+/*static*/ GroupType GroupIDBuilder::createSparseGroupID(
+  std::size_t const& region_hash
+) {
+  auto const hash = static_cast<uint64_t>(region_hash);
+  GroupType new_group = 0;
 
+  setIsCollective(new_group, true);
+  setIsStatic(new_group, false);
+  setNode(new_group, static_cast<NodeType>(hash & 0xFFFFFFFF));
+  setID(new_group, static_cast<GroupIDType>(hash >> group_node_num_bits));
+
+  return new_group;
+}
+
+/*static*/ bool GroupIDBuilder::isSparse(GroupType const& group) {
+  return isCollective(group) and not isStatic(group);
+}
 
 }} /* end namespace vt::group */
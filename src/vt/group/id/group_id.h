@@ -79,6 +79,14 @@ struct GroupIDBuilder {
   static bool isStatic(GroupType const& group);
   static NodeType getNode(GroupType const& group);
   static GroupIDType getGroupID(GroupType const& group);
+
+  /*
+   * Sparse groups are named by the hash of their region so every node derives
+   * the same ID locally. They are marked collective but not static, a
+   * combination other groups never use (collective groups are always static).
+   */
+  static GroupType createSparseGroupID(std::size_t const& region_hash);
+  static bool isSparse(GroupType const& group);
 };
 
 }} /* end namespace vt::group */
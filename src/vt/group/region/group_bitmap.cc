@@ -0,0 +1,190 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                               group_bitmap.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include "vt/config.h"
+#include "vt/group/group_common.h"
+#include "vt/group/region/group_region.h"
+#include "vt/group/region/group_bitmap.h"
+
+#include <vector>
+#include <algorithm>
+#include <bitset>
+
+namespace vt { namespace group { namespace region {
+
+Bitmap::Bitmap(BoundType in_num_nodes)
+  : num_nodes_(in_num_nodes),
+    words_((in_num_nodes + word_bits - 1) / word_bits, 0)
+{ }
+
+Bitmap::Bitmap(BoundType in_num_nodes, WordListType in_words)
+  : num_nodes_(in_num_nodes),
+    words_(std::move(in_words))
+{
+  vtAssert(
+    words_.size() == static_cast<std::size_t>(
+      (in_num_nodes + word_bits - 1) / word_bits
+    ),
+    "Number of words must cover the nodes"
+  );
+}
+
+void Bitmap::add(NodeType node) {
+  vtAssert(node >= 0 and node < num_nodes_, "Node must be in the bitmap");
+  words_[node / word_bits] |= WordType{1} << (node % word_bits);
+  made_list_ = false;
+  list_.clear();
+}
+
+bool Bitmap::test(BoundType node) const {
+  return (words_[node / word_bits] >> (node % word_bits)) & 1;
+}
+
+Bitmap::BoundType Bitmap::next(BoundType node) const {
+  for (BoundType i = node; i < num_nodes_; i++) {
+    if (test(i)) {
+      return i;
+    }
+  }
+  return uninitialized_destination;
+}
+
+/*virtual*/ Bitmap::SizeType Bitmap::getSize() const {
+  SizeType size = 0;
+  for (auto&& word : words_) {
+    size += std::bitset<word_bits>(word).count();
+  }
+  return size;
+}
+
+/*virtual*/ void Bitmap::sort() {
+  // do nothing, it's already sorted
+}
+
+/*virtual*/ bool Bitmap::contains(NodeType const& node) {
+  return node >= 0 and node < num_nodes_ and test(node);
+}
+
+/*virtual*/ Bitmap::ListType const& Bitmap::makeList() {
+  if (!made_list_) {
+    ListType list;
+    list.reserve(getSize());
+    for (BoundType i = 0; i < num_nodes_; i++) {
+      if (test(i)) {
+        list.push_back(i);
+      }
+    }
+    list_ = std::move(list);
+    made_list_ = true;
+  }
+  return list_;
+}
+
+/*virtual*/ bool Bitmap::isList() const {
+  return false;
+}
+
+/*virtual*/ Bitmap::BoundType Bitmap::head() const {
+  auto const first = next(0);
+  vtAssert(
+    first != uninitialized_destination, "Must be non-empty to invoke head()"
+  );
+  return first;
+}
+
+/*virtual*/ Bitmap::RegionUPtrType Bitmap::tail() const {
+  auto bitmap = std::make_unique<Bitmap>(num_nodes_, words_);
+  auto const first = head();
+  bitmap->words_[first / word_bits] &= ~(WordType{1} << (first % word_bits));
+  return bitmap;
+}
+
+/*virtual*/ Bitmap::SplitRegionType Bitmap::split() const {
+  auto const size = getSize();
+  vtAssert(
+    size >= 2, "Size must be at least 2 to split"
+  );
+
+  auto r1 = std::make_unique<Bitmap>(num_nodes_);
+  auto r2 = std::make_unique<Bitmap>(num_nodes_);
+  SizeType count = 0;
+  for (BoundType i = next(0); i != uninitialized_destination; i = next(i + 1)) {
+    if (count++ < size/2) {
+      r1->add(i);
+    } else {
+      r2->add(i);
+    }
+  }
+  return std::make_tuple(std::move(r1),std::move(r2));
+}
+
+/*virtual*/ Bitmap::RegionUPtrType Bitmap::copy() const {
+  return std::make_unique<Bitmap>(*this);
+}
+
+/*virtual*/ void Bitmap::splitN(int nsplits, ApplyFnType apply) const {
+  auto const size = static_cast<int>(getSize());
+  auto const num_splits = std::min(nsplits, size);
+  auto cur = next(0);
+  for (auto split = 0; split < num_splits; split++) {
+    auto const child_size = split == num_splits - 1 ?
+      size - split * (size / num_splits) : size / num_splits;
+    auto r1 = std::make_unique<Bitmap>(num_nodes_);
+    for (int i = 0; i < child_size; i++) {
+      r1->add(cur);
+      cur = next(cur + 1);
+    }
+    apply(std::move(r1));
+  }
+}
+
+/*virtual*/ std::size_t Bitmap::hash() {
+  std::size_t seed = bitmap_hash_tag;
+  seed = hashCombine(seed, std::hash<BoundType>{}(num_nodes_));
+  for (auto&& word : words_) {
+    seed = hashCombine(seed, std::hash<WordType>{}(word));
+  }
+  return seed;
+}
+
+}}} /* end namespace vt::group::region */
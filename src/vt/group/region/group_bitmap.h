@@ -0,0 +1,121 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                group_bitmap.h
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_GROUP_REGION_GROUP_BITMAP_H
+#define INCLUDED_VT_GROUP_REGION_GROUP_BITMAP_H
+
+#include "vt/config.h"
+#include "vt/group/group_common.h"
+#include "vt/group/region/group_region.h"
+
+#include <vector>
+#include <cstdint>
+
+namespace vt { namespace group { namespace region {
+
+/**
+ * \struct Bitmap
+ *
+ * \brief A region encoded as one bit per node, for irregular subsets that a
+ * \c Range can not describe and that would be large as a \c List.
+ */
+struct Bitmap : Region {
+  using WordType = uint64_t;
+  using WordListType = std::vector<WordType>;
+
+  static constexpr BoundType const word_bits = sizeof(WordType) * 8;
+
+  /**
+   * \brief Construct an empty bitmap over nodes [0, num_nodes)
+   *
+   * \param[in] in_num_nodes the number of nodes the bitmap covers
+   */
+  explicit Bitmap(BoundType in_num_nodes);
+
+  /**
+   * \brief Construct a bitmap from its words
+   *
+   * \param[in] in_num_nodes the number of nodes the bitmap covers
+   * \param[in] in_words the words, bit \c i of word \c w is node \c 64*w+i
+   */
+  Bitmap(BoundType in_num_nodes, WordListType in_words);
+
+  Bitmap(Bitmap const&) = default;
+  Bitmap(Bitmap&&) = default;
+  Bitmap& operator=(Bitmap const&) = default;
+
+  /**
+   * \brief Add a node to the bitmap
+   *
+   * \param[in] node the node
+   */
+  void add(NodeType node);
+
+  WordListType const& getWords() const { return words_; }
+
+  virtual SizeType getSize() const override;
+  virtual void sort() override;
+  virtual bool contains(NodeType const& node) override;
+  virtual ListType const& makeList() override;
+  virtual bool isList() const override;
+  virtual BoundType head() const override;
+  virtual RegionUPtrType tail() const override;
+  virtual SplitRegionType split() const override;
+  virtual RegionUPtrType copy() const override;
+  virtual void splitN(int nsplits, ApplyFnType apply) const override;
+  virtual std::size_t hash() override;
+
+private:
+  bool test(BoundType node) const;
+  BoundType next(BoundType node) const;
+
+private:
+  BoundType num_nodes_ = 0;
+  WordListType words_;
+  bool made_list_ = false;
+  ListType list_;
+};
+
+}}} /* end namespace vt::group::region */
+
+#endif /*INCLUDED_VT_GROUP_REGION_GROUP_BITMAP_H*/
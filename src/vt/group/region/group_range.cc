@@ -141,4 +141,13 @@ Range::Range(Range const& in_other, BoundType in_remove_extent)
   }
 }
 
+/*virtual*/ std::size_t Range::hash() {
+  // Hash the bounds, not the expanded list, so the hash is O(1)
+  std::size_t seed = range_hash_tag;
+  seed = hashCombine(seed, std::hash<BoundType>{}(lo_));
+  seed = hashCombine(seed, std::hash<BoundType>{}(hi_));
+  seed = hashCombine(seed, std::hash<BoundType>{}(stride_));
+  return seed;
+}
+
 }}} /* end namespace vt::group::region */
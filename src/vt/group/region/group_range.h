@@ -75,6 +75,7 @@ struct Range : Region {
   virtual SplitRegionType split() const override;
   virtual RegionUPtrType copy() const override;
   virtual void splitN(int nsplits, ApplyFnType apply) const override;
+  virtual std::size_t hash() override;
 
   friend struct RangeData;
 
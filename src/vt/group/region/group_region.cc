@@ -46,4 +46,9 @@
 
 namespace vt { namespace group { namespace region {
 
+/*virtual*/ std::size_t Region::hash() {
+  sort();
+  return ListHash{}(makeList());
+}
+
 }}} /* end namespace vt::group::region */
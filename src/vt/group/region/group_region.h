@@ -75,6 +75,17 @@ struct Region {
   virtual RegionUPtrType tail() const = 0;
   virtual SplitRegionType split() const = 0;
   virtual void splitN(int nsplits, ApplyFnType apply) const = 0;
+
+  /**
+   * \brief Hash the encoding of the region, which identifies it without
+   * communication: nodes that build the same region get the same hash.
+   *
+   * The default hashes the sorted list of nodes; compact encodings override
+   * this to hash the encoding itself without expanding it.
+   *
+   * \return the hash
+   */
+  virtual std::size_t hash();
 };
 
 struct ListHash {
@@ -88,9 +99,19 @@ struct ListHash {
     }
 };
 
+/// Distinct seeds for hashing each encoding so equal bounds in different
+/// encodings do not collide
+static constexpr std::size_t const range_hash_tag = 0x52414e47;
+static constexpr std::size_t const bitmap_hash_tag = 0x4249544d;
+
+inline std::size_t hashCombine(std::size_t seed, std::size_t value) {
+  return seed ^ (value + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+}
+
 struct List;
 struct Range;
 struct ShallowList;
+struct Bitmap;
 
 }}} /* end namespace vt::group::region */
 
@@ -0,0 +1,141 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                             group_sparse_tree.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include "vt/config.h"
+#include "vt/group/sparse/group_sparse_tree.h"
+
+#include <algorithm>
+
+namespace vt { namespace group { namespace sparse {
+
+SparseTree::SparseTree(ListType in_members)
+  : members_(std::move(in_members))
+{
+  std::sort(members_.begin(), members_.end());
+  members_.erase(
+    std::unique(members_.begin(), members_.end()), members_.end()
+  );
+  vtAssert(members_.size() > 0, "A sparse group must have a member");
+}
+
+NodeType SparseTree::getLowest() const {
+  return members_.front();
+}
+
+bool SparseTree::isMember(NodeType node) const {
+  return std::binary_search(members_.begin(), members_.end(), node);
+}
+
+bool SparseTree::matches(region::Region* region) const {
+  if (region->isList()) {
+    // A list may be unsorted or have duplicates: normalize a copy
+    auto list = region->makeList();
+    std::sort(list.begin(), list.end());
+    list.erase(std::unique(list.begin(), list.end()), list.end());
+    return list == members_;
+  }
+
+  // Compact encodings have no duplicates and answer membership directly
+  if (region->getSize() != members_.size()) {
+    return false;
+  }
+  for (auto&& member : members_) {
+    if (not region->contains(member)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+std::size_t SparseTree::indexOf(NodeType node) const {
+  auto iter = std::lower_bound(members_.begin(), members_.end(), node);
+  vtAssert(
+    iter != members_.end() and *iter == node, "Node must be a member"
+  );
+  return static_cast<std::size_t>(iter - members_.begin());
+}
+
+NodeType SparseTree::getParent(NodeType root, NodeType node) const {
+  auto const n = members_.size();
+  auto const r = indexOf(root);
+  auto const rel = (indexOf(node) + n - r) % n;
+  if (rel == 0) {
+    return uninitialized_destination;
+  }
+  return members_[((rel - 1) / sparse_tree_arity + r) % n];
+}
+
+SparseTreeCache::TreePtrType SparseTreeCache::find(std::size_t hash) {
+  auto iter = index_.find(hash);
+  if (iter == index_.end()) {
+    misses_++;
+    return nullptr;
+  }
+  hits_++;
+  lru_.splice(lru_.begin(), lru_, iter->second);
+  return iter->second->second;
+}
+
+void SparseTreeCache::insert(std::size_t hash, TreePtrType tree) {
+  auto iter = index_.find(hash);
+  if (iter != index_.end()) {
+    iter->second->second = std::move(tree);
+    lru_.splice(lru_.begin(), lru_, iter->second);
+    return;
+  }
+
+  if (capacity_ == 0) {
+    return;
+  }
+
+  if (index_.size() >= capacity_) {
+    // Evicting only drops the cache's reference; live groups keep theirs
+    index_.erase(lru_.back().first);
+    lru_.pop_back();
+  }
+
+  lru_.emplace_front(hash, std::move(tree));
+  index_[hash] = lru_.begin();
+}
+
+}}} /* end namespace vt::group::sparse */
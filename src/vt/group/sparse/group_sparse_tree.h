@@ -0,0 +1,194 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                             group_sparse_tree.h
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_GROUP_SPARSE_GROUP_SPARSE_TREE_H
+#define INCLUDED_VT_GROUP_SPARSE_GROUP_SPARSE_TREE_H
+
+#include "vt/config.h"
+#include "vt/group/group_common.h"
+#include "vt/group/region/group_region.h"
+
+#include <list>
+#include <memory>
+#include <unordered_map>
+
+namespace vt { namespace group { namespace sparse {
+
+static constexpr std::size_t const sparse_tree_arity = 4;
+static constexpr std::size_t const default_sparse_tree_cache_size = 256;
+
+/**
+ * \struct SparseTree
+ *
+ * \brief A spanning tree over the members of a sparse group, computed locally
+ * from the sorted member list so every node derives the same tree.
+ *
+ * The tree is a k-ary heap laid out over the member list and rotated so that
+ * any member can be its root: with the root at index \c r, the member at
+ * index \c p has relative position <tt>(p - r) mod n</tt>. Rotating lets the
+ * member that starts a broadcast be the root without an extra hop, and keeps
+ * the tree independent of the node that holds it so it can be shared.
+ */
+struct SparseTree {
+  using ListType = region::Region::ListType;
+
+  /**
+   * \brief Build the tree over a set of members
+   *
+   * \param[in] in_members the members, in any order, possibly with duplicates
+   */
+  explicit SparseTree(ListType in_members);
+
+  std::size_t getSize() const { return members_.size(); }
+  ListType const& getMembers() const { return members_; }
+
+  /**
+   * \brief Get the lowest member, the root when the sender is not a member
+   */
+  NodeType getLowest() const;
+
+  /**
+   * \brief Query whether a node is a member
+   *
+   * \param[in] node the node
+   */
+  bool isMember(NodeType node) const;
+
+  /**
+   * \brief Query whether the tree has exactly the nodes of a region
+   *
+   * Checks a cached tree against the region it is looked up for, since
+   * regions are only identified by their hash.
+   *
+   * \param[in] region the region
+   */
+  bool matches(region::Region* region) const;
+
+  /**
+   * \brief Apply a function to the children of a member
+   *
+   * \param[in] root the member at the root of the tree
+   * \param[in] node the member whose children to visit
+   * \param[in] fn the function to apply to each child
+   */
+  template <typename FnT>
+  void foreachChild(NodeType root, NodeType node, FnT&& fn) const {
+    auto const n = members_.size();
+    auto const r = indexOf(root);
+    auto const rel = (indexOf(node) + n - r) % n;
+    for (std::size_t j = 1; j <= sparse_tree_arity; j++) {
+      auto const child = rel * sparse_tree_arity + j;
+      if (child >= n) {
+        break;
+      }
+      fn(members_[(child + r) % n]);
+    }
+  }
+
+  /**
+   * \brief Get the parent of a member
+   *
+   * \param[in] root the member at the root of the tree
+   * \param[in] node the member
+   *
+   * \return the parent or \c uninitialized_destination for the root
+   */
+  NodeType getParent(NodeType root, NodeType node) const;
+
+private:
+  std::size_t indexOf(NodeType node) const;
+
+private:
+  ListType members_;
+};
+
+/**
+ * \struct SparseTreeCache
+ *
+ * \brief A least-recently-used cache of sparse trees keyed by the hash of the
+ * region they were built from, so re-creating a group over the same region
+ * skips expanding the region and sorting its members.
+ */
+struct SparseTreeCache {
+  using TreePtrType = std::shared_ptr<SparseTree const>;
+
+  explicit SparseTreeCache(
+    std::size_t in_capacity = default_sparse_tree_cache_size
+  ) : capacity_(in_capacity)
+  { }
+
+  /**
+   * \brief Look up a tree and mark it most recently used
+   *
+   * \param[in] hash the region hash
+   *
+   * \return the tree or \c nullptr if it is not cached
+   */
+  TreePtrType find(std::size_t hash);
+
+  /**
+   * \brief Insert a tree, evicting the least recently used one when full
+   *
+   * \param[in] hash the region hash
+   * \param[in] tree the tree
+   */
+  void insert(std::size_t hash, TreePtrType tree);
+
+  std::size_t getSize() const { return index_.size(); }
+  std::size_t getHits() const { return hits_; }
+  std::size_t getMisses() const { return misses_; }
+
+private:
+  using EntryType = std::pair<std::size_t, TreePtrType>;
+  using EntryListType = std::list<EntryType>;
+
+  std::size_t capacity_ = default_sparse_tree_cache_size;
+  EntryListType lru_;
+  std::unordered_map<std::size_t, EntryListType::iterator> index_;
+  std::size_t hits_ = 0;
+  std::size_t misses_ = 0;
+};
+
+}}} /* end namespace vt::group::sparse */
+
+#endif /*INCLUDED_VT_GROUP_SPARSE_GROUP_SPARSE_TREE_H*/
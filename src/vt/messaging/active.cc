@@ -128,14 +128,23 @@ ActiveMessenger::ActiveMessenger()
     "bcasts_sent", "active message broadcasts sent"
   );
 
-  // Number of MPI_Test polls for AM/DM
-  amPollCount = registerCounter("AM_polls", "active message polls");
-  dmPollCount = registerCounter("DM_polls", "data message polls");
+  // Number of MPI test calls for AM/DM; a single MPI_Testsome covers all
+  // pending requests, so against AM_recv/DM_recv these give calls/completion
+  amPollCount = registerCounter("AM_polls", "active message MPI test calls");
+  dmPollCount = registerCounter("DM_polls", "data message MPI test calls");
 
   // Number of termination message sent/received
   tdSentCount = registerCounter("TD_sent", "termination messages sent");
   tdRecvCount = registerCounter("TD_recv", "termination messages recv");
 
+  // Number of active messages sent/received through shared-memory rings
+  amShmSentCount = registerCounter(
+    "AM_shm_sent", "active messages sent through shared memory"
+  );
+  amShmRecvCount = registerCounter(
+    "AM_shm_recv", "active messages received through shared memory"
+  );
+
   // Number of messages that were purely forwarded to another node by this AM
   amForwardCounterGauge = diagnostic::CounterGauge{
     registerCounter("AM_forwarded", "messages forwarded (and not delivered)"),
@@ -151,6 +160,15 @@ void ActiveMessenger::initialize() {
 }
 
 void ActiveMessenger::startup() {
+  if (theConfig()->vt_shm_am) {
+    // Rings are a power of two bytes so positions wrap with a mask
+    std::size_t ring_size = 64;
+    while (ring_size < theConfig()->vt_shm_am_ring_size) {
+      ring_size <<= 1;
+    }
+    shm_transport_ = std::make_unique<ShmTransport>(comm_, ring_size);
+  }
+
   bare_handler_dummy_elm_id_for_lb_data_ =
     elm::ElmIDBits::createBareHandler(this_node_);
 
@@ -164,6 +182,18 @@ void ActiveMessenger::startup() {
 #endif
 }
 
+void ActiveMessenger::finalize() {
+  vtAssert(
+    shm_backlog_.empty(), "Messages must not be held for the shared rings"
+  );
+  vtAssert(
+    pending_rndv_sends_.empty(), "Rendezvous sends must not be pending"
+  );
+
+  // Collective over the node: frees the shared-memory window
+  shm_transport_ = nullptr;
+}
+
 /*virtual*/ ActiveMessenger::~ActiveMessenger() {}
 
 trace::TraceEventIDType ActiveMessenger::makeTraceCreationSend(
@@ -281,26 +311,58 @@ EventType ActiveMessenger::sendMsgBytesWithPut(
 }
 
 struct MultiMsg : vt::Message {
-  MultiMsg(SendInfo in_info, NodeType in_from, MsgSizeType in_size)
-    : info(in_info),
+  MultiMsg(
+    SendInfo in_info, NodeType in_from, MsgSizeType in_size,
+    std::size_t in_chunk_size = 0
+  ) : info(in_info),
       from(in_from),
-      size(in_size)
+      size(in_size),
+      chunk_size(in_chunk_size)
   { }
 
   SendInfo getInfo() const { return info; }
   NodeType getFrom() const { return from; }
   MsgSizeType getSize() const { return size; }
+  std::size_t getChunkSize() const { return chunk_size; }
 
 private:
   SendInfo info;
   NodeType from = uninitialized_destination;
   MsgSizeType size = 0;
+  std::size_t chunk_size = 0; /**< Non-zero when sent pipelined */
+};
+
+struct RendezvousReadyMsg : vt::Message {
+  explicit RendezvousReadyMsg(TagType in_tag) : tag(in_tag) { }
+
+  TagType getTag() const { return tag; }
+
+private:
+  TagType tag = no_tag;
 };
 
 /*static*/ void ActiveMessenger::chunkedMultiMsg(MultiMsg* msg) {
   theMsg()->handleChunkedMultiMsg(msg);
 }
 
+/*static*/ void ActiveMessenger::rendezvousReady(RendezvousReadyMsg* msg) {
+  theMsg()->handleRendezvousReady(msg);
+}
+
+void ActiveMessenger::handleRendezvousReady(RendezvousReadyMsg* msg) {
+  auto const tag = msg->getTag();
+  auto iter = pending_rndv_sends_.find(tag);
+  vtAssert(iter != pending_rndv_sends_.end(), "Rendezvous send must be pending");
+
+  vt_debug_print(
+    normal, active,
+    "handleRendezvousReady: destination ready, sending tag={}\n", tag
+  );
+
+  registerAsyncOp(std::move(iter->second));
+  pending_rndv_sends_.erase(iter);
+}
+
 void ActiveMessenger::handleChunkedMultiMsg(MultiMsg* msg) {
   auto buf = thePool()->alloc(msg->getSize());
 
@@ -309,6 +371,35 @@ void ActiveMessenger::handleChunkedMultiMsg(MultiMsg* msg) {
   auto const sender = msg->getFrom();
   auto const nchunks = info.getNumChunks();
   auto const tag = info.getTag();
+  auto const chunk_size = msg->getChunkSize();
+
+  if (chunk_size != 0) {
+    // Pipelined: at most --vt_rndv_max_inflight chunk receives are posted
+    auto on_done = [buf,sender,size,tag,this]{
+      vt_debug_print(
+        normal, active,
+        "handleChunkedMultiMsg: all chunks streamed tag={}, size={}, from={}\n",
+        tag, size, sender
+      );
+      dmRecvCounterGauge.incrementUpdate(size, 1);
+      theTerm()->consume(term::any_epoch_sentinel,1,sender);
+      theTerm()->hangDetectRecv();
+      InProgressIRecv irecv(buf, size, sender);
+      finishPendingActiveMsgAsyncRecv(&irecv);
+    };
+    registerAsyncOp(
+      std::make_unique<RendezvousRecvOp>(
+        sender, tag, static_cast<std::size_t>(size), chunk_size,
+        theConfig()->vt_rndv_max_inflight, static_cast<std::byte*>(buf),
+        on_done
+      )
+    );
+
+    // The first chunk receives are posted: let the sender start
+    auto ready = makeMessage<RendezvousReadyMsg>(tag);
+    sendMsg<RendezvousReadyMsg, rendezvousReady>(sender, ready);
+    return;
+  }
 
   auto fn = [buf,sender,size,tag,this](PtrLenPairType,ActionType){
     vt_debug_print(
@@ -338,7 +429,15 @@ EventType ActiveMessenger::sendMsgMPI(
   );
 
   auto const max_per_send = theConfig()->vt_max_mpi_send_size;
-  if (static_cast<std::size_t>(msg_size) < max_per_send) {
+  auto const chunk_size = std::min(
+    theConfig()->vt_rndv_chunk_size, max_per_send
+  );
+  auto const len = static_cast<std::size_t>(msg_size);
+  bool const rndv = chunk_size != 0 and (
+    len >= theConfig()->vt_rndv_threshold or len >= max_per_send
+  );
+
+  if (not rndv and len < max_per_send) {
     auto const event_id = theEvent()->createMPIEvent(this_node_);
     auto& holder = theEvent()->getEventHolder(event_id);
     auto mpi_event = holder.get_event();
@@ -377,6 +476,28 @@ EventType ActiveMessenger::sendMsgMPI(
     );
     auto tag = allocateNewTag();
 
+    if (rndv) {
+      // Rendezvous: the control message goes first. The op holds a reference
+      // to the message and is started by the destination's reply once its
+      // chunk receives are posted, so the payload never lands unexpected
+      auto op = std::make_unique<RendezvousSendOp>(
+        dest, tag, len, chunk_size, theConfig()->vt_rndv_max_inflight,
+        reinterpret_cast<std::byte const*>(untyped_msg), [base]{ }
+      );
+      auto const nchunks = static_cast<int>(op->getNumChunks());
+      pending_rndv_sends_.emplace(tag, std::move(op));
+
+      dmSentCounterGauge.incrementUpdate(msg_size, 1);
+      theTerm()->produce(term::any_epoch_sentinel,1,dest);
+      theTerm()->hangDetectSend();
+
+      SendInfo info{no_event, tag, nchunks};
+      auto m = makeMessage<MultiMsg>(info, this_node_, msg_size, chunk_size);
+      sendMsg<MultiMsg, chunkedMultiMsg>(dest, m);
+
+      return no_event;
+    }
+
     // Send the actual data in multiple chunks
     PtrLenPairType tup = std::make_tuple(reinterpret_cast<std::byte*>(untyped_msg), msg_size);
     SendInfo info = sendData(tup, dest, tag);
@@ -394,6 +515,81 @@ EventType ActiveMessenger::sendMsgMPI(
   }
 }
 
+bool ActiveMessenger::trySendMsgShm(
+  NodeType const& dest, MsgSharedPtr<BaseMsgType> const& base,
+  MsgSizeType const& msg_size
+) {
+  auto const len = static_cast<std::size_t>(msg_size);
+  if (shm_transport_ == nullptr) {
+    return false;
+  }
+
+  // The message is copied into the ring, so the send is complete on return.
+  // Once a message to this destination has to wait for room, later ones queue
+  // behind it instead of overtaking it through the ring or MPI, including
+  // those too large for the ring
+  auto iter = shm_backlog_.find(dest);
+  if (iter == shm_backlog_.end()) {
+    if (not shm_transport_->reaches(dest, len)) {
+      return false;
+    }
+    auto const bytes = reinterpret_cast<std::byte const*>(base.get());
+    if (shm_transport_->trySend(dest, bytes, len)) {
+      vt_debug_print(
+        verbose, active,
+        "trySendMsgShm: dest={}, msg_size={}\n", dest, msg_size
+      );
+      amShmSentCount.increment(1);
+      return true;
+    }
+    iter = shm_backlog_.try_emplace(dest).first;
+  }
+
+  vt_debug_print(
+    verbose, active,
+    "trySendMsgShm: ring full, holding: dest={}, msg_size={}, held={}\n",
+    dest, msg_size, iter->second.size()
+  );
+  iter->second.emplace_back(base, msg_size);
+  return true;
+}
+
+bool ActiveMessenger::flushShmBacklog() {
+  bool progress = false;
+  for (auto iter = shm_backlog_.begin(); iter != shm_backlog_.end(); ) {
+    auto const dest = iter->first;
+    auto& held = iter->second;
+    while (not held.empty()) {
+      auto const& msg = std::get<0>(held.front());
+      auto const len = static_cast<std::size_t>(std::get<1>(held.front()));
+      if (shm_transport_->reaches(dest, len)) {
+        auto const bytes = reinterpret_cast<std::byte const*>(msg.get());
+        if (not shm_transport_->trySend(dest, bytes, len)) {
+          break;
+        }
+        amShmSentCount.increment(1);
+        held.pop_front();
+      } else {
+        // Too large for the ring: it only waited to keep its place. Sending
+        // it may hold its control message behind the rest of this backlog
+        auto front = std::move(held.front());
+        held.pop_front();
+        sendMsgMPI(
+          dest, std::get<0>(front), std::get<1>(front),
+          static_cast<TagType>(MPITag::ActiveMsgTag)
+        );
+      }
+      progress = true;
+    }
+    if (held.empty()) {
+      iter = shm_backlog_.erase(iter);
+    } else {
+      ++iter;
+    }
+  }
+  return progress;
+}
+
 EventType ActiveMessenger::sendMsgBytes(
   NodeType const& dest, MsgSharedPtr<BaseMsgType> const& base,
   MsgSizeType const& msg_size, TagType const& send_tag
@@ -425,7 +621,11 @@ EventType ActiveMessenger::sendMsgBytes(
   }
   amSentCounterGauge.incrementUpdate(msg_size, 1);
 
-  EventType const event_id = sendMsgMPI(dest, base, msg_size, send_tag);
+  EventType event_id = no_event;
+  bool const is_am = send_tag == static_cast<TagType>(MPITag::ActiveMsgTag);
+  if (not is_am or not trySendMsgShm(dest, base, msg_size)) {
+    event_id = sendMsgMPI(dest, base, msg_size, send_tag);
+  }
 
   if (not is_term) {
     theTerm()->produce(epoch,1,dest);
@@ -563,6 +763,76 @@ SendInfo ActiveMessenger::sendData(
   return SendInfo{event_id, send_tag, num};
 }
 
+SendInfo ActiveMessenger::sendDataStream(
+  NodeType dest, std::size_t total_bytes, ChunkProducerType producer,
+  TagType tag
+) {
+  vtAbortIf(
+    dest >= theContext()->getNumNodes() || dest < 0,
+    "Invalid destination: {}"
+  );
+
+  auto const send_tag = tag != no_tag ? tag : allocateNewTag();
+  auto const chunk_size = getStreamChunkSize();
+
+  vt_debug_print(
+    terse, active,
+    "sendDataStream: total_bytes={}, dest={}, tag={}, chunk_size={}\n",
+    total_bytes, dest, send_tag, chunk_size
+  );
+
+  auto op = std::make_unique<RendezvousSendOp>(
+    dest, send_tag, total_bytes, chunk_size,
+    theConfig()->vt_rndv_max_inflight, producer
+  );
+  auto const nchunks = static_cast<int>(op->getNumChunks());
+  registerAsyncOp(std::move(op));
+
+  dmSentCounterGauge.incrementUpdate(total_bytes, 1);
+
+  // Paired with the consume when the receiver has all chunks, as in sendData
+  theTerm()->produce(term::any_epoch_sentinel,1,dest);
+  theTerm()->hangDetectSend();
+
+  return SendInfo{no_event, send_tag, nchunks};
+}
+
+void ActiveMessenger::recvDataStream(
+  TagType tag, NodeType from, std::size_t total_bytes,
+  ChunkConsumerType consumer, ActionType on_done
+) {
+  auto const chunk_size = getStreamChunkSize();
+
+  vt_debug_print(
+    terse, active,
+    "recvDataStream: total_bytes={}, from={}, tag={}, chunk_size={}\n",
+    total_bytes, from, tag, chunk_size
+  );
+
+  auto fn = [this,from,total_bytes,on_done]{
+    dmRecvCounterGauge.incrementUpdate(total_bytes, 1);
+    theTerm()->consume(term::any_epoch_sentinel,1,from);
+    theTerm()->hangDetectRecv();
+    if (on_done) {
+      on_done();
+    }
+  };
+
+  registerAsyncOp(
+    std::make_unique<RendezvousRecvOp>(
+      from, tag, total_bytes, chunk_size, theConfig()->vt_rndv_max_inflight,
+      consumer, fn
+    )
+  );
+}
+
+std::size_t ActiveMessenger::getStreamChunkSize() const {
+  // Streams are always chunked; each chunk must fit in one MPI send
+  auto const max_per_send = theConfig()->vt_max_mpi_send_size;
+  auto const chunk_size = theConfig()->vt_rndv_chunk_size;
+  return chunk_size == 0 ? max_per_send : std::min(chunk_size, max_per_send);
+}
+
 std::tuple<EventType, int> ActiveMessenger::sendDataMPI(
   PtrLenPairType const& payload, NodeType const& dest, TagType const& tag
 ) {
@@ -1144,6 +1414,28 @@ bool ActiveMessenger::testPendingDataMsgAsyncRecv() {
   return ret;
 }
 
+bool ActiveMessenger::testShmRecv() {
+  if (shm_transport_ == nullptr) {
+    return false;
+  }
+
+  // Bound the messages taken per call so MPI is still polled under heavy
+  // intra-node traffic
+  static constexpr int const shm_poll_budget = 64;
+
+  int const received = shm_transport_->poll(
+    [](std::size_t len) { return thePool()->alloc(len); },
+    [this](NodeType sender, std::byte* buf, std::size_t len) {
+      InProgressIRecv recv_holder{buf, static_cast<MsgSizeType>(len), sender};
+      finishPendingActiveMsgAsyncRecv(&recv_holder);
+    },
+    shm_poll_budget
+  );
+
+  amShmRecvCount.increment(received);
+  return received > 0;
+}
+
 bool ActiveMessenger::testPendingAsyncOps() {
   int num_tests = 0;
   return in_progress_ops.testAll(
@@ -1155,13 +1447,16 @@ bool ActiveMessenger::testPendingAsyncOps() {
 }
 
 int ActiveMessenger::progress([[maybe_unused]] TimeType current_time) {
+  bool const flushed_shm_msg = flushShmBacklog();
+  bool const received_shm_msg = testShmRecv();
   bool const started_irecv_active_msg = tryProcessIncomingActiveMsg();
   bool const started_irecv_data_msg = tryProcessDataMsgRecv();
   bool const received_active_msg = testPendingActiveMsgAsyncRecv();
   bool const received_data_msg = testPendingDataMsgAsyncRecv();
   bool const general_async = testPendingAsyncOps();
 
-  return started_irecv_active_msg or started_irecv_data_msg or
+  return flushed_shm_msg or received_shm_msg or
+         started_irecv_active_msg or started_irecv_data_msg or
          received_active_msg or received_data_msg or general_async;
 }
 
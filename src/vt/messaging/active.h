@@ -45,6 +45,7 @@
 #define INCLUDED_VT_MESSAGING_ACTIVE_H
 
 #include <cstdint>
+#include <deque>
 #include <memory>
 #include <mpi.h>
 
@@ -56,6 +57,8 @@
 #include "vt/messaging/request_holder.h"
 #include "vt/messaging/send_info.h"
 #include "vt/messaging/async_op_wrapper.h"
+#include "vt/messaging/shm_transport.h"
+#include "vt/messaging/rendezvous.h"
 #include "vt/messaging/param_msg.h"
 #include "vt/event/event.h"
 #include "vt/registry/auto/auto_registry_interface.h"
@@ -77,6 +80,7 @@
 #include <unordered_map>
 #include <limits>
 #include <stack>
+#include <utility>
 
 namespace vt {
 
@@ -196,6 +200,15 @@ struct InProgressIRecv : InProgressBase {
     return flag;
   }
 
+  /**
+   * \brief Hand the request over to a \c RequestHolder to test it
+   *
+   * \return the request or \c MPI_REQUEST_NULL if there is none left
+   */
+  MPI_Request takeRequest() {
+    return std::exchange(req, MPI_REQUEST_NULL);
+  }
+
 private:
   MPI_Request req = MPI_REQUEST_NULL;
 };
@@ -234,6 +247,19 @@ struct InProgressDataIRecv : InProgressBase {
     return true;
   }
 
+  /**
+   * \brief Hand the next incomplete request over to a \c RequestHolder to
+   * test it; the holder asks for another each time one completes
+   *
+   * \return the request or \c MPI_REQUEST_NULL if there is none left
+   */
+  MPI_Request takeRequest() {
+    if (cur < reqs.size()) {
+      return std::exchange(reqs[cur++], MPI_REQUEST_NULL);
+    }
+    return MPI_REQUEST_NULL;
+  }
+
   template <typename Serializer>
   void serialize(Serializer& s) {
     s | user_buf
@@ -282,6 +308,7 @@ struct BufferedActiveMsg {
 
 // forward-declare for header
 struct MultiMsg;
+struct RendezvousReadyMsg;
 
 /**
  * \struct ActiveMessenger active.h vt/messaging/active.h
@@ -345,6 +372,7 @@ struct ActiveMessenger : runtime::component::PollableComponent<ActiveMessenger>
 
   void startup() override;
   void initialize() override;
+  void finalize() override;
 
   /**
    * \brief Mark a message as a termination message.
@@ -1266,6 +1294,45 @@ struct ActiveMessenger : runtime::component::PollableComponent<ActiveMessenger>
     PtrLenPairType const& ptr, NodeType const& dest, TagType const& tag
   );
 
+  /**
+   * \brief Stream a large payload to a node in pipelined chunks
+   *
+   * The payload is sent in chunks of \c --vt_rndv_chunk_size bytes with at
+   * most \c --vt_rndv_max_inflight outstanding. Each chunk is filled by the
+   * producer right before it is sent, so the payload never has to be in
+   * memory as a whole. The receiver must call \c recvDataStream with the
+   * returned tag (e.g., sent to it in a message) and the same total size.
+   *
+   * \param[in] dest the destination node
+   * \param[in] total_bytes the size of the payload
+   * \param[in] producer fills the chunk at an offset into a buffer
+   * \param[in] tag the MPI tag to use (if vt::no_tag, allocates a tag)
+   *
+   * \return information about the send for receiving the payload
+   */
+  SendInfo sendDataStream(
+    NodeType dest, std::size_t total_bytes, ChunkProducerType producer,
+    TagType tag = no_tag
+  );
+
+  /**
+   * \brief Receive a payload streamed with \c sendDataStream, processing each
+   * chunk as it lands
+   *
+   * At most \c --vt_rndv_max_inflight chunks are buffered at once. Chunks may
+   * be consumed out of order; each comes with its offset in the payload.
+   *
+   * \param[in] tag the tag returned by \c sendDataStream
+   * \param[in] from the sending node
+   * \param[in] total_bytes the size of the payload
+   * \param[in] consumer called with each chunk's offset, data and length
+   * \param[in] on_done called once all chunks were consumed
+   */
+  void recvDataStream(
+    TagType tag, NodeType from, std::size_t total_bytes,
+    ChunkConsumerType consumer, ActionType on_done = nullptr
+  );
+
   /**
    * \internal
    * \brief Receive data as bytes from a node with a priority
@@ -1477,7 +1544,10 @@ struct ActiveMessenger : runtime::component::PollableComponent<ActiveMessenger>
    * \param[in] msg_size the size of the message
    * \param[in] send_tag the send tag on the message
    *
-   * \return the event to test/wait for completion
+   * \return the event to test/wait for completion, or \c no_event when the
+   * message went to the intra-node shared-memory transport: it is copied into
+   * the destination's ring, or held by the runtime until it fits, so there is
+   * nothing for the caller to wait on
    */
   EventType sendMsgBytes(
     NodeType const& dest, MsgSharedPtr<BaseMsgType> const& base,
@@ -1632,6 +1702,8 @@ struct ActiveMessenger : runtime::component::PollableComponent<ActiveMessenger>
       | amForwardCounterGauge
       | amHandlerCount
       | amPollCount
+      | amShmSentCount
+      | amShmRecvCount
       | amPostedCounterGauge
       | amRecvCounterGauge
       | amSentCounterGauge
@@ -1663,6 +1735,12 @@ private:
    */
   MPI_TagType allocateNewTag();
 
+  /**
+   * \internal \brief The chunk size for streamed payloads: the rendezvous
+   * chunk size capped by the maximum MPI send size
+   */
+  std::size_t getStreamChunkSize() const;
+
   /**
    * \internal \brief Handle a control message that coordinates multiple
    * payloads arriving that constitute a contiguous payload
@@ -1679,6 +1757,22 @@ private:
    */
   static void chunkedMultiMsg(MultiMsg* msg);
 
+  /**
+   * \internal \brief Handle the destination's reply to a rendezvous control
+   * message: its receives are posted, so start sending the payload
+   *
+   * \param[in] msg the message with the rendezvous tag
+   */
+  void handleRendezvousReady(RendezvousReadyMsg* msg);
+
+  /**
+   * \internal \brief Handle a rendezvous reply; immediately calls
+   * \c handleRendezvousReady
+   *
+   * \param[in] msg the message with the rendezvous tag
+   */
+  static void rendezvousReady(RendezvousReadyMsg* msg);
+
   /**
    * \brief Test pending MPI request for active message receives
    *
@@ -1693,6 +1787,45 @@ private:
    */
   bool testPendingDataMsgAsyncRecv();
 
+  /**
+   * \brief Try to send an active message through the intra-node shared-memory
+   * transport
+   *
+   * If the destination's ring is full, or earlier messages to it are still
+   * waiting for room, the message is held in a per-destination backlog and
+   * copied in order by \c flushShmBacklog. A message too large for the ring
+   * is also held while the backlog to its rank is not empty, and is sent
+   * through MPI when it reaches the front, so it does not overtake the held
+   * messages.
+   *
+   * \param[in] dest the destination of the message
+   * \param[in] base the message base pointer
+   * \param[in] msg_size the size of the message being sent
+   *
+   * \return whether the transport took or held it; otherwise, it must be sent
+   * with MPI
+   */
+  bool trySendMsgShm(
+    NodeType const& dest, MsgSharedPtr<BaseMsgType> const& base,
+    MsgSizeType const& msg_size
+  );
+
+  /**
+   * \brief Copy held messages into the shared-memory rings, in order per
+   * destination, as the rings gain room; held messages too large for a ring
+   * are sent through MPI in their turn
+   *
+   * \return whether progress was made
+   */
+  bool flushShmBacklog();
+
+  /**
+   * \brief Receive active messages from the intra-node shared-memory transport
+   *
+   * \return whether progress was made
+   */
+  bool testShmRecv();
+
   /**
    * \brief Test pending general asynchronous events
    *
@@ -1772,6 +1905,10 @@ private:
   diagnostic::Counter tdSentCount;
   diagnostic::Counter tdRecvCount;
 
+  // Diagnostic counters for messages through the shared-memory transport
+  diagnostic::Counter amShmSentCount;
+  diagnostic::Counter amShmRecvCount;
+
   // Diagnostic counters for counting forwarded messages
   diagnostic::CounterGauge amForwardCounterGauge;
 
@@ -1779,6 +1916,14 @@ private:
   elm::ElementIDStruct bare_handler_dummy_elm_id_for_lb_data_ = {};
   elm::ElementLBData bare_handler_lb_data_;
   MPI_Comm comm_ = MPI_COMM_NULL;
+  /// Intra-node transport for small messages, when enabled (--vt_shm_am)
+  std::unique_ptr<ShmTransport> shm_transport_ = nullptr;
+  /// Messages waiting for room in a destination's ring, in send order
+  std::unordered_map<
+    NodeType, std::deque<std::tuple<MsgSharedPtr<BaseMsgType>, MsgSizeType>>
+  > shm_backlog_;
+  /// Rendezvous sends waiting for the destination to post its receives
+  std::unordered_map<TagType, std::unique_ptr<AsyncOp>> pending_rndv_sends_;
 };
 
 }} // end namespace vt::messaging
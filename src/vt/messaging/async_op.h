@@ -80,6 +80,18 @@ struct AsyncOp {
    */
   virtual void done() = 0;
 
+  /**
+   * \brief Override for an operation that completes with a single
+   * \c MPI_Request, so it is tested along with all other requests in one
+   * \c MPI_Testsome instead of being polled
+   *
+   * The request is owned by the caller afterwards and \c poll is no longer
+   * called; \c done is triggered when the request completes.
+   *
+   * \return the request or \c MPI_REQUEST_NULL to be polled
+   */
+  virtual MPI_Request takeRequest() { return MPI_REQUEST_NULL; }
+
   /**
    * \brief Serialize for footprinting
    *
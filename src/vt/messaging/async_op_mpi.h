@@ -46,6 +46,8 @@
 
 #include "vt/messaging/async_op.h"
 
+#include <utility>
+
 namespace vt { namespace messaging {
 
 /**
@@ -79,6 +81,16 @@ struct AsyncOpMPI : AsyncOp {
     return flag;
   }
 
+  /**
+   * \brief Hand the \c MPI_Request over to be tested with all other
+   * outstanding requests
+   *
+   * \return the request
+   */
+  MPI_Request takeRequest() override {
+    return std::exchange(req_, MPI_REQUEST_NULL);
+  }
+
   /**
    * \brief Cont continuation after completion
    */
@@ -91,6 +91,14 @@ struct AsyncOpWrapper {
    */
   bool test(int& num_tests);
 
+  /**
+   * \internal \brief Hand the operation's MPI request over to be tested by
+   * the holder instead of polling the operation
+   *
+   * \return the request or \c MPI_REQUEST_NULL if it must be polled
+   */
+  MPI_Request takeRequest() { return op_->takeRequest(); }
+
   /**
    * \internal \brief Trigger continuation after operation completes
    */
@@ -0,0 +1,210 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                rendezvous.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include "vt/config.h"
+#include "vt/messaging/rendezvous.h"
+#include "vt/messaging/active.h"
+#include "vt/runtime/mpi_access.h"
+
+namespace vt { namespace messaging {
+
+RendezvousChunks::RendezvousChunks(
+  NodeType in_peer, TagType in_tag, std::size_t in_total,
+  std::size_t in_chunk_size, int in_max_inflight
+) : peer_(in_peer),
+    tag_(in_tag),
+    total_(in_total),
+    chunk_size_(in_chunk_size == 0 ? std::max(in_total, std::size_t{1}) : in_chunk_size)
+{
+  num_chunks_ = (total_ + chunk_size_ - 1) / chunk_size_;
+  auto const num_slots = std::min(
+    static_cast<std::size_t>(std::max(in_max_inflight, 1)), num_chunks_
+  );
+  slots_.resize(num_slots);
+}
+
+template <typename CompleteT, typename PostT>
+bool RendezvousChunks::advance(CompleteT&& complete, PostT&& post) {
+  for (auto&& slot : slots_) {
+    if (slot.active) {
+      int flag = 0;
+      {
+        VT_ALLOW_MPI_CALLS; // MPI_Test
+        MPI_Test(&slot.req, &flag, MPI_STATUS_IGNORE);
+      }
+      if (flag) {
+        slot.active = false;
+        num_done_++;
+        complete(slot);
+      }
+    }
+    if (not slot.active and next_chunk_ < num_chunks_) {
+      slot.chunk = next_chunk_++;
+      slot.active = true;
+      post(slot);
+    }
+  }
+  return num_done_ == num_chunks_;
+}
+
+RendezvousSendOp::RendezvousSendOp(
+  NodeType in_dest, TagType in_tag, std::size_t in_total,
+  std::size_t in_chunk_size, int in_max_inflight,
+  std::byte const* in_buf, ActionType in_release
+) : RendezvousChunks(in_dest, in_tag, in_total, in_chunk_size, in_max_inflight),
+    buf_(in_buf),
+    release_(in_release)
+{ }
+
+RendezvousSendOp::RendezvousSendOp(
+  NodeType in_dest, TagType in_tag, std::size_t in_total,
+  std::size_t in_chunk_size, int in_max_inflight,
+  ChunkProducerType in_producer
+) : RendezvousChunks(in_dest, in_tag, in_total, in_chunk_size, in_max_inflight),
+    producer_(in_producer)
+{
+  for (auto&& slot : slots_) {
+    slot.staging.resize(chunk_size_);
+  }
+}
+
+void RendezvousSendOp::post(Slot& slot) {
+  auto const offset = chunkOffset(slot.chunk);
+  auto const len = chunkLength(slot.chunk);
+
+  std::byte const* data = nullptr;
+  if (producer_) {
+    producer_(offset, slot.staging.data(), len);
+    data = slot.staging.data();
+  } else {
+    data = buf_ + offset;
+  }
+
+  vt_debug_print(
+    verbose, active,
+    "RendezvousSendOp: dest={}, tag={}, chunk={}/{}, len={}\n",
+    peer_, tag_, slot.chunk, num_chunks_, len
+  );
+
+  VT_ALLOW_MPI_CALLS;
+  int const ret = MPI_Isend(
+    data, static_cast<int>(len), MPI_BYTE, peer_, tag_,
+    theContext()->getComm(), &slot.req
+  );
+  vtAssertMPISuccess(ret, "MPI_Isend");
+}
+
+bool RendezvousSendOp::poll() {
+  return advance([](Slot&) { }, [this](Slot& slot) { post(slot); });
+}
+
+void RendezvousSendOp::done() {
+  if (release_) {
+    release_();
+  }
+}
+
+RendezvousRecvOp::RendezvousRecvOp(
+  NodeType in_from, TagType in_tag, std::size_t in_total,
+  std::size_t in_chunk_size, int in_max_inflight,
+  std::byte* in_buf, ActionType in_on_done
+) : RendezvousChunks(in_from, in_tag, in_total, in_chunk_size, in_max_inflight),
+    buf_(in_buf),
+    on_done_(in_on_done)
+{
+  poll();
+}
+
+RendezvousRecvOp::RendezvousRecvOp(
+  NodeType in_from, TagType in_tag, std::size_t in_total,
+  std::size_t in_chunk_size, int in_max_inflight,
+  ChunkConsumerType in_consumer, ActionType in_on_done
+) : RendezvousChunks(in_from, in_tag, in_total, in_chunk_size, in_max_inflight),
+    consumer_(in_consumer),
+    on_done_(in_on_done)
+{
+  for (auto&& slot : slots_) {
+    slot.staging.resize(chunk_size_);
+  }
+  poll();
+}
+
+void RendezvousRecvOp::post(Slot& slot) {
+  auto const offset = chunkOffset(slot.chunk);
+  auto const len = chunkLength(slot.chunk);
+  std::byte* data = consumer_ ? slot.staging.data() : buf_ + offset;
+
+  VT_ALLOW_MPI_CALLS;
+  int const ret = MPI_Irecv(
+    data, static_cast<int>(len), MPI_BYTE, peer_, tag_,
+    theContext()->getComm(), &slot.req
+  );
+  vtAssertMPISuccess(ret, "MPI_Irecv");
+}
+
+bool RendezvousRecvOp::poll() {
+  return advance(
+    [this](Slot& slot) {
+      vt_debug_print(
+        verbose, active,
+        "RendezvousRecvOp: from={}, tag={}, chunk={}/{} arrived\n",
+        peer_, tag_, slot.chunk, num_chunks_
+      );
+      if (consumer_) {
+        // The staging buffer is reposted right after, so consume it now
+        consumer_(
+          chunkOffset(slot.chunk), slot.staging.data(), chunkLength(slot.chunk)
+        );
+      }
+    },
+    [this](Slot& slot) { post(slot); }
+  );
+}
+
+void RendezvousRecvOp::done() {
+  if (on_done_) {
+    on_done_();
+  }
+}
+
+}} /* end namespace vt::messaging */
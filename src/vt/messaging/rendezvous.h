@@ -0,0 +1,196 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                 rendezvous.h
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_MESSAGING_RENDEZVOUS_H
+#define INCLUDED_VT_MESSAGING_RENDEZVOUS_H
+
+#include "vt/config.h"
+#include "vt/messaging/async_op.h"
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+namespace vt { namespace messaging {
+
+/// Fill the chunk of a streamed payload at an offset: (offset, buffer, length)
+using ChunkProducerType = std::function<void(std::size_t, std::byte*, std::size_t)>;
+
+/// Consume a chunk of a streamed payload that landed: (offset, data, length)
+using ChunkConsumerType =
+  std::function<void(std::size_t, std::byte const*, std::size_t)>;
+
+/**
+ * \struct RendezvousChunks
+ *
+ * \brief The chunks of a pipelined payload and the slots they are moved
+ * through; shared by the send and receive sides.
+ *
+ * At most \c max_inflight chunks are posted at once. When a slot's request
+ * completes, the slot is reposted for the next chunk, so chunks move in
+ * order while the number of outstanding MPI requests (and, when staging, the
+ * memory for them) stays bounded. Because matching is in posting order for a
+ * (rank, tag) pair, chunk \c i on the sender always matches chunk \c i on the
+ * receiver.
+ */
+struct RendezvousChunks {
+  RendezvousChunks(
+    NodeType in_peer, TagType in_tag, std::size_t in_total,
+    std::size_t in_chunk_size, int in_max_inflight
+  );
+
+  std::size_t getNumChunks() const { return num_chunks_; }
+
+  std::size_t chunkOffset(std::size_t chunk) const {
+    return chunk * chunk_size_;
+  }
+
+  std::size_t chunkLength(std::size_t chunk) const {
+    return std::min(chunk_size_, total_ - chunkOffset(chunk));
+  }
+
+protected:
+  struct Slot {
+    MPI_Request req = MPI_REQUEST_NULL;
+    std::size_t chunk = 0;
+    bool active = false;
+    std::vector<std::byte> staging;
+  };
+
+  /**
+   * \internal \brief Test the active slots, then repost free ones
+   *
+   * \param[in] complete called with each slot whose chunk completed
+   * \param[in] post called to post the next chunk on a free slot
+   *
+   * \return whether all chunks completed
+   */
+  template <typename CompleteT, typename PostT>
+  bool advance(CompleteT&& complete, PostT&& post);
+
+protected:
+  NodeType peer_ = uninitialized_destination;
+  TagType tag_ = no_tag;
+  std::size_t total_ = 0;
+  std::size_t chunk_size_ = 0;
+  std::size_t num_chunks_ = 0;
+  std::size_t next_chunk_ = 0;
+  std::size_t num_done_ = 0;
+  std::vector<Slot> slots_;
+};
+
+/**
+ * \struct RendezvousSendOp
+ *
+ * \brief Pipelined send of a large payload in bounded in-flight chunks.
+ *
+ * The payload is either a contiguous buffer that is sent from directly and
+ * released when the last chunk is sent, or a producer that fills each chunk
+ * into a staging slot just before it is sent, so the sender never needs the
+ * whole payload in memory. Nothing is posted until the op is first polled,
+ * so a rendezvous holds it back until the destination has posted its
+ * receives.
+ */
+struct RendezvousSendOp : AsyncOp, RendezvousChunks {
+  RendezvousSendOp(
+    NodeType in_dest, TagType in_tag, std::size_t in_total,
+    std::size_t in_chunk_size, int in_max_inflight,
+    std::byte const* in_buf, ActionType in_release
+  );
+
+  RendezvousSendOp(
+    NodeType in_dest, TagType in_tag, std::size_t in_total,
+    std::size_t in_chunk_size, int in_max_inflight,
+    ChunkProducerType in_producer
+  );
+
+  bool poll() override;
+  void done() override;
+
+private:
+  void post(Slot& slot);
+
+private:
+  std::byte const* buf_ = nullptr;
+  ActionType release_ = nullptr;
+  ChunkProducerType producer_ = nullptr;
+};
+
+/**
+ * \struct RendezvousRecvOp
+ *
+ * \brief Pipelined receive of a large payload in bounded in-flight chunks.
+ *
+ * The payload is either received directly into a contiguous buffer, with
+ * \c on_done triggered when all of it arrived, or streamed through staging
+ * slots to a consumer that processes each chunk as it lands (chunks may be
+ * consumed out of order; each comes with its offset).
+ */
+struct RendezvousRecvOp : AsyncOp, RendezvousChunks {
+  RendezvousRecvOp(
+    NodeType in_from, TagType in_tag, std::size_t in_total,
+    std::size_t in_chunk_size, int in_max_inflight,
+    std::byte* in_buf, ActionType in_on_done
+  );
+
+  RendezvousRecvOp(
+    NodeType in_from, TagType in_tag, std::size_t in_total,
+    std::size_t in_chunk_size, int in_max_inflight,
+    ChunkConsumerType in_consumer, ActionType in_on_done
+  );
+
+  bool poll() override;
+  void done() override;
+
+private:
+  void post(Slot& slot);
+
+private:
+  std::byte* buf_ = nullptr;
+  ChunkConsumerType consumer_ = nullptr;
+  ActionType on_done_ = nullptr;
+};
+
+}} /* end namespace vt::messaging */
+
+#endif /*INCLUDED_VT_MESSAGING_RENDEZVOUS_H*/
@@ -64,6 +64,14 @@ namespace vt { namespace messaging {
  * \struct RequestHolder
  *
  * \brief Holds a set of pending MPI Irecvs to poll for completion
+ *
+ * Elements hand their outstanding \c MPI_Request to the holder with
+ * \c takeRequest when inserted. The requests are kept in one contiguous array,
+ * parallel to the elements, so a single \c MPI_Testsome tests all of them per
+ * call. An element that has more requests hands over the next one when its
+ * current one completes. Elements without a request (e.g., a general
+ * \c AsyncOp) are polled with their \c test method instead, at most
+ * \c --vt_async_op_poll_budget of them per call, round-robin.
  */
 template <typename T>
 struct RequestHolder {
@@ -84,6 +92,15 @@ struct RequestHolder {
   template <typename U>
   void emplace(U&& u) {
     holder_.emplace_back(std::forward<U>(u));
+    auto const req = holder_.back().takeRequest();
+    bool const polled = req == MPI_REQUEST_NULL;
+    reqs_.push_back(req);
+    state_.push_back(State{polled, false});
+    if (polled) {
+      num_polled_++;
+    } else {
+      num_waiting_++;
+    }
   }
 
   /**
@@ -104,28 +121,35 @@ struct RequestHolder {
     }
 #   endif
 
-    bool progress_made = false;
+    testRequests(num_mpi_tests);
+    pollElements(num_mpi_tests);
 
-    for (std::size_t i = 0; i < holder_.size(); ) {
-      auto& e = holder_[i];
-      vtAssert(e.valid, "Must be valid");
+    bool progress_made = false;
 
-      auto done = e.test(num_mpi_tests);
+    auto const budget = theConfig()->vt_poll_completion_budget;
+    int delivered = 0;
 
-      if (not done) {
+    for (std::size_t i = 0; i < holder_.size() and num_done_ > 0; ) {
+      if (not state_[i].done) {
         ++i;
         continue;
       }
 
+      // Completed elements beyond the budget are delivered on later calls
+      if (budget > 0 and delivered >= budget) {
+        break;
+      }
+
+      // Move the element out first: the callable may insert new elements
+      T e = std::move(holder_[i]);
+      vtAssert(e.valid, "Must be valid");
+      removeAt(i);
+      num_done_--;
+
       c(&e);
       progress_made = true;
+      delivered++;
       e.valid = false;
-
-      if (i < holder_.size() - 1) {
-        holder_[i] = std::move(holder_.back());
-      }
-
-      holder_.pop_back();
     }
 
 #   if vt_check_enabled(trace_enabled)
@@ -147,14 +171,132 @@ struct RequestHolder {
 
   template <typename Serializer>
   void serialize(Serializer& s) {
-    s | holder_;
+    s | holder_
+      | state_
+      | num_waiting_
+      | num_polled_
+      | num_done_
+      | poll_cursor_;
   # if vt_check_enabled(trace_enabled)
     s | trace_user_event_;
   # endif
   }
 
 private:
+  /**
+   * \internal \brief Test all outstanding requests with one \c MPI_Testsome
+   *
+   * \param[out] num_mpi_tests number of MPI tests performed
+   */
+  void testRequests(int& num_mpi_tests) {
+    if (num_waiting_ == 0) {
+      return;
+    }
+
+    int outcount = 0;
+    indices_.resize(reqs_.size());
+    {
+      VT_ALLOW_MPI_CALLS; // MPI_Testsome
+      MPI_Testsome(
+        static_cast<int>(reqs_.size()), reqs_.data(), &outcount,
+        indices_.data(), MPI_STATUSES_IGNORE
+      );
+    }
+    num_mpi_tests++;
+
+    if (outcount == MPI_UNDEFINED) {
+      return;
+    }
+
+    for (int k = 0; k < outcount; k++) {
+      auto const i = static_cast<std::size_t>(indices_[k]);
+      reqs_[i] = holder_[i].takeRequest();
+      if (reqs_[i] == MPI_REQUEST_NULL) {
+        state_[i].done = true;
+        num_waiting_--;
+        num_done_++;
+      }
+    }
+  }
+
+  /**
+   * \internal \brief Poll elements that have no request, up to the budget
+   *
+   * \param[out] num_mpi_tests number of tests performed
+   */
+  void pollElements(int& num_mpi_tests) {
+    auto const n = holder_.size();
+    if (num_polled_ == 0 or n == 0) {
+      return;
+    }
+
+    auto const budget = theConfig()->vt_async_op_poll_budget;
+    int tested = 0;
+    std::size_t k = 0;
+    for ( ; k < n; k++) {
+      if (budget > 0 and tested >= budget) {
+        break;
+      }
+
+      auto const i = (poll_cursor_ + k) % n;
+      auto& st = state_[i];
+      if (not st.polled or st.done) {
+        continue;
+      }
+
+      tested++;
+      if (holder_[i].test(num_mpi_tests)) {
+        st.done = true;
+        num_polled_--;
+        num_done_++;
+      }
+    }
+
+    // Resume after the last element examined so all get their turn
+    poll_cursor_ = (poll_cursor_ + k) % n;
+  }
+
+  /**
+   * \internal \brief Remove an element by moving the last one into its place
+   *
+   * \param[in] i the index of the element
+   */
+  void removeAt(std::size_t i) {
+    auto const last = holder_.size() - 1;
+    if (i < last) {
+      holder_[i] = std::move(holder_[last]);
+      reqs_[i] = reqs_[last];
+      state_[i] = state_[last];
+    }
+    holder_.pop_back();
+    reqs_.pop_back();
+    state_.pop_back();
+  }
+
+private:
+  /**
+   * \internal \struct State
+   *
+   * \brief The completion state of an element, parallel to the elements
+   */
+  struct State {
+    bool polled = false; /**< Whether it is polled instead of MPI tested */
+    bool done = false;   /**< Whether it completed and awaits delivery */
+
+    template <typename Serializer>
+    void serialize(Serializer& s) {
+      s | polled | done;
+    }
+  };
+
   std::vector<T> holder_;
+  std::vector<MPI_Request> reqs_;   /**< Current request of each element */
+  std::vector<State> state_;
+  std::vector<int> indices_;        /**< Scratch for \c MPI_Testsome */
+  std::size_t num_waiting_ = 0;     /**< Elements with a pending request */
+  std::size_t num_polled_ = 0;      /**< Polled elements not yet complete */
+  std::size_t num_done_ = 0;        /**< Completed, not yet delivered */
+  std::size_t poll_cursor_ = 0;
 
 # if vt_check_enabled(trace_enabled)
   trace::UserEventIDType trace_user_event_ = trace::no_user_event_id;
@@ -0,0 +1,221 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                  shm_ring.h
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_MESSAGING_SHM_RING_H
+#define INCLUDED_VT_MESSAGING_SHM_RING_H
+
+#include "vt/config.h"
+
+#include <atomic>
+#include <cstring>
+
+namespace vt { namespace messaging {
+
+/**
+ * \struct ShmRing
+ *
+ * \brief A single-producer/single-consumer ring of variable-length records
+ * placed in memory shared between two processes.
+ *
+ * The ring is a header followed by \c capacity bytes of data. The producer and
+ * consumer positions are monotonically increasing byte counts kept on separate
+ * cache lines; each record is an 8-byte length followed by its bytes, padded
+ * to 8 bytes. A record that does not fit before the end of the data is
+ * preceded by a wrap marker and written at the start.
+ *
+ * The ring is constructed in place by the consumer, which owns the memory, and
+ * is only accessed by pointer afterwards.
+ */
+struct ShmRing {
+  static constexpr std::size_t const cache_line = 64;
+  static constexpr uint64_t const wrap_marker = ~uint64_t{0};
+
+  /**
+   * \brief Initialize the ring in place
+   *
+   * \param[in] in_capacity the number of data bytes, a power of two
+   */
+  explicit ShmRing(std::size_t in_capacity)
+    : capacity_(in_capacity)
+  {
+    static_assert(
+      std::atomic<uint64_t>::is_always_lock_free,
+      "Shared-memory rings require lock-free 64-bit atomics"
+    );
+    vtAssert(
+      (capacity_ & (capacity_ - 1)) == 0 and capacity_ >= cache_line,
+      "Ring capacity must be a power of two"
+    );
+  }
+
+  ShmRing(ShmRing const&) = delete;
+  ShmRing& operator=(ShmRing const&) = delete;
+
+  /**
+   * \brief The bytes of shared memory needed for a ring
+   *
+   * \param[in] capacity the number of data bytes
+   */
+  static constexpr std::size_t footprint(std::size_t capacity) {
+    return sizeof(ShmRing) + capacity;
+  }
+
+  /**
+   * \brief The largest record that always fits in an empty ring
+   *
+   * \param[in] capacity the number of data bytes
+   */
+  static constexpr std::size_t maxRecord(std::size_t capacity) {
+    return capacity / 2 - sizeof(uint64_t);
+  }
+
+  std::size_t maxRecord() const { return maxRecord(capacity_); }
+
+  /**
+   * \brief Append a record; called only by the producer
+   *
+   * \param[in] data the bytes
+   * \param[in] len the number of bytes
+   *
+   * \return whether there was space for it
+   */
+  bool tryPush(std::byte const* data, std::size_t len) {
+    if (len > maxRecord()) {
+      return false;
+    }
+
+    auto const rec = recordSize(len);
+    auto tail = tail_.load(std::memory_order_relaxed);
+    auto const head = head_.load(std::memory_order_acquire);
+    auto pos = tail & (capacity_ - 1);
+    auto const contiguous = capacity_ - pos;
+    auto const need = rec > contiguous ? contiguous + rec : rec;
+
+    if (tail + need - head > capacity_) {
+      return false;
+    }
+
+    if (rec > contiguous) {
+      storeLength(pos, wrap_marker);
+      tail += contiguous;
+      pos = 0;
+    }
+
+    storeLength(pos, static_cast<uint64_t>(len));
+    std::memcpy(dataAt(pos + sizeof(uint64_t)), data, len);
+
+    tail_.store(tail + rec, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * \brief Remove the oldest record; called only by the consumer
+   *
+   * The record is copied out and consumed before returning, so the caller may
+   * re-enter the ring (e.g., from a handler) while processing it.
+   *
+   * \param[in] alloc called with the record length, returns where to copy it
+   * \param[out] len the record length
+   *
+   * \return the buffer from \c alloc or \c nullptr if the ring is empty
+   */
+  template <typename AllocT>
+  std::byte* tryPop(AllocT&& alloc, std::size_t& len) {
+    auto head = head_.load(std::memory_order_relaxed);
+    auto const tail = tail_.load(std::memory_order_acquire);
+    if (head == tail) {
+      return nullptr;
+    }
+
+    auto pos = head & (capacity_ - 1);
+    auto rec_len = loadLength(pos);
+    if (rec_len == wrap_marker) {
+      head += capacity_ - pos;
+      pos = 0;
+      rec_len = loadLength(pos);
+    }
+
+    len = static_cast<std::size_t>(rec_len);
+    std::byte* buf = alloc(len);
+    std::memcpy(buf, dataAt(pos + sizeof(uint64_t)), len);
+
+    head_.store(head + recordSize(len), std::memory_order_release);
+    return buf;
+  }
+
+  /**
+   * \brief Whether the ring has a record; a cheap check for the consumer
+   */
+  bool empty() const {
+    return head_.load(std::memory_order_relaxed) ==
+      tail_.load(std::memory_order_acquire);
+  }
+
+private:
+  static std::size_t recordSize(std::size_t len) {
+    return (sizeof(uint64_t) + len + 7) & ~std::size_t{7};
+  }
+
+  std::byte* dataAt(std::size_t pos) {
+    return reinterpret_cast<std::byte*>(this + 1) + pos;
+  }
+
+  void storeLength(std::size_t pos, uint64_t len) {
+    std::memcpy(dataAt(pos), &len, sizeof(uint64_t));
+  }
+
+  uint64_t loadLength(std::size_t pos) {
+    uint64_t len = 0;
+    std::memcpy(&len, dataAt(pos), sizeof(uint64_t));
+    return len;
+  }
+
+private:
+  alignas(cache_line) std::atomic<uint64_t> head_{0};
+  alignas(cache_line) std::atomic<uint64_t> tail_{0};
+  alignas(cache_line) std::size_t capacity_ = 0;
+};
+
+}} /* end namespace vt::messaging */
+
+#endif /*INCLUDED_VT_MESSAGING_SHM_RING_H*/
@@ -0,0 +1,133 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                               shm_transport.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include "vt/config.h"
+#include "vt/messaging/shm_transport.h"
+
+#include <new>
+
+namespace vt { namespace messaging {
+
+ShmTransport::ShmTransport(MPI_Comm comm, std::size_t ring_bytes)
+  : node_(comm)
+{
+  auto const node_size = node_.getSize();
+  auto const slot_bytes = ShmRing::footprint(ring_bytes);
+
+  int node_rank = 0;
+  MPI_Comm_rank(node_.getComm(), &node_rank);
+
+  // One inbound ring per rank on the node, including this one, so the
+  // position of a ring in any segment is the sender's node-local rank
+  std::byte* base = nullptr;
+  MPI_Win_allocate_shared(
+    node_size * slot_bytes, 1, MPI_INFO_NULL, node_.getComm(), &base, &window_
+  );
+  MPI_Win_lock_all(MPI_MODE_NOCHECK, window_);
+
+  inbound_.resize(node_size, nullptr);
+  for (int r = 0; r < node_size; r++) {
+    if (r != node_rank) {
+      inbound_[r] = new (base + r * slot_bytes) ShmRing(ring_bytes);
+    }
+  }
+  max_message_ = ShmRing::maxRecord(ring_bytes);
+
+  // Make the constructed rings visible before any peer uses them
+  MPI_Win_sync(window_);
+  MPI_Barrier(node_.getComm());
+  MPI_Win_sync(window_);
+
+  outbound_.resize(node_size, nullptr);
+  for (int r = 0; r < node_size; r++) {
+    if (r != node_rank) {
+      MPI_Aint size = 0;
+      int disp_unit = 0;
+      std::byte* peer = nullptr;
+      MPI_Win_shared_query(window_, r, &size, &disp_unit, &peer);
+      outbound_[r] = reinterpret_cast<ShmRing*>(peer + node_rank * slot_bytes);
+    }
+  }
+
+  int world_size = 0;
+  MPI_Comm_size(comm, &world_size);
+  inbound_sender_.resize(node_size, uninitialized_destination);
+  for (NodeType node = 0; node < world_size; node++) {
+    auto const r = node_.getLocalRank(node);
+    if (r != rdma::ShmNode::no_rank) {
+      inbound_sender_[r] = node;
+    }
+  }
+
+  vt_debug_print(
+    normal, active,
+    "ShmTransport: node size={}, ring bytes={}, max message={}\n",
+    node_size, ring_bytes, max_message_
+  );
+}
+
+ShmTransport::~ShmTransport() {
+  if (window_ != MPI_WIN_NULL) {
+    MPI_Win_unlock_all(window_);
+    MPI_Win_free(&window_);
+  }
+}
+
+bool ShmTransport::reaches(NodeType dest, std::size_t len) const {
+  if (len > max_message_) {
+    return false;
+  }
+  auto const r = node_.getLocalRank(dest);
+  return r != rdma::ShmNode::no_rank and outbound_[r] != nullptr;
+}
+
+bool ShmTransport::trySend(
+  NodeType dest, std::byte const* data, std::size_t len
+) {
+  if (not reaches(dest, len)) {
+    return false;
+  }
+  return outbound_[node_.getLocalRank(dest)]->tryPush(data, len);
+}
+
+}} /* end namespace vt::messaging */
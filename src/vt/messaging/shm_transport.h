@@ -0,0 +1,164 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                               shm_transport.h
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_MESSAGING_SHM_TRANSPORT_H
+#define INCLUDED_VT_MESSAGING_SHM_TRANSPORT_H
+
+#include "vt/config.h"
+#include "vt/messaging/shm_ring.h"
+#include "vt/rdmahandle/shm_node.h"
+
+#include <vector>
+
+namespace vt { namespace messaging {
+
+/**
+ * \struct ShmTransport
+ *
+ * \brief Intra-node transport for small active messages over shared-memory
+ * rings.
+ *
+ * Each rank allocates, with \c MPI_Win_allocate_shared on its node
+ * communicator, one \c ShmRing per rank on the node for the messages that
+ * rank sends to it. A send to a rank on the same node is a copy into the ring
+ * the destination owns for this sender; the destination polls its rings from
+ * \c ActiveMessenger::progress. Messages too large for a ring and sends to
+ * other nodes go through MPI; a send that finds the ring full is held by the
+ * \c ActiveMessenger until the ring has room, so messages to a rank that go
+ * through its ring are received in the order they were sent.
+ */
+struct ShmTransport {
+  /**
+   * \brief Set up the rings; collective over all ranks
+   *
+   * \param[in] comm the runtime communicator
+   * \param[in] ring_bytes the data bytes of each ring, a power of two
+   */
+  ShmTransport(MPI_Comm comm, std::size_t ring_bytes);
+
+  ShmTransport(ShmTransport const&) = delete;
+  ShmTransport& operator=(ShmTransport const&) = delete;
+
+  ~ShmTransport();
+
+  /**
+   * \brief Try to send a message to a rank on this node
+   *
+   * \param[in] dest the destination rank
+   * \param[in] data the message bytes
+   * \param[in] len the number of bytes
+   *
+   * \return whether it was sent; otherwise, the caller must use MPI
+   */
+  bool trySend(NodeType dest, std::byte const* data, std::size_t len);
+
+  /**
+   * \brief Whether a message can ever go through a ring: the destination is
+   * another rank on this node and the message fits in a ring
+   *
+   * \param[in] dest the destination rank
+   * \param[in] len the number of bytes
+   *
+   * \return whether a ring reaches the destination for this message
+   */
+  bool reaches(NodeType dest, std::size_t len) const;
+
+  /**
+   * \brief Receive messages from the rings, round-robin over the senders
+   *
+   * \param[in] alloc called with a message length, returns where to copy it
+   * \param[in] deliver called with the sender, buffer and length
+   * \param[in] budget the maximum number of messages to receive
+   *
+   * \return the number of messages received
+   */
+  template <typename AllocT, typename DeliverT>
+  int poll(AllocT&& alloc, DeliverT&& deliver, int budget) {
+    int received = 0;
+    auto const n = inbound_.size();
+    for (std::size_t i = 0; i < n and received < budget; i++) {
+      auto const r = (next_poll_ + i) % n;
+      auto ring = inbound_[r];
+      if (ring == nullptr or ring->empty()) {
+        continue;
+      }
+      std::size_t len = 0;
+      while (received < budget) {
+        auto buf = ring->tryPop(alloc, len);
+        if (buf == nullptr) {
+          break;
+        }
+        received++;
+        deliver(inbound_sender_[r], buf, len);
+      }
+    }
+    next_poll_ = n == 0 ? 0 : (next_poll_ + 1) % n;
+    return received;
+  }
+
+  /**
+   * \brief The largest message sent through a ring
+   */
+  std::size_t getMaxMessage() const { return max_message_; }
+
+  /**
+   * \brief Get the number of ranks on this node
+   */
+  int getNodeSize() const { return node_.getSize(); }
+
+private:
+  rdma::ShmNode node_;
+  MPI_Win window_ = MPI_WIN_NULL;
+  std::size_t max_message_ = 0;
+  /// Rings this rank consumes, indexed by the sender's node-local rank
+  std::vector<ShmRing*> inbound_;
+  /// The runtime rank of each node-local rank
+  std::vector<NodeType> inbound_sender_;
+  /// Rings this rank produces into, indexed by the dest's node-local rank
+  std::vector<ShmRing*> outbound_;
+  std::size_t next_poll_ = 0;
+};
+
+}} /* end namespace vt::messaging */
+
+#endif /*INCLUDED_VT_MESSAGING_SHM_TRANSPORT_H*/
@@ -311,6 +311,14 @@ void PhaseManager::printSummary(vrt::collection::lb::PhaseInfo* last_phase_info)
       lb_name
     );
 
+    if (last_phase_info->rejected_count > 0) {
+      vt_print(
+        phase,
+        "phase={}, {} transfers rejected by the LB memory capacity\n",
+        last_phase_info->phase, last_phase_info->rejected_count
+      );
+    }
+
     if (last_phase_info->migration_count > 0) {
       vt_debug_print(
         terse, phase,
@@ -0,0 +1,253 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                   batch.h
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_RDMAHANDLE_BATCH_H
+#define INCLUDED_VT_RDMAHANDLE_BATCH_H
+
+#include "vt/config.h"
+#include "vt/rdmahandle/common.h"
+#include "vt/rdmahandle/handle_key.h"
+#include "vt/rdmahandle/request_holder.h"
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace vt { namespace rdma {
+
+/**
+ * \struct Batch
+ *
+ * \brief A passive-target access epoch on a node-level handle that batches
+ * many small operations.
+ *
+ * Constructing the batch opens a single \c MPI_Win_lock_all epoch on the
+ * handle's window. Each get/put/accumulate is issued immediately with
+ * \c MPI_Rget, \c MPI_Rput or \c MPI_Raccumulate without any per-operation
+ * lock, and is tracked per target. Completing a target issues one
+ * \c MPI_Win_flush for all the operations outstanding to it. The batch must
+ * be ended (or destroyed) before the handle is used with locks again.
+ *
+ * The \c RequestHolder returned by \c rget, \c rput and \c raccum completes
+ * the operation's target when waited on (or destroyed), so it acts as a
+ * future for the operation's result.
+ *
+ * \code{.cpp}
+ * auto batch = handle.makeBatch();
+ * for (int i = 0; i < n; i++) {
+ *   batch.get(target[i], &out[i], 1, offset[i]);
+ * }
+ * batch.end(); // one flush per target
+ * \endcode
+ */
+template <typename T, HandleEnum E>
+struct Batch {
+private:
+  struct State {
+    State(HandleKey in_key, std::size_t in_hoff)
+      : key_(in_key),
+        hoff_(in_hoff)
+    { }
+
+    HandleKey key_;
+    std::size_t hoff_ = 0;
+    bool open_ = false;
+    std::unordered_map<vt::NodeType, std::vector<RequestHolder>> pending_;
+    std::size_t num_ops_ = 0;
+    std::size_t num_flushes_ = 0;
+  };
+
+public:
+  /**
+   * \internal \brief Open a batch on a handle; see \c Handle::makeBatch
+   *
+   * \param[in] in_key the handle key
+   * \param[in] in_hoff the handle offset
+   */
+  Batch(HandleKey in_key, std::size_t in_hoff);
+
+  Batch(Batch const&) = delete;
+  Batch& operator=(Batch const&) = delete;
+  Batch(Batch&&) = default;
+  Batch& operator=(Batch&&) = default;
+
+  ~Batch();
+
+  /**
+   * \brief Get data from a remote process in the batch; the values are
+   * available once the target is completed
+   *
+   * \param[in] node the target process
+   * \param[out] ptr the pointer to write the fetched values to
+   * \param[in] len the length to get
+   * \param[in] offset the offset in the target window
+   */
+  void get(vt::NodeType node, T* ptr, std::size_t len, uint64_t offset);
+
+  /**
+   * \brief Put data to a remote process in the batch
+   *
+   * \param[in] node the target process
+   * \param[in] ptr the pointer to the values, which must stay valid until the
+   * target is completed
+   * \param[in] len the length to put
+   * \param[in] offset the offset in the target window
+   */
+  void put(vt::NodeType node, T* ptr, std::size_t len, uint64_t offset);
+
+  /**
+   * \brief Accumulate data to a remote process in the batch
+   *
+   * \param[in] node the target process
+   * \param[in] ptr the pointer to the values, which must stay valid until the
+   * target is completed
+   * \param[in] len the length to accumulate
+   * \param[in] offset the offset in the target window
+   * \param[in] op the \c MPI_Op to apply
+   */
+  void accum(
+    vt::NodeType node, T* ptr, std::size_t len, uint64_t offset, MPI_Op op
+  );
+
+  /**
+   * \brief Get data from a remote process in the batch, returning a future
+   *
+   * \param[in] node the target process
+   * \param[out] ptr the pointer to write the fetched values to
+   * \param[in] len the length to get
+   * \param[in] offset the offset in the target window
+   *
+   * \return request holder that completes the target when waited on
+   */
+  RequestHolder rget(vt::NodeType node, T* ptr, std::size_t len, uint64_t offset);
+
+  /**
+   * \brief Put data to a remote process in the batch, returning a future
+   *
+   * \param[in] node the target process
+   * \param[in] ptr the pointer to the values
+   * \param[in] len the length to put
+   * \param[in] offset the offset in the target window
+   *
+   * \return request holder that completes the target when waited on
+   */
+  RequestHolder rput(vt::NodeType node, T* ptr, std::size_t len, uint64_t offset);
+
+  /**
+   * \brief Accumulate data to a remote process in the batch, returning a
+   * future
+   *
+   * \param[in] node the target process
+   * \param[in] ptr the pointer to the values
+   * \param[in] len the length to accumulate
+   * \param[in] offset the offset in the target window
+   * \param[in] op the \c MPI_Op to apply
+   *
+   * \return request holder that completes the target when waited on
+   */
+  RequestHolder raccum(
+    vt::NodeType node, T* ptr, std::size_t len, uint64_t offset, MPI_Op op
+  );
+
+  /**
+   * \brief Complete all the operations outstanding to a target with a single
+   * \c MPI_Win_flush
+   *
+   * \param[in] node the target process
+   */
+  void flush(vt::NodeType node);
+
+  /**
+   * \brief Complete all outstanding operations, one flush per target
+   */
+  void flushAll();
+
+  /**
+   * \brief Complete all outstanding operations and close the epoch
+   */
+  void end();
+
+  /**
+   * \brief Whether the epoch is still open
+   */
+  bool isOpen() const { return state_ != nullptr and state_->open_; }
+
+  /**
+   * \brief Number of operations issued in the batch
+   */
+  std::size_t getNumOps() const { return state_->num_ops_; }
+
+  /**
+   * \brief Number of \c MPI_Win_flush calls issued by the batch
+   */
+  std::size_t getNumFlushes() const { return state_->num_flushes_; }
+
+private:
+  /**
+   * \internal \brief Track an issued operation until its target is completed
+   *
+   * \param[in] node the target process
+   * \param[in] r the request holder of the issued operation
+   */
+  void track(vt::NodeType node, RequestHolder r);
+
+  /**
+   * \internal \brief Make a future that completes a target
+   *
+   * \param[in] node the target process
+   *
+   * \return the future
+   */
+  RequestHolder makeFuture(vt::NodeType node);
+
+  static void flushState(State& state, vt::NodeType node);
+
+private:
+  std::shared_ptr<State> state_ = nullptr;
+};
+
+}} /* end namespace vt::rdma */
+
+#include "vt/rdmahandle/batch.impl.h"
+
+#endif /*INCLUDED_VT_RDMAHANDLE_BATCH_H*/
@@ -0,0 +1,187 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                 batch.impl.h
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_RDMAHANDLE_BATCH_IMPL_H
+#define INCLUDED_VT_RDMAHANDLE_BATCH_IMPL_H
+
+#include "vt/config.h"
+#include "vt/rdmahandle/batch.h"
+#include "vt/rdmahandle/manager.h"
+
+namespace vt { namespace rdma {
+
+template <typename T, HandleEnum E>
+Batch<T,E>::Batch(HandleKey in_key, std::size_t in_hoff)
+  : state_(std::make_shared<State>(in_key, in_hoff))
+{
+  vt::theHandleRDMA()->getEntry<T,E>(state_->key_).lockAll();
+  state_->open_ = true;
+}
+
+template <typename T, HandleEnum E>
+Batch<T,E>::~Batch() {
+  if (state_ != nullptr) {
+    end();
+  }
+}
+
+template <typename T, HandleEnum E>
+void Batch<T,E>::get(
+  vt::NodeType node, T* ptr, std::size_t len, uint64_t offset
+) {
+  vtAssert(isOpen(), "Batch must be open");
+  auto& holder = vt::theHandleRDMA()->getEntry<T,E>(state_->key_);
+  auto const off = offset + state_->hoff_;
+  track(node, holder.rget(node, Lock::None, ptr, len, off));
+}
+
+template <typename T, HandleEnum E>
+void Batch<T,E>::put(
+  vt::NodeType node, T* ptr, std::size_t len, uint64_t offset
+) {
+  vtAssert(isOpen(), "Batch must be open");
+  auto& holder = vt::theHandleRDMA()->getEntry<T,E>(state_->key_);
+  auto const off = offset + state_->hoff_;
+  track(node, holder.rput(node, Lock::None, ptr, len, off));
+}
+
+template <typename T, HandleEnum E>
+void Batch<T,E>::accum(
+  vt::NodeType node, T* ptr, std::size_t len, uint64_t offset, MPI_Op op
+) {
+  vtAssert(isOpen(), "Batch must be open");
+  auto& holder = vt::theHandleRDMA()->getEntry<T,E>(state_->key_);
+  auto const off = offset + state_->hoff_;
+  track(node, holder.raccum(node, Lock::None, ptr, len, off, op));
+}
+
+template <typename T, HandleEnum E>
+RequestHolder Batch<T,E>::rget(
+  vt::NodeType node, T* ptr, std::size_t len, uint64_t offset
+) {
+  get(node, ptr, len, offset);
+  return makeFuture(node);
+}
+
+template <typename T, HandleEnum E>
+RequestHolder Batch<T,E>::rput(
+  vt::NodeType node, T* ptr, std::size_t len, uint64_t offset
+) {
+  put(node, ptr, len, offset);
+  return makeFuture(node);
+}
+
+template <typename T, HandleEnum E>
+RequestHolder Batch<T,E>::raccum(
+  vt::NodeType node, T* ptr, std::size_t len, uint64_t offset, MPI_Op op
+) {
+  accum(node, ptr, len, offset, op);
+  return makeFuture(node);
+}
+
+template <typename T, HandleEnum E>
+void Batch<T,E>::track(vt::NodeType node, RequestHolder r) {
+  state_->pending_[node].emplace_back(std::move(r));
+  state_->num_ops_++;
+}
+
+template <typename T, HandleEnum E>
+RequestHolder Batch<T,E>::makeFuture(vt::NodeType node) {
+  RequestHolder future;
+  future.add([weak = std::weak_ptr<State>{state_}, node]{
+    if (auto state = weak.lock()) {
+      flushState(*state, node);
+    }
+  });
+  return future;
+}
+
+template <typename T, HandleEnum E>
+/*static*/ void Batch<T,E>::flushState(State& state, vt::NodeType node) {
+  auto iter = state.pending_.find(node);
+  if (iter == state.pending_.end() or not state.open_) {
+    return;
+  }
+
+  // One flush completes every operation to the target, after which the
+  // individual requests are complete and only need to be released
+  vt::theHandleRDMA()->getEntry<T,E>(state.key_).flush(node);
+  state.num_flushes_++;
+
+  auto reqs = std::move(iter->second);
+  state.pending_.erase(iter);
+  for (auto&& r : reqs) {
+    r.wait();
+  }
+}
+
+template <typename T, HandleEnum E>
+void Batch<T,E>::flush(vt::NodeType node) {
+  flushState(*state_, node);
+}
+
+template <typename T, HandleEnum E>
+void Batch<T,E>::flushAll() {
+  std::vector<vt::NodeType> nodes;
+  nodes.reserve(state_->pending_.size());
+  for (auto&& elm : state_->pending_) {
+    nodes.push_back(elm.first);
+  }
+  for (auto&& node : nodes) {
+    flushState(*state_, node);
+  }
+}
+
+template <typename T, HandleEnum E>
+void Batch<T,E>::end() {
+  if (not isOpen()) {
+    return;
+  }
+  flushAll();
+  vt::theHandleRDMA()->getEntry<T,E>(state_->key_).unlockAll();
+  state_->open_ = false;
+}
+
+}} /* end namespace vt::rdma */
+
+#endif /*INCLUDED_VT_RDMAHANDLE_BATCH_IMPL_H*/
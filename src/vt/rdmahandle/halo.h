@@ -0,0 +1,275 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                    halo.h
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_RDMAHANDLE_HALO_H
+#define INCLUDED_VT_RDMAHANDLE_HALO_H
+
+#include "vt/config.h"
+#include "vt/rdmahandle/handle.h"
+
+#include <functional>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace vt { namespace rdma {
+
+/**
+ * \struct HaloLayout
+ *
+ * \brief The named ghost regions of each element's halo window.
+ *
+ * The layout must be identical on all elements of the collection so every
+ * element's window has the same size and every region the same offset.
+ */
+struct HaloLayout {
+  using RegionType = std::tuple<std::string, uint64_t, uint64_t>;
+
+  HaloLayout() = default;
+
+  /**
+   * \brief Add a named ghost region
+   *
+   * \param[in] name the region name
+   * \param[in] count number of values in the region
+   *
+   * \return the region id
+   */
+  std::size_t addRegion(std::string const& name, uint64_t count) {
+    regions_.emplace_back(name, total_, count);
+    total_ += count;
+    return regions_.size() - 1;
+  }
+
+  /**
+   * \brief Get the id of a region by name
+   *
+   * \param[in] name the region name
+   *
+   * \return the region id
+   */
+  std::size_t getRegion(std::string const& name) const {
+    for (std::size_t i = 0; i < regions_.size(); i++) {
+      if (std::get<0>(regions_[i]) == name) {
+        return i;
+      }
+    }
+    vtAbort("Halo region does not exist: " + name);
+    return 0;
+  }
+
+  uint64_t getOffset(std::size_t region) const {
+    return std::get<1>(regions_.at(region));
+  }
+
+  uint64_t getCount(std::size_t region) const {
+    return std::get<2>(regions_.at(region));
+  }
+
+  std::size_t getNumRegions() const { return regions_.size(); }
+
+  /**
+   * \brief Total number of values in an element's halo window
+   */
+  uint64_t getTotal() const { return total_; }
+
+  template <typename SerializerT>
+  void serialize(SerializerT& s) {
+    s | regions_ | total_;
+  }
+
+private:
+  std::vector<RegionType> regions_;
+  uint64_t total_ = 0;
+};
+
+/**
+ * \struct Halo
+ *
+ * \brief Ghost/halo exchange for a collection element over an RDMA handle.
+ *
+ * Each element declares its neighbors once, as (neighbor index, ghost region
+ * on the neighbor) pairs, and then calls \c exchange every iteration. The
+ * exchange packs each outgoing region into a staging buffer and puts all the
+ * regions targeting the same rank under a single lock. The resolved (rank,
+ * window offset) of each neighbor is cached and only re-resolved after load
+ * balancing has re-homed the handle's windows.
+ *
+ * The puts are complete at the targets when \c exchange returns; the ghost
+ * regions may be read with \c readGhost once all elements have exchanged
+ * (e.g., after the epoch containing the exchange terminates).
+ *
+ * \code{.cpp}
+ * // collective over all elements
+ * vt::rdma::HaloLayout layout;
+ * layout.addRegion("west", ny);
+ * layout.addRegion("east", ny);
+ * halo_ = proxy.template makeHaloRDMA<double>(idx, layout);
+ * halo_.addNeighbor(idx + 1, "west");  // my east edge is its west ghost
+ * halo_.addNeighbor(idx - 1, "east");
+ *
+ * // every iteration
+ * halo_.exchange(
+ *   [&](vt::Index1D n, std::size_t region, double* buf, std::size_t count) {
+ *     ...
+ *   }
+ * );
+ * \endcode
+ */
+template <typename T, typename IndexT>
+struct Halo {
+  using HandleType = Handle<T, HandleEnum::StaticSize, IndexT>;
+  using PackFnType =
+    std::function<void(IndexT const&, std::size_t, T*, std::size_t)>;
+  using ReadFnType = std::function<void(T const*, std::size_t)>;
+
+  Halo() = default;
+
+  /**
+   * \internal \brief Construct a halo over a handle created for the layout;
+   * see \c makeHaloRDMA on the collection proxy
+   *
+   * \param[in] in_handle the index-level handle sized for the layout
+   * \param[in] in_layout the ghost region layout
+   */
+  Halo(HandleType in_handle, HaloLayout in_layout);
+
+  /**
+   * \brief Add a neighbor to send to on each exchange
+   *
+   * \param[in] idx the neighbor index
+   * \param[in] region the ghost region on the neighbor to put into
+   */
+  void addNeighbor(IndexT const& idx, std::string const& region);
+
+  /**
+   * \brief Add a neighbor to send to on each exchange
+   *
+   * \param[in] idx the neighbor index
+   * \param[in] region the ghost region id on the neighbor to put into
+   */
+  void addNeighbor(IndexT const& idx, std::size_t region);
+
+  /**
+   * \brief Pack and put the outgoing regions to all neighbors
+   *
+   * \param[in] pack called once per neighbor with the neighbor index, the
+   * target region id, the buffer to fill and its count
+   */
+  void exchange(PackFnType pack);
+
+  /**
+   * \brief Read a ghost region of this element
+   *
+   * \param[in] region the region name
+   * \param[in] fn called with the region data and its count
+   */
+  void readGhost(std::string const& region, ReadFnType fn);
+
+  /**
+   * \brief Read a ghost region of this element
+   *
+   * \param[in] region the region id
+   * \param[in] fn called with the region data and its count
+   */
+  void readGhost(std::size_t region, ReadFnType fn);
+
+  /**
+   * \brief Get the underlying handle, e.g., to destroy it
+   */
+  HandleType getHandle() const { return handle_; }
+
+  HaloLayout const& getLayout() const { return layout_; }
+
+  std::size_t getNumNeighbors() const { return neighbors_.size(); }
+
+  /**
+   * \brief Number of distinct ranks the last exchange put to
+   */
+  std::size_t getNumTargetRanks() const { return plan_.size(); }
+
+  template <typename SerializerT>
+  void serialize(SerializerT& s) {
+    s | handle_ | layout_ | neighbors_;
+    if (s.isUnpacking()) {
+      plan_.clear();
+      plan_version_ = no_version;
+    }
+  }
+
+private:
+  /**
+   * \internal \brief Resolve the rank and window offset of every neighbor's
+   * target region and group them by rank
+   */
+  void resolvePlan();
+
+private:
+  static constexpr uint64_t const no_version = ~uint64_t{0};
+
+  struct PlanEntry {
+    std::size_t neighbor_ = 0;
+    uint64_t offset_ = 0;
+  };
+
+  HandleType handle_;
+  HaloLayout layout_;
+  std::vector<std::tuple<IndexT, std::size_t>> neighbors_;
+  /// Per target rank, the puts to perform; rebuilt when the layout changes
+  std::vector<std::tuple<NodeType, std::vector<PlanEntry>>> plan_;
+  uint64_t plan_version_ = no_version;
+  std::vector<std::vector<T>> staging_;
+};
+
+}} /* end namespace vt::rdma */
+
+namespace vt {
+
+template <typename T, typename I>
+using HaloRDMA = rdma::Halo<T, I>;
+
+} /* end namespace vt */
+
+#include "vt/rdmahandle/halo.impl.h"
+
+#endif /*INCLUDED_VT_RDMAHANDLE_HALO_H*/
@@ -0,0 +1,153 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                 halo.impl.h
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_RDMAHANDLE_HALO_IMPL_H
+#define INCLUDED_VT_RDMAHANDLE_HALO_IMPL_H
+
+#include "vt/config.h"
+#include "vt/rdmahandle/halo.h"
+#include "vt/rdmahandle/sub_handle.h"
+
+#include <unordered_map>
+
+namespace vt { namespace rdma {
+
+template <typename T, typename IndexT>
+Halo<T,IndexT>::Halo(HandleType in_handle, HaloLayout in_layout)
+  : handle_(in_handle),
+    layout_(std::move(in_layout))
+{ }
+
+template <typename T, typename IndexT>
+void Halo<T,IndexT>::addNeighbor(
+  IndexT const& idx, std::string const& region
+) {
+  addNeighbor(idx, layout_.getRegion(region));
+}
+
+template <typename T, typename IndexT>
+void Halo<T,IndexT>::addNeighbor(IndexT const& idx, std::size_t region) {
+  vtAssert(region < layout_.getNumRegions(), "Halo region must exist");
+  neighbors_.emplace_back(idx, region);
+  plan_version_ = no_version;
+}
+
+template <typename T, typename IndexT>
+void Halo<T,IndexT>::resolvePlan() {
+  using SubType = SubHandle<T, HandleEnum::StaticSize, IndexT>;
+  auto sub = vt::objgroup::proxy::Proxy<SubType>(handle_.proxy_).get();
+
+  plan_.clear();
+  staging_.resize(neighbors_.size());
+
+  std::unordered_map<NodeType, std::size_t> node_slot;
+  for (std::size_t i = 0; i < neighbors_.size(); i++) {
+    auto const& idx = std::get<0>(neighbors_[i]);
+    auto const region = std::get<1>(neighbors_[i]);
+    auto info = sub->resolveLocation(idx);
+    auto const node = info.getNode();
+    auto const offset =
+      info.getOffset() + handle_.hoff() + layout_.getOffset(region);
+
+    auto iter = node_slot.find(node);
+    if (iter == node_slot.end()) {
+      iter = node_slot.emplace(node, plan_.size()).first;
+      plan_.emplace_back(node, std::vector<PlanEntry>{});
+    }
+    std::get<1>(plan_[iter->second]).push_back(PlanEntry{i, offset});
+    staging_[i].resize(layout_.getCount(region));
+  }
+
+  plan_version_ = sub->getLayoutVersion();
+
+  vt_debug_print(
+    normal, rdma,
+    "Halo::resolvePlan: neighbors={}, ranks={}, version={}\n",
+    neighbors_.size(), plan_.size(), plan_version_
+  );
+}
+
+template <typename T, typename IndexT>
+void Halo<T,IndexT>::exchange(PackFnType pack) {
+  using SubType = SubHandle<T, HandleEnum::StaticSize, IndexT>;
+  using PutEntry = typename SubType::PutEntry;
+  auto sub = vt::objgroup::proxy::Proxy<SubType>(handle_.proxy_).get();
+
+  // The windows are only re-homed when load balancing migrated handles, so
+  // the resolved locations stay valid until the layout version changes
+  if (plan_version_ != sub->getLayoutVersion()) {
+    resolvePlan();
+  }
+
+  std::vector<PutEntry> puts;
+  for (auto&& target : plan_) {
+    auto const node = std::get<0>(target);
+    puts.clear();
+    for (auto&& entry : std::get<1>(target)) {
+      auto& buf = staging_[entry.neighbor_];
+      auto const& idx = std::get<0>(neighbors_[entry.neighbor_]);
+      auto const region = std::get<1>(neighbors_[entry.neighbor_]);
+      pack(idx, region, buf.data(), buf.size());
+      puts.emplace_back(buf.data(), buf.size(), entry.offset_);
+    }
+    sub->putGroup(node, Lock::Shared, puts);
+  }
+}
+
+template <typename T, typename IndexT>
+void Halo<T,IndexT>::readGhost(std::string const& region, ReadFnType fn) {
+  readGhost(layout_.getRegion(region), fn);
+}
+
+template <typename T, typename IndexT>
+void Halo<T,IndexT>::readGhost(std::size_t region, ReadFnType fn) {
+  auto const offset = layout_.getOffset(region);
+  auto const count = layout_.getCount(region);
+  handle_.readShared([&](T const* data, std::size_t) {
+    fn(data + offset, count);
+  });
+}
+
+}} /* end namespace vt::rdma */
+
+#endif /*INCLUDED_VT_RDMAHANDLE_HALO_IMPL_H*/
@@ -57,6 +57,14 @@ template <
 >
 struct Handle;
 
+template <typename T, HandleEnum E>
+struct Batch;
+
+struct HaloLayout;
+
+template <typename T, typename IndexT>
+struct Halo;
+
 }} /* end namespace vt::rdma */
 
 #endif /*INCLUDED_VT_RDMAHANDLE_HANDLE_FWD_H*/
@@ -49,6 +49,7 @@
 #include "vt/rdmahandle/holder.h"
 #include "vt/rdmahandle/manager.h"
 #include "vt/rdmahandle/sub_handle.h"
+#include "vt/rdmahandle/batch.h"
 
 namespace vt { namespace rdma {
 
@@ -82,6 +82,7 @@ struct Handle<
 
   friend struct Manager;
   friend struct SubHandle<T, E, IndexT>;
+  friend struct Halo<T, IndexT>;
 
 public:
   struct IndexTagType { };
@@ -176,7 +177,7 @@ public:
    * \param[in] l the lock to apply for the get
    */
   void get(
-    IndexT const& idx, std::size_t len, int offset, Lock l = Lock::None
+    IndexT const& idx, std::size_t len, uint64_t offset, Lock l = Lock::None
   );
 
   /**
@@ -190,7 +191,7 @@ public:
    * \param[in] l the lock to apply for the get
    */
   void get(
-    IndexT const& idx, T* ptr, std::size_t len, int offset, Lock l = Lock::None
+    IndexT const& idx, T* ptr, std::size_t len, uint64_t offset, Lock l = Lock::None
   );
 
   /**
@@ -204,7 +205,7 @@ public:
    * \param[in] l the lock to apply for the put
    */
   void put(
-    IndexT const& idx, T* ptr, std::size_t len, int offset, Lock l = Lock::None
+    IndexT const& idx, T* ptr, std::size_t len, uint64_t offset, Lock l = Lock::None
   );
 
   /**
@@ -219,7 +220,7 @@ public:
    * \param[in] l the lock to apply for the accumulate
    */
   void accum(
-    IndexT const& idx, T* ptr, std::size_t len, int offset, MPI_Op op,
+    IndexT const& idx, T* ptr, std::size_t len, uint64_t offset, MPI_Op op,
     Lock l = Lock::None
   );
 
@@ -240,7 +241,7 @@ public:
    * \return the request holder to wait on
    */
   RequestType rget(
-    IndexT const& idx, T* ptr, std::size_t len, int offset, Lock l = Lock::None
+    IndexT const& idx, T* ptr, std::size_t len, uint64_t offset, Lock l = Lock::None
   );
 
   /**
@@ -259,7 +260,7 @@ public:
    * \return the request holder to wait on
    */
   RequestType rget(
-    IndexT const& idx, std::size_t len, int offset, Lock l = Lock::None
+    IndexT const& idx, std::size_t len, uint64_t offset, Lock l = Lock::None
   );
 
   /**
@@ -276,7 +277,7 @@ public:
    * \param[in] l the lock to apply for the put
    */
   RequestType rput(
-    IndexT const& idx, T* ptr, std::size_t len, int offset, Lock l = Lock::None
+    IndexT const& idx, T* ptr, std::size_t len, uint64_t offset, Lock l = Lock::None
   );
 
   /**
@@ -294,7 +295,7 @@ public:
    * \param[in] l the lock to apply for the accumulate
    */
   RequestType raccum(
-    IndexT const& idx, T* ptr, std::size_t len, int offset, MPI_Op op,
+    IndexT const& idx, T* ptr, std::size_t len, uint64_t offset, MPI_Op op,
     Lock l = Lock::None
   );
 
@@ -311,7 +312,7 @@ public:
    * \return the value fetched
    */
   T fetchOp(
-    IndexT const& idx, T val, int offset, MPI_Op op, Lock l = Lock::None
+    IndexT const& idx, T val, uint64_t offset, MPI_Op op, Lock l = Lock::None
   );
 
   /**
@@ -337,6 +338,20 @@ public:
    */
   void unlock();
 
+  /**
+   * \brief Cache the data read from remote indices on this process; applies to
+   * all the handles of the collection on this process. See
+   * \c Handle<T,E>::enableReadCache
+   *
+   * \param[in] page_count the number of elements in each page
+   */
+  void enableReadCache(std::size_t page_count = 1024);
+
+  /**
+   * \brief Stop caching reads and drop the cached pages
+   */
+  void disableReadCache();
+
   /**
    * \brief Serializer for the handle
    *
@@ -114,11 +114,27 @@ void Handle<
   this->lock_ = nullptr;
 }
 
+template <typename T, HandleEnum E, typename I>
+void Handle<
+  T,E,I,typename std::enable_if_t<not std::is_same<I,vt::NodeType>::value>
+>::enableReadCache(std::size_t page_count) {
+  auto proxy = vt::objgroup::proxy::Proxy<SubHandle<T,E,I>>(proxy_);
+  proxy.get()->enableReadCache(page_count);
+}
+
+template <typename T, HandleEnum E, typename I>
+void Handle<
+  T,E,I,typename std::enable_if_t<not std::is_same<I,vt::NodeType>::value>
+>::disableReadCache() {
+  auto proxy = vt::objgroup::proxy::Proxy<SubHandle<T,E,I>>(proxy_);
+  proxy.get()->enableReadCache(0);
+}
+
 template <typename T, HandleEnum E, typename I>
 void Handle<
   T,E,I,typename std::enable_if_t<not std::is_same<I,vt::NodeType>::value>
 >::get(
-  I const& index, T* ptr, std::size_t len, int offset, Lock l
+  I const& index, T* ptr, std::size_t len, uint64_t offset, Lock l
 ) {
   auto proxy = vt::objgroup::proxy::Proxy<SubHandle<T,E,I>>(proxy_);
   proxy.get()->get(index, l, ptr, len, offset + this->hoff());
@@ -131,7 +147,7 @@ typename Handle<
 Handle<
   T,E,I,typename std::enable_if_t<not std::is_same<I,vt::NodeType>::value>
 >::rget(
-  I const& index, T* ptr, std::size_t len, int offset, Lock l
+  I const& index, T* ptr, std::size_t len, uint64_t offset, Lock l
 ) {
   auto proxy = vt::objgroup::proxy::Proxy<SubHandle<T,E,I>>(proxy_);
   return proxy.get()->rget(index, l, ptr, len, offset + this->hoff());
@@ -141,7 +157,7 @@ template <typename T, HandleEnum E, typename I>
 void Handle<
   T,E,I,typename std::enable_if_t<not std::is_same<I,vt::NodeType>::value>
 >::get(
-  I const& index, std::size_t len, int offset, [[maybe_unused]] Lock l
+  I const& index, std::size_t len, uint64_t offset, [[maybe_unused]] Lock l
 ) {
   auto proxy = vt::objgroup::proxy::Proxy<SubHandle<T,E,I>>(proxy_);
   proxy.get()->rget(index, len, offset);
@@ -154,7 +170,7 @@ typename Handle<
 Handle<
   T,E,I,typename std::enable_if_t<not std::is_same<I,vt::NodeType>::value>
 >::rget(
-  I const& index, std::size_t len, int offset, Lock l
+  I const& index, std::size_t len, uint64_t offset, Lock l
 ) {
   auto proxy = vt::objgroup::proxy::Proxy<SubHandle<T,E,I>>(proxy_);
   if (this->getBuffer() == nullptr) {
@@ -185,7 +201,7 @@ template <typename T, HandleEnum E, typename I>
 void Handle<
   T,E,I,typename std::enable_if_t<not std::is_same<I,vt::NodeType>::value>
 >::put(
-  I const& index, T* ptr, std::size_t len, int offset, Lock l
+  I const& index, T* ptr, std::size_t len, uint64_t offset, Lock l
 ) {
   auto proxy = vt::objgroup::proxy::Proxy<SubHandle<T,E,I>>(proxy_);
   return proxy.get()->put(index, l, ptr, len, offset + this->hoff());
@@ -198,7 +214,7 @@ typename Handle<
 Handle<
   T,E,I,typename std::enable_if_t<not std::is_same<I,vt::NodeType>::value>
 >::rput(
-  I const& index, T* ptr, std::size_t len, int offset, Lock l
+  I const& index, T* ptr, std::size_t len, uint64_t offset, Lock l
 ) {
   auto proxy = vt::objgroup::proxy::Proxy<SubHandle<T,E,I>>(proxy_);
   return proxy.get()->rput(index, l, ptr, len, offset + this->hoff());
@@ -208,7 +224,7 @@ template <typename T, HandleEnum E, typename I>
 void Handle<
   T,E,I,typename std::enable_if_t<not std::is_same<I,vt::NodeType>::value>
 >::accum(
-  I const& index, T* ptr, std::size_t len, int offset, MPI_Op op, Lock l
+  I const& index, T* ptr, std::size_t len, uint64_t offset, MPI_Op op, Lock l
 ) {
   auto proxy = vt::objgroup::proxy::Proxy<SubHandle<T,E,I>>(proxy_);
   return proxy.get()->accum(index, l, ptr, len, offset + this->hoff(), op);
@@ -221,7 +237,7 @@ typename Handle<
 Handle<
   T,E,I,typename std::enable_if_t<not std::is_same<I,vt::NodeType>::value>
 >::raccum(
-  I const& index, T* ptr, std::size_t len, int offset, MPI_Op op, Lock l
+  I const& index, T* ptr, std::size_t len, uint64_t offset, MPI_Op op, Lock l
 ) {
   auto proxy = vt::objgroup::proxy::Proxy<SubHandle<T,E,I>>(proxy_);
   return proxy.get()->raccum(index, l, ptr, len, offset + this->hoff(), op);
@@ -231,7 +247,7 @@ template <typename T, HandleEnum E, typename I>
 T Handle<
   T,E,I,typename std::enable_if_t<not std::is_same<I,vt::NodeType>::value>
 >::fetchOp(
-  I const& index, T ptr, int offset, MPI_Op op, Lock l
+  I const& index, T ptr, uint64_t offset, MPI_Op op, Lock l
 ) {
   auto proxy = vt::objgroup::proxy::Proxy<SubHandle<T,E,I>>(proxy_);
   return proxy.get()->fetchOp(index, l, ptr, offset, op);
@@ -183,6 +183,32 @@ public:
    */
   void unlock();
 
+  /**
+   * \brief Open a passive-target epoch on all processes that batches many
+   * operations, completing them with one flush per target; see \c Batch
+   *
+   * \return the batch
+   */
+  Batch<T, E> makeBatch();
+
+  /**
+   * \brief Cache the data read from remote processes on this process. Reads
+   * fetch whole pages of the target's window and later reads of a cached page
+   * are served locally.
+   *
+   * Only valid for data that is not modified remotely while cached: the cache
+   * is invalidated at the end of each phase, on \c fence, and for a target
+   * when this process writes to it.
+   *
+   * \param[in] page_count the number of elements in each page
+   */
+  void enableReadCache(std::size_t page_count = 1024);
+
+  /**
+   * \brief Stop caching reads and drop the cached pages
+   */
+  void disableReadCache();
+
   /**
    * \brief Perform fence synchronization on the underlying data window
    *
@@ -245,7 +271,7 @@ public:
    * \param[in] l the lock to apply for the get
    */
   void get(
-    vt::NodeType node, std::size_t len, int offset, Lock l = Lock::None
+    vt::NodeType node, std::size_t len, uint64_t offset, Lock l = Lock::None
   );
 
   /**
@@ -259,7 +285,7 @@ public:
    * \param[in] l the lock to apply for the get
    */
   void get(
-    vt::NodeType node, T* ptr, std::size_t len, int offset, Lock l = Lock::None
+    vt::NodeType node, T* ptr, std::size_t len, uint64_t offset, Lock l = Lock::None
   );
 
   /**
@@ -273,7 +299,7 @@ public:
    * \param[in] l the lock to apply for the put
    */
   void put(
-    vt::NodeType node, T* ptr, std::size_t len, int offset, Lock l = Lock::None
+    vt::NodeType node, T* ptr, std::size_t len, uint64_t offset, Lock l = Lock::None
   );
 
   /**
@@ -288,7 +314,7 @@ public:
    * \param[in] l the lock to apply for the accumulate
    */
   void accum(
-    vt::NodeType node, T* ptr, std::size_t len, int offset, MPI_Op op, Lock l = Lock::None
+    vt::NodeType node, T* ptr, std::size_t len, uint64_t offset, MPI_Op op, Lock l = Lock::None
   );
 
   /**
@@ -308,7 +334,7 @@ public:
    * \return the request holder to wait on
    */
   RequestType rget(
-    vt::NodeType no, std::size_t len, int offset, Lock l = Lock::None
+    vt::NodeType no, std::size_t len, uint64_t offset, Lock l = Lock::None
   );
 
   /**
@@ -327,7 +353,7 @@ public:
    * \return the request holder to wait on
    */
   RequestType rget(
-    vt::NodeType node, T* ptr, std::size_t len, int offset, Lock l = Lock::None
+    vt::NodeType node, T* ptr, std::size_t len, uint64_t offset, Lock l = Lock::None
   );
 
   /**
@@ -344,7 +370,7 @@ public:
    * \param[in] l the lock to apply for the put
    */
   RequestType rput(
-    vt::NodeType node, T* ptr, std::size_t len, int offset, Lock l = Lock::None
+    vt::NodeType node, T* ptr, std::size_t len, uint64_t offset, Lock l = Lock::None
   );
 
   /**
@@ -362,7 +388,7 @@ public:
    * \param[in] l the lock to apply for the accumulate
    */
   RequestType raccum(
-    vt::NodeType node, T* ptr, std::size_t len, int offset, MPI_Op op,
+    vt::NodeType node, T* ptr, std::size_t len, uint64_t offset, MPI_Op op,
     Lock l = Lock::None
   );
 
@@ -379,7 +405,7 @@ public:
    * \return the value fetched
    */
   T fetchOp(
-    vt::NodeType node, T val, int offset, MPI_Op op, Lock l = Lock::None
+    vt::NodeType node, T val, uint64_t offset, MPI_Op op, Lock l = Lock::None
   );
 
   /**
@@ -403,6 +429,22 @@ public:
     BaseTypedHandle<T, E, vt::NodeType>::serialize(s);
   }
 
+private:
+  /**
+   * \internal \brief Read through the read cache when it is enabled
+   *
+   * \param[in] node the target process
+   * \param[in] l the lock to apply
+   * \param[out] ptr the pointer to write the values to
+   * \param[in] len the length to get
+   * \param[in] offset the offset including the handle offset
+   *
+   * \return the request holder
+   */
+  RequestType readThrough(
+    vt::NodeType node, Lock l, T* ptr, std::size_t len, uint64_t offset
+  );
+
 protected:
   HandleKey key_ = {};          /**< The key for identifying the handle */
 };
@@ -59,9 +59,9 @@ template <typename T, HandleEnum E, typename I>
 void Handle<
   T,E,I,typename std::enable_if_t<std::is_same<I,vt::NodeType>::value>
 >::get(
-  vt::NodeType node, T* ptr, std::size_t len, int offset, Lock l
+  vt::NodeType node, T* ptr, std::size_t len, uint64_t offset, Lock l
 ) {
-  return vt::theHandleRDMA()->getEntry<T,E>(key_).get(node, l, ptr, len, offset + this->hoff());
+  readThrough(node, l, ptr, len, offset + this->hoff());
 }
 
 template <typename T, HandleEnum E, typename I>
@@ -71,16 +71,16 @@ typename Handle<
 Handle<
   T,E,I,typename std::enable_if_t<std::is_same<I,vt::NodeType>::value>
 >::rget(
-  vt::NodeType node, T* ptr, std::size_t len, int offset, Lock l
+  vt::NodeType node, T* ptr, std::size_t len, uint64_t offset, Lock l
 ) {
-    return vt::theHandleRDMA()->getEntry<T,E>(key_).rget(node, l, ptr, len, offset + this->hoff());
+  return readThrough(node, l, ptr, len, offset + this->hoff());
 }
 
 template <typename T, HandleEnum E, typename I>
 void Handle<
   T,E,I,typename std::enable_if_t<std::is_same<I,vt::NodeType>::value>
 >::get(
-  vt::NodeType node, std::size_t len, int offset, [[maybe_unused]] Lock l
+  vt::NodeType node, std::size_t len, uint64_t offset, [[maybe_unused]] Lock l
 ) {
   rget(node, len, offset);
 }
@@ -91,12 +91,10 @@ typename Handle<
 >::RequestType
 Handle<
   T,E,I,typename std::enable_if_t<std::is_same<I,vt::NodeType>::value>
->::rget(vt::NodeType node, std::size_t len, int offset, Lock l) {
+>::rget(vt::NodeType node, std::size_t len, uint64_t offset, Lock l) {
   if (this->getBuffer() == nullptr) {
     auto ptr = std::make_unique<T[]>(len);
-    auto r = vt::theHandleRDMA()->getEntry<T,E>(key_).rget(
-      node, l, ptr.get(), len, offset + this->hoff()
-    );
+    auto r = readThrough(node, l, ptr.get(), len, offset + this->hoff());
     r.addAction([cptr=std::move(ptr),actions=this->actions_]{
       for (auto&& action : actions) {
         action(cptr.get());
@@ -104,7 +102,7 @@ Handle<
     });
     return r;
   } else {
-    auto r = vt::theHandleRDMA()->getEntry<T,E>(key_).rget(
+    auto r = readThrough(
       node, l, this->user_buffer_, len, offset + this->hoff()
     );
     r.addAction([buffer=this->user_buffer_,actions=this->actions_]{
@@ -120,7 +118,7 @@ template <typename T, HandleEnum E, typename I>
 void Handle<
   T,E,I,typename std::enable_if_t<std::is_same<I,vt::NodeType>::value>
 >::put(
-  vt::NodeType node, T* ptr, std::size_t len, int offset, Lock l
+  vt::NodeType node, T* ptr, std::size_t len, uint64_t offset, Lock l
 ) {
   return vt::theHandleRDMA()->getEntry<T,E>(key_).put(node, l, ptr, len, offset + this->hoff());
 }
@@ -130,7 +128,7 @@ typename Handle<
   T,E,I,typename std::enable_if_t<std::is_same<I,vt::NodeType>::value>
 >::RequestType
 Handle<T,E,I,typename std::enable_if_t<std::is_same<I,vt::NodeType>::value>>::rput(
-  vt::NodeType node, T* ptr, std::size_t len, int offset, Lock l
+  vt::NodeType node, T* ptr, std::size_t len, uint64_t offset, Lock l
 ) {
   return vt::theHandleRDMA()->getEntry<T,E>(key_).rput(node, l, ptr, len, offset + this->hoff());
 }
@@ -139,7 +137,7 @@ template <typename T, HandleEnum E, typename I>
 void Handle<
   T,E,I,typename std::enable_if_t<std::is_same<I,vt::NodeType>::value>
 >::accum(
-  vt::NodeType node, T* ptr, std::size_t len, int offset, MPI_Op op, Lock l
+  vt::NodeType node, T* ptr, std::size_t len, uint64_t offset, MPI_Op op, Lock l
 ) {
   return vt::theHandleRDMA()->getEntry<T,E>(key_).accum(node, l, ptr, len, offset + this->hoff(), op);
 }
@@ -151,7 +149,7 @@ typename Handle<
 Handle<
   T,E,I,typename std::enable_if_t<std::is_same<I,vt::NodeType>::value>
 >::raccum(
-  vt::NodeType node, T* ptr, std::size_t len, int offset, MPI_Op op, Lock l
+  vt::NodeType node, T* ptr, std::size_t len, uint64_t offset, MPI_Op op, Lock l
 ) {
   return vt::theHandleRDMA()->getEntry<T,E>(key_).raccum(node, l, ptr, len, offset + this->hoff(), op);
 }
@@ -160,7 +158,7 @@ template <typename T, HandleEnum E, typename I>
 T Handle<
   T,E,I,typename std::enable_if_t<std::is_same<I,vt::NodeType>::value>
 >::fetchOp(
-  vt::NodeType node, T ptr, int offset, MPI_Op op, Lock l
+  vt::NodeType node, T ptr, uint64_t offset, MPI_Op op, Lock l
 ) {
   return vt::theHandleRDMA()->getEntry<T,E>(key_).fetchOp(node, l, ptr, offset, op);
 }
@@ -270,6 +268,54 @@ void Handle<
   this->lock_ = nullptr;
 }
 
+template <typename T, HandleEnum E, typename I>
+void Handle<
+  T,E,I,typename std::enable_if_t<std::is_same<I,vt::NodeType>::value>
+>::enableReadCache(std::size_t page_count) {
+  vt::theHandleRDMA()->getEntry<T,E>(key_).enableReadCache(page_count);
+}
+
+template <typename T, HandleEnum E, typename I>
+void Handle<
+  T,E,I,typename std::enable_if_t<std::is_same<I,vt::NodeType>::value>
+>::disableReadCache() {
+  vt::theHandleRDMA()->getEntry<T,E>(key_).disableReadCache();
+}
+
+template <typename T, HandleEnum E, typename I>
+typename Handle<
+  T,E,I,typename std::enable_if_t<std::is_same<I,vt::NodeType>::value>
+>::RequestType
+Handle<
+  T,E,I,typename std::enable_if_t<std::is_same<I,vt::NodeType>::value>
+>::readThrough(
+  vt::NodeType node, Lock l, T* ptr, std::size_t len, uint64_t offset
+) {
+  auto mgr = vt::theHandleRDMA();
+  auto& holder = mgr->getEntry<T,E>(key_);
+  // Targets on this node are read directly from (shared) memory
+  if (
+    holder.hasReadCache() and node != theContext()->getNode() and
+    not holder.isShared(node)
+  ) {
+    mgr->recordReadCache(
+      holder.getCached(
+        node, l, ptr, len, offset, mgr->getReadCacheGeneration()
+      )
+    );
+    return RequestType{};
+  }
+  return holder.rget(node, l, ptr, len, offset);
+}
+
+template <typename T, HandleEnum E, typename I>
+Batch<T, E> Handle<
+  T,E,I,typename std::enable_if_t<std::is_same<I,vt::NodeType>::value>
+>::makeBatch() {
+  vtAssert(this->lock_ == nullptr, "Handle must be unlocked to open a batch");
+  return Batch<T, E>{key_, this->hoff()};
+}
+
 }} /* end namespace vt::rdma */
 
 #endif /*INCLUDED_VT_RDMAHANDLE_HANDLE_NODE_IMPL_H*/
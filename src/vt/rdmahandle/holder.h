@@ -48,6 +48,8 @@
 #include "vt/rdmahandle/common.h"
 #include "vt/rdmahandle/request_holder.h"
 #include "vt/rdmahandle/lock_mpi.h"
+#include "vt/rdmahandle/read_cache.h"
+#include "vt/rdmahandle/shm_node.h"
 
 #include <unordered_map>
 #include <vector>
@@ -71,10 +73,15 @@ private:
     HandleKey key, ElemType lin, Handle<T,E> han, std::size_t size,
     bool uniform_size
   );
-  void allocateDataWindow(std::size_t const in_len = 0);
+  void allocateDataWindow(
+    std::size_t const in_len = 0, ShmNode const* shm = nullptr
+  );
+  void allocateSharedData(std::size_t const len, ShmNode const* shm);
 
 public:
   std::shared_ptr<LockMPI> lock(Lock l, vt::NodeType node);
+  void lockAll(int assert = 0);
+  void unlockAll();
 
 public:
   void deallocate();
@@ -85,25 +92,34 @@ public:
   std::size_t getCount(vt::NodeType node, Lock l = Lock::Shared);
 
   RequestHolder rget(
-    vt::NodeType node, Lock l, T* ptr, std::size_t len, int offset
+    vt::NodeType node, Lock l, T* ptr, std::size_t len, uint64_t offset
   );
-  void get(vt::NodeType node, Lock l, T* ptr, std::size_t len, int offset);
+  void get(vt::NodeType node, Lock l, T* ptr, std::size_t len, uint64_t offset);
 
   RequestHolder rput(
-    vt::NodeType node, Lock l, T* ptr, std::size_t len, int offset
+    vt::NodeType node, Lock l, T* ptr, std::size_t len, uint64_t offset
   );
-  void put(vt::NodeType node, Lock l, T* ptr, std::size_t len, int offset);
+  void put(vt::NodeType node, Lock l, T* ptr, std::size_t len, uint64_t offset);
 
   RequestHolder raccum(
-    vt::NodeType node, Lock l, T* ptr, std::size_t len, int offset,
+    vt::NodeType node, Lock l, T* ptr, std::size_t len, uint64_t offset,
     MPI_Op op
   );
   void accum(
-    vt::NodeType node, Lock l, T* ptr, std::size_t len, int offset,
+    vt::NodeType node, Lock l, T* ptr, std::size_t len, uint64_t offset,
     MPI_Op op
   );
 
-  T fetchOp(vt::NodeType node, Lock l, T ptr, int offset, MPI_Op op);
+  T fetchOp(vt::NodeType node, Lock l, T ptr, uint64_t offset, MPI_Op op);
+
+  void enableReadCache(std::size_t page_count);
+  void disableReadCache();
+  bool hasReadCache() const { return read_cache_ != nullptr; }
+  ReadCacheAccess getCached(
+    vt::NodeType node, Lock l, T* ptr, std::size_t len, uint64_t offset,
+    uint64_t generation
+  );
+  void invalidateReadCache(vt::NodeType node);
 
   void fence(int assert = 0);
   void sync();
@@ -113,6 +129,21 @@ public:
 
   bool isUniform() const { return uniform_size_; }
 
+  /**
+   * \brief Whether operations on a target are direct loads/stores through
+   * shared memory
+   *
+   * \param[in] node the target
+   */
+  bool isShared(vt::NodeType node) const { return sharedBase(node) != nullptr; }
+
+private:
+  T* sharedBase(vt::NodeType node) const;
+  static bool isSharedOp(Lock l, MPI_Op op);
+  static void applySharedOp(T* base, T const* ptr, std::size_t len, MPI_Op op);
+
+public:
+
   template <typename SerializerT>
   void serialize(SerializerT& s) {
     s | key_
@@ -138,6 +169,12 @@ private:
   bool mpi2_ = false;
   bool uniform_size_ = false;
   Handle<T,E> handle_;
+  std::unique_ptr<ReadCache<T>> read_cache_ = nullptr;
+  /// Set when the data is allocated in node shared memory
+  ShmNode const* shm_ = nullptr;
+  MPI_Win shm_window_;
+  /// Base of each node-local rank's data, indexed by node-local rank
+  std::vector<T*> shm_base_;
 };
 
 }} /* end namespace vt::rdma */
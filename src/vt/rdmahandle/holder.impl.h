@@ -47,6 +47,10 @@
 #include "vt/config.h"
 #include "vt/runtime/mpi_access.h"
 
+#include <algorithm>
+#include <atomic>
+#include <type_traits>
+
 namespace vt { namespace rdma {
 
 
@@ -63,7 +67,9 @@ void Holder<T,E>::addHandle(
 }
 
 template <typename T, HandleEnum E>
-void Holder<T,E>::allocateDataWindow(std::size_t const in_len) {
+void Holder<T,E>::allocateDataWindow(
+  std::size_t const in_len, ShmNode const* shm
+) {
   std::size_t len = in_len == 0 ? count_ : in_len;
   vt_debug_print(
     terse, rdma,
@@ -71,11 +77,25 @@ void Holder<T,E>::allocateDataWindow(std::size_t const in_len) {
   );
   // Allocate data window
   MPI_Comm comm = theContext()->getComm();
-  MPI_Alloc_mem(len * sizeof(T), MPI_INFO_NULL, &data_base_);
+  if (shm != nullptr) {
+    allocateSharedData(len, shm);
+  } else {
+    MPI_Alloc_mem(len * sizeof(T), MPI_INFO_NULL, &data_base_);
+  }
   MPI_Win_create(
     data_base_, len * sizeof(T), sizeof(T), MPI_INFO_NULL, comm,
     &data_window_
   );
+  if (shm != nullptr) {
+    // Direct loads/stores are only coherent with RMA on the data window under
+    // the unified memory model; otherwise, keep all operations on MPI
+    int* model = nullptr;
+    int flag = 0;
+    MPI_Win_get_attr(data_window_, MPI_WIN_MODEL, &model, &flag);
+    if (not flag or *model != MPI_WIN_UNIFIED) {
+      shm_base_.clear();
+    }
+  }
   if (not uniform_size_) {
     // Allocate control window
     MPI_Alloc_mem(sizeof(uint64_t), MPI_INFO_NULL, &control_base_);
@@ -98,6 +118,80 @@ void Holder<T,E>::allocateDataWindow(std::size_t const in_len) {
   ready_ = true;
 }
 
+template <typename T, HandleEnum E>
+void Holder<T,E>::allocateSharedData(
+  std::size_t const len, ShmNode const* shm
+) {
+  // Let the implementation place each rank's segment in memory local to it
+  MPI_Info info;
+  MPI_Info_create(&info);
+  MPI_Info_set(info, "alloc_shared_noncontig", "true");
+  MPI_Win_allocate_shared(
+    len * sizeof(T), sizeof(T), info, shm->getComm(), &data_base_,
+    &shm_window_
+  );
+  MPI_Info_free(&info);
+
+  shm_ = shm;
+  shm_base_.resize(shm->getSize());
+  for (int r = 0; r < shm->getSize(); r++) {
+    MPI_Aint size = 0;
+    int disp_unit = 0;
+    T* base = nullptr;
+    MPI_Win_shared_query(shm_window_, r, &size, &disp_unit, &base);
+    shm_base_[r] = size == 0 ? nullptr : base;
+  }
+
+  vt_debug_print(
+    normal, rdma,
+    "allocateSharedData: len={}, node ranks={}\n", len, shm->getSize()
+  );
+}
+
+template <typename T, HandleEnum E>
+T* Holder<T,E>::sharedBase(vt::NodeType node) const {
+  if (shm_ == nullptr or shm_base_.empty()) {
+    return nullptr;
+  }
+  auto const r = shm_->getLocalRank(node);
+  return r == ShmNode::no_rank ? nullptr : shm_base_[r];
+}
+
+template <typename T, HandleEnum E>
+/*static*/ bool Holder<T,E>::isSharedOp(Lock l, MPI_Op op) {
+  // Concurrent MPI accumulates to the target are only excluded under an
+  // exclusive lock, and only element-wise ops on arithmetic types apply
+  if constexpr (std::is_arithmetic<T>::value) {
+    return l == Lock::Exclusive and (
+      op == MPI_SUM or op == MPI_PROD or op == MPI_MAX or op == MPI_MIN or
+      op == MPI_REPLACE or op == MPI_NO_OP
+    );
+  } else {
+    return false;
+  }
+}
+
+template <typename T, HandleEnum E>
+/*static*/ void Holder<T,E>::applySharedOp(
+  T* base, T const* ptr, std::size_t len, MPI_Op op
+) {
+  if constexpr (std::is_arithmetic<T>::value) {
+    for (std::size_t i = 0; i < len; i++) {
+      if (op == MPI_SUM) {
+        base[i] += ptr[i];
+      } else if (op == MPI_PROD) {
+        base[i] *= ptr[i];
+      } else if (op == MPI_MAX) {
+        base[i] = std::max(base[i], ptr[i]);
+      } else if (op == MPI_MIN) {
+        base[i] = std::min(base[i], ptr[i]);
+      } else if (op == MPI_REPLACE) {
+        base[i] = ptr[i];
+      }
+    }
+  }
+}
+
 template <typename T, HandleEnum E>
 std::size_t Holder<T,E>::getCount(vt::NodeType node, Lock l) {
   uint64_t result = 0;
@@ -120,7 +214,12 @@ void Holder<T,E>::deallocate() {
   VT_ALLOW_MPI_CALLS;
   if (E == HandleEnum::StaticSize and ready_) {
     MPI_Win_free(&data_window_);
-    MPI_Free_mem(data_base_);
+    if (shm_ != nullptr) {
+      // Frees the shared memory segment
+      MPI_Win_free(&shm_window_);
+    } else {
+      MPI_Free_mem(data_base_);
+    }
     if (not uniform_size_) {
       MPI_Win_free(&control_window_);
       MPI_Free_mem(control_base_);
@@ -133,6 +232,20 @@ std::shared_ptr<LockMPI> Holder<T,E>::lock(Lock l, vt::NodeType node) {
   return std::make_shared<LockMPI>(l, node, data_window_);
 }
 
+template <typename T, HandleEnum E>
+void Holder<T,E>::lockAll(int assert) {
+  vt_debug_print(verbose, rdma, "MPI_Win_lock_all({}, window);\n", assert);
+  VT_ALLOW_MPI_CALLS;
+  MPI_Win_lock_all(assert, data_window_);
+}
+
+template <typename T, HandleEnum E>
+void Holder<T,E>::unlockAll() {
+  vt_debug_print(verbose, rdma, "MPI_Win_unlock_all(window);\n");
+  VT_ALLOW_MPI_CALLS;
+  MPI_Win_unlock_all(data_window_);
+}
+
 template <typename T, HandleEnum E>
 template <typename Callable>
 void Holder<T,E>::access(Lock l, Callable fn, std::size_t offset) {
@@ -144,12 +257,21 @@ void Holder<T,E>::access(Lock l, Callable fn, std::size_t offset) {
 
 template <typename T, HandleEnum E>
 RequestHolder Holder<T,E>::rget(
-  vt::NodeType node, Lock l, T* ptr, std::size_t len, int offset
+  vt::NodeType node, Lock l, T* ptr, std::size_t len, uint64_t offset
 ) {
   auto mpi_type = TypeMPI<T>::getType();
   auto mpi_type_str = TypeMPI<T>::getTypeStr();
   RequestHolder r;
-  if (mpi2_) {
+  if (auto base = sharedBase(node)) {
+    LockMPI _scope_lock(l, node, data_window_);
+    vt_debug_print(
+      verbose, rdma,
+      "shm get: ptr={}, len={}, node={}, offset={}\n",
+      print_ptr(ptr), len, node, offset
+    );
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    std::copy(base + offset, base + offset + len, ptr);
+  } else if (mpi2_) {
     r.add([=]{
       LockMPI _scope_lock(l, node, data_window_);
       vt_debug_print(
@@ -175,19 +297,29 @@ RequestHolder Holder<T,E>::rget(
 
 template <typename T, HandleEnum E>
 void Holder<T,E>::get(
-  vt::NodeType node, Lock l, T* ptr, std::size_t len, int offset
+  vt::NodeType node, Lock l, T* ptr, std::size_t len, uint64_t offset
 ) {
   rget(node, l, ptr, len, offset);
 }
 
 template <typename T, HandleEnum E>
 RequestHolder Holder<T,E>::rput(
-  vt::NodeType node, Lock l, T* ptr, std::size_t len, int offset
+  vt::NodeType node, Lock l, T* ptr, std::size_t len, uint64_t offset
 ) {
+  invalidateReadCache(node);
   auto mpi_type = TypeMPI<T>::getType();
   auto mpi_type_str = TypeMPI<T>::getTypeStr();
   RequestHolder r;
-  if (mpi2_) {
+  if (auto base = sharedBase(node)) {
+    LockMPI _scope_lock(l, node, data_window_);
+    vt_debug_print(
+      verbose, rdma,
+      "shm put: ptr={}, len={}, node={}, offset={}\n",
+      print_ptr(ptr), len, node, offset
+    );
+    std::copy(ptr, ptr + len, base + offset);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+  } else if (mpi2_) {
     r.add([=]{
       LockMPI _scope_lock(l, node, data_window_);
       vt_debug_print(
@@ -213,17 +345,24 @@ RequestHolder Holder<T,E>::rput(
 
 template <typename T, HandleEnum E>
 void Holder<T,E>::put(
-  vt::NodeType node, Lock l, T* ptr, std::size_t len, int offset
+  vt::NodeType node, Lock l, T* ptr, std::size_t len, uint64_t offset
 ) {
   rput(node, l, ptr, len, offset);
 }
 
 template <typename T, HandleEnum E>
-T Holder<T,E>::fetchOp(vt::NodeType node, Lock l, T in, int offset, MPI_Op op) {
+T Holder<T,E>::fetchOp(vt::NodeType node, Lock l, T in, uint64_t offset, MPI_Op op) {
+  invalidateReadCache(node);
   auto mpi_type = TypeMPI<T>::getType();
   auto mpi_type_str = TypeMPI<T>::getTypeStr();
   T out;
-  {
+  if (auto base = sharedBase(node); base != nullptr and isSharedOp(l, op)) {
+    LockMPI _scope_lock(l, node, data_window_);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    out = base[offset];
+    applySharedOp(base + offset, &in, 1, op);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+  } else {
     LockMPI _scope_lock(l, node, data_window_);
     vt_debug_print(
       verbose, rdma,
@@ -238,13 +377,24 @@ T Holder<T,E>::fetchOp(vt::NodeType node, Lock l, T in, int offset, MPI_Op op) {
 
 template <typename T, HandleEnum E>
 RequestHolder Holder<T,E>::raccum(
-  vt::NodeType node, Lock l, T* ptr, std::size_t len, int offset,
+  vt::NodeType node, Lock l, T* ptr, std::size_t len, uint64_t offset,
   MPI_Op op
 ) {
+  invalidateReadCache(node);
   auto mpi_type = TypeMPI<T>::getType();
   auto mpi_type_str = TypeMPI<T>::getTypeStr();
   RequestHolder r;
-  if (mpi2_) {
+  if (auto base = sharedBase(node); base != nullptr and isSharedOp(l, op)) {
+    LockMPI _scope_lock(l, node, data_window_);
+    vt_debug_print(
+      verbose, rdma,
+      "shm accum: ptr={}, len={}, node={}, offset={}\n",
+      print_ptr(ptr), len, node, offset
+    );
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    applySharedOp(base + offset, ptr, len, op);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+  } else if (mpi2_) {
     r.add([=]{
       LockMPI _scope_lock(l, node, data_window_);
       vt_debug_print(
@@ -274,14 +424,115 @@ RequestHolder Holder<T,E>::raccum(
 
 template <typename T, HandleEnum E>
 void Holder<T,E>::accum(
-  vt::NodeType node, Lock l, T* ptr, std::size_t len, int offset,
+  vt::NodeType node, Lock l, T* ptr, std::size_t len, uint64_t offset,
   MPI_Op op
 ) {
   raccum(node, l, ptr, len, offset, op);
 }
 
+template <typename T, HandleEnum E>
+void Holder<T,E>::enableReadCache(std::size_t page_count) {
+  read_cache_ = std::make_unique<ReadCache<T>>(page_count);
+}
+
+template <typename T, HandleEnum E>
+void Holder<T,E>::disableReadCache() {
+  read_cache_ = nullptr;
+}
+
+template <typename T, HandleEnum E>
+void Holder<T,E>::invalidateReadCache(vt::NodeType node) {
+  if (read_cache_ != nullptr) {
+    read_cache_->invalidate(node);
+  }
+}
+
+template <typename T, HandleEnum E>
+ReadCacheAccess Holder<T,E>::getCached(
+  vt::NodeType node, Lock l, T* ptr, std::size_t len, uint64_t offset,
+  uint64_t generation
+) {
+  ReadCacheAccess access;
+  if (len == 0) {
+    return access;
+  }
+
+  auto& cache = *read_cache_;
+  cache.checkGeneration(generation);
+
+  auto total = cache.getCount(node);
+  if (total == ReadCache<T>::no_count) {
+    total = uniform_size_ ? count_ : getCount(node);
+    cache.setCount(node, total);
+  }
+
+  auto const page_count = cache.getPageCount();
+  auto const begin = static_cast<std::size_t>(offset);
+  auto const end = begin + len;
+  auto const first = begin / page_count;
+  auto const last = (end - 1) / page_count;
+
+  vtAssert(end <= total, "Cached read must be within the target's window");
+
+  std::vector<bool> hit(last - first + 1, true);
+  bool any_miss = false;
+  for (auto p = first; p <= last; p++) {
+    if (cache.find(node, p) == nullptr) {
+      hit[p - first] = false;
+      any_miss = true;
+    }
+  }
+
+  if (any_miss) {
+    // Fetch all the missing pages whole in a single access epoch
+    auto mpi_type = TypeMPI<T>::getType();
+    LockMPI _scope_lock(l, node, data_window_);
+    VT_ALLOW_MPI_CALLS;
+    for (auto p = first; p <= last; p++) {
+      if (not hit[p - first]) {
+        auto const page_begin = p * page_count;
+        auto const page_len = std::min(page_count, total - page_begin);
+        vt_debug_print(
+          verbose, rdma,
+          "cache miss: MPI_Get(page={}, len={}, node={}, offset={})\n",
+          p, page_len, node, page_begin
+        );
+        MPI_Get(
+          cache.insert(node, p), page_len, mpi_type, node, page_begin,
+          page_len, mpi_type, data_window_
+        );
+      }
+    }
+    if (l == Lock::None) {
+      // The caller holds the epoch, so complete the gets before reading
+      MPI_Win_flush(node, data_window_);
+    }
+  }
+
+  for (auto p = first; p <= last; p++) {
+    auto const page_begin = p * page_count;
+    auto const lo = std::max(begin, page_begin);
+    auto const hi = std::min(end, page_begin + page_count);
+    auto const data = cache.find(node, p);
+    std::copy(
+      data + (lo - page_begin), data + (hi - page_begin), ptr + (lo - begin)
+    );
+    if (hit[p - first]) {
+      access.hits_++;
+      access.bytes_saved_ += (hi - lo) * sizeof(T);
+    } else {
+      access.misses_++;
+    }
+  }
+
+  return access;
+}
+
 template <typename T, HandleEnum E>
 void Holder<T,E>::fence(int assert) {
+  if (read_cache_ != nullptr) {
+    read_cache_->invalidate();
+  }
   VT_ALLOW_MPI_CALLS;
   MPI_Win_fence(assert, data_window_);
 }
@@ -45,6 +45,7 @@
 #include "vt/rdmahandle/manager.h"
 #include "vt/objgroup/manager.h"
 #include "vt/collective/collective_alg.h"
+#include "vt/phase/phase_manager.h"
 
 namespace vt { namespace rdma {
 
@@ -52,8 +53,61 @@ Manager::Manager()
   : collective_scope_(theCollective()->makeCollectiveScope())
 { }
 
+void Manager::initialize() {
+  // Remote pages served from handle read caches without an MPI_Get
+  rdmaCacheHitCount = registerCounter(
+    "rdma_cache_hits", "RDMA read cache page hits"
+  );
+
+  // Remote pages fetched into handle read caches
+  rdmaCacheMissCount = registerCounter(
+    "rdma_cache_misses", "RDMA read cache page misses"
+  );
+
+  // Bytes read from handle read caches instead of the network
+  rdmaCacheBytesSaved = registerCounter(
+    "rdma_cache_bytes_saved", "RDMA read cache bytes saved",
+    UnitType::Bytes
+  );
+
+  // Min/max/avg of the per-phase hit rate (percent) of phases with reads
+  rdmaCacheHitRateGauge = registerGauge(
+    "rdma_cache_hit_rate", "RDMA read cache hit rate (%) per phase"
+  );
+}
+
+void Manager::startup() {
+  if (theConfig()->vt_rdma_shm) {
+    // Collective: every rank starts the component in the same order
+    shm_node_ = std::make_unique<ShmNode>(theContext()->getComm());
+  }
+
+  thePhase()->registerHookUnsynchronized(phase::PhaseHook::End, [this]{
+    auto const total = phase_cache_hits_ + phase_cache_misses_;
+    if (total > 0) {
+      rdmaCacheHitRateGauge.update(
+        static_cast<double>(phase_cache_hits_) * 100.0 / total
+      );
+    }
+    phase_cache_hits_ = 0;
+    phase_cache_misses_ = 0;
+
+    // Remote data may change across phases
+    invalidateReadCaches();
+  });
+}
+
+void Manager::recordReadCache(ReadCacheAccess const& access) {
+  rdmaCacheHitCount.increment(access.hits_);
+  rdmaCacheMissCount.increment(access.misses_);
+  rdmaCacheBytesSaved.increment(access.bytes_saved_);
+  phase_cache_hits_ += access.hits_;
+  phase_cache_misses_ += access.misses_;
+}
+
 void Manager::finalize() {
   vt::theObjGroup()->destroyCollective(proxy_);
+  shm_node_ = nullptr;
 }
 
 void Manager::setup(ProxyType in_proxy) {
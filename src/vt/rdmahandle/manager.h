@@ -50,6 +50,7 @@
 #include "vt/rdmahandle/handle_key.h"
 #include "vt/rdmahandle/type_mpi.h"
 #include "vt/rdmahandle/holder.h"
+#include "vt/rdmahandle/shm_node.h"
 #include "vt/rdmahandle/manager.fwd.h"
 #include "vt/objgroup/proxy/proxy_objgroup.h"
 #include "vt/pipe/pipe_manager.h"
@@ -89,6 +90,10 @@ struct Manager : runtime::component::Component<Manager> {
 
   std::string name() override { return "HandleRDMA"; }
 
+  void initialize() override;
+
+  void startup() override;
+
   /**
    * \brief Destroy the component, called when VT is finalized
    */
@@ -216,6 +221,35 @@ public:
   template <typename T, HandleEnum E>
   Holder<T,E>& getEntry(HandleKey const& key);
 
+  /**
+   * \brief Invalidate the read caches of all handles on this node; called
+   * automatically at the end of each phase
+   */
+  void invalidateReadCaches() { read_cache_generation_++; }
+
+  /**
+   * \internal \brief Get the current read cache generation; a read cache
+   * drops its pages when it sees a new generation
+   *
+   * \return the generation
+   */
+  uint64_t getReadCacheGeneration() const { return read_cache_generation_; }
+
+  /**
+   * \internal \brief Record a read served through a handle's read cache
+   *
+   * \param[in] access the page hits/misses and bytes saved
+   */
+  void recordReadCache(ReadCacheAccess const& access);
+
+  /**
+   * \brief Get the ranks sharing this node, if handle windows are allocated
+   * in shared memory (\c --vt_rdma_shm)
+   *
+   * \return the node or \c nullptr when disabled
+   */
+  ShmNode const* getShmNode() const { return shm_node_.get(); }
+
 private:
   static vt::NodeType staticHandleMap(
     vt::Index2D* idx, vt::Index2D*, vt::NodeType
@@ -260,6 +294,21 @@ private:
 
   // Collective scope for MPI operations
   CollectiveScopeType collective_scope_;
+
+  /// Generation of the read caches, bumped to invalidate them all
+  uint64_t read_cache_generation_ = 1;
+
+  /// The ranks on this node when windows are allocated in shared memory
+  std::unique_ptr<ShmNode> shm_node_ = nullptr;
+
+  /// Read cache page hits/misses during the current phase
+  std::size_t phase_cache_hits_ = 0;
+  std::size_t phase_cache_misses_ = 0;
+
+  diagnostic::Counter rdmaCacheHitCount;
+  diagnostic::Counter rdmaCacheMissCount;
+  diagnostic::Counter rdmaCacheBytesSaved;
+  diagnostic::Gauge rdmaCacheHitRateGauge;
 };
 
 template <typename T, HandleEnum E>
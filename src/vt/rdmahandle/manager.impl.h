@@ -119,8 +119,9 @@ void Manager::finishMake(impl::ConstructMsg<T, E, ProxyT>* msg) {
     key.handle_, size, count
   );
   auto& entry = getEntry<T,E>(key);
-  collective_scope_.mpiCollectiveWait([&entry]{
-    entry.allocateDataWindow();
+  auto shm = getShmNode();
+  collective_scope_.mpiCollectiveWait([&entry,shm]{
+    entry.allocateDataWindow(0, shm);
   });
 }
 
@@ -0,0 +1,190 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                 read_cache.h
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_RDMAHANDLE_READ_CACHE_H
+#define INCLUDED_VT_RDMAHANDLE_READ_CACHE_H
+
+#include "vt/config.h"
+
+#include <memory>
+#include <unordered_map>
+
+namespace vt { namespace rdma {
+
+/**
+ * \struct ReadCacheAccess
+ *
+ * \brief Page hits/misses and bytes served from the cache for one read
+ */
+struct ReadCacheAccess {
+  std::size_t hits_ = 0;
+  std::size_t misses_ = 0;
+  std::size_t bytes_saved_ = 0;
+};
+
+/**
+ * \struct ReadCache
+ *
+ * \brief Software cache of remote pages of a handle's data window.
+ *
+ * Pages are fixed-size, aligned blocks of a target's window and are fetched
+ * whole on a miss. The cache is tied to a generation: when the generation
+ * passed in changes (e.g., at a phase boundary) all pages are dropped.
+ */
+template <typename T>
+struct ReadCache {
+  /**
+   * \brief Construct a cache
+   *
+   * \param[in] in_page_count the number of elements in each page
+   */
+  explicit ReadCache(std::size_t in_page_count)
+    : page_count_(in_page_count == 0 ? 1 : in_page_count)
+  { }
+
+  std::size_t getPageCount() const { return page_count_; }
+
+  /**
+   * \brief Drop all pages if the cache generation changed
+   *
+   * \param[in] generation the current generation
+   */
+  void checkGeneration(uint64_t generation) {
+    if (generation != generation_) {
+      invalidate();
+      generation_ = generation;
+    }
+  }
+
+  /**
+   * \brief Find a cached page
+   *
+   * \param[in] node the target
+   * \param[in] page the page number in the target's window
+   *
+   * \return the page data or \c nullptr if it's not cached
+   */
+  T const* find(vt::NodeType node, std::size_t page) const {
+    auto node_iter = pages_.find(node);
+    if (node_iter != pages_.end()) {
+      auto iter = node_iter->second.find(page);
+      if (iter != node_iter->second.end()) {
+        return iter->second.get();
+      }
+    }
+    return nullptr;
+  }
+
+  /**
+   * \brief Allocate a page to be fetched into
+   *
+   * \param[in] node the target
+   * \param[in] page the page number in the target's window
+   *
+   * \return the page storage
+   */
+  T* insert(vt::NodeType node, std::size_t page) {
+    auto& slot = pages_[node][page];
+    if (slot == nullptr) {
+      slot = std::make_unique<T[]>(page_count_);
+      num_pages_++;
+    }
+    return slot.get();
+  }
+
+  /**
+   * \brief Drop all pages cached from a target
+   *
+   * \param[in] node the target
+   */
+  void invalidate(vt::NodeType node) {
+    auto iter = pages_.find(node);
+    if (iter != pages_.end()) {
+      num_pages_ -= iter->second.size();
+      pages_.erase(iter);
+    }
+  }
+
+  /**
+   * \brief Drop all pages
+   */
+  void invalidate() {
+    pages_.clear();
+    num_pages_ = 0;
+  }
+
+  /**
+   * \brief Get the cached window count of a target, if known
+   *
+   * \param[in] node the target
+   *
+   * \return the count, or \c no_count
+   */
+  std::size_t getCount(vt::NodeType node) const {
+    auto iter = counts_.find(node);
+    return iter == counts_.end() ? no_count : iter->second;
+  }
+
+  void setCount(vt::NodeType node, std::size_t count) {
+    counts_[node] = count;
+  }
+
+  std::size_t getNumPages() const { return num_pages_; }
+
+  static constexpr std::size_t const no_count = ~std::size_t{0};
+
+private:
+  std::size_t page_count_ = 1;
+  uint64_t generation_ = 0;
+  std::size_t num_pages_ = 0;
+  std::unordered_map<
+    vt::NodeType, std::unordered_map<std::size_t, std::unique_ptr<T[]>>
+  > pages_;
+  /// Window counts do not change for the life of a handle, so they are kept
+  /// across invalidations
+  std::unordered_map<vt::NodeType, std::size_t> counts_;
+};
+
+}} /* end namespace vt::rdma */
+
+#endif /*INCLUDED_VT_RDMAHANDLE_READ_CACHE_H*/
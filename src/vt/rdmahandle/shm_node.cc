@@ -0,0 +1,94 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                 shm_node.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include "vt/config.h"
+#include "vt/rdmahandle/shm_node.h"
+
+#include <numeric>
+
+namespace vt { namespace rdma {
+
+ShmNode::ShmNode(MPI_Comm comm) {
+  int world_rank = 0;
+  int world_size = 0;
+  MPI_Comm_rank(comm, &world_rank);
+  MPI_Comm_size(comm, &world_size);
+
+  MPI_Comm_split_type(
+    comm, MPI_COMM_TYPE_SHARED, world_rank, MPI_INFO_NULL, &node_comm_
+  );
+  MPI_Comm_size(node_comm_, &node_size_);
+
+  MPI_Group world_group, node_group;
+  MPI_Comm_group(comm, &world_group);
+  MPI_Comm_group(node_comm_, &node_group);
+
+  std::vector<int> world_ranks(world_size);
+  std::iota(world_ranks.begin(), world_ranks.end(), 0);
+  local_rank_.resize(world_size);
+  MPI_Group_translate_ranks(
+    world_group, world_size, world_ranks.data(), node_group,
+    local_rank_.data()
+  );
+  for (auto&& r : local_rank_) {
+    if (r == MPI_UNDEFINED) {
+      r = no_rank;
+    }
+  }
+
+  MPI_Group_free(&world_group);
+  MPI_Group_free(&node_group);
+
+  vt_debug_print(
+    normal, rdma,
+    "ShmNode: node size={}, world size={}\n", node_size_, world_size
+  );
+}
+
+ShmNode::~ShmNode() {
+  if (node_comm_ != MPI_COMM_NULL) {
+    MPI_Comm_free(&node_comm_);
+  }
+}
+
+}} /* end namespace vt::rdma */
@@ -0,0 +1,107 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                  shm_node.h
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_RDMAHANDLE_SHM_NODE_H
+#define INCLUDED_VT_RDMAHANDLE_SHM_NODE_H
+
+#include "vt/config.h"
+
+#include <vector>
+
+namespace vt { namespace rdma {
+
+/**
+ * \struct ShmNode
+ *
+ * \brief The ranks sharing a physical node with this rank, used to allocate
+ * handle windows in shared memory.
+ *
+ * Holds a communicator over the ranks of this node (split with
+ * \c MPI_COMM_TYPE_SHARED) and the translation from a rank in the runtime
+ * communicator to its rank in the node communicator.
+ */
+struct ShmNode {
+  /**
+   * \brief Split the node communicator; collective over all ranks
+   *
+   * \param[in] comm the runtime communicator
+   */
+  explicit ShmNode(MPI_Comm comm);
+
+  ShmNode(ShmNode const&) = delete;
+  ShmNode& operator=(ShmNode const&) = delete;
+
+  ~ShmNode();
+
+  /**
+   * \brief Get the node communicator
+   */
+  MPI_Comm getComm() const { return node_comm_; }
+
+  /**
+   * \brief Get the number of ranks on this node
+   */
+  int getSize() const { return node_size_; }
+
+  /**
+   * \brief Get the rank in the node communicator of a rank
+   *
+   * \param[in] node the rank in the runtime communicator
+   *
+   * \return the node-local rank or \c no_rank if it's on another node
+   */
+  int getLocalRank(vt::NodeType node) const {
+    return local_rank_[static_cast<std::size_t>(node)];
+  }
+
+  static constexpr int const no_rank = -1;
+
+private:
+  MPI_Comm node_comm_ = MPI_COMM_NULL;
+  int node_size_ = 0;
+  std::vector<int> local_rank_;
+};
+
+}} /* end namespace vt::rdma */
+
+#endif /*INCLUDED_VT_RDMAHANDLE_SHM_NODE_H*/
@@ -52,6 +52,7 @@
 #include "vt/topos/mapping/dense/dense.h"
 
 #include <unordered_map>
+#include <vector>
 
 namespace vt { namespace rdma {
 
@@ -80,6 +81,25 @@ private:
   };
 
 public:
+  /**
+   * \struct PutEntry
+   *
+   * \brief One put of a group targeting a single node, with the offset
+   * already resolved to the node's data window
+   */
+  struct PutEntry {
+    PutEntry() = default;
+    PutEntry(T* in_ptr, uint64_t in_len, uint64_t in_offset)
+      : ptr_(in_ptr),
+        len_(in_len),
+        offset_(in_offset)
+    { }
+    T* ptr_ = nullptr;
+    uint64_t len_ = 0;
+    uint64_t offset_ = 0;
+  };
+
+
   void initialize(
     ProxyType in_proxy, bool in_is_migratable, IndexT in_range,
     vt::HandlerType map_han, bool in_dense_start_with_zero
@@ -97,31 +117,33 @@ public:
 
   IndexInfo resolveLocation(IndexT const& idx);
 
-  void get(IndexT const& idx, Lock l, T* ptr, uint64_t len, int offset);
+  void get(IndexT const& idx, Lock l, T* ptr, uint64_t len, uint64_t offset);
 
   std::size_t getCount(IndexT const& idx, Lock l = Lock::Shared);
 
   RequestHolder rget(
-    IndexT const& idx, Lock l, T* ptr, uint64_t len, int offset
+    IndexT const& idx, Lock l, T* ptr, uint64_t len, uint64_t offset
   );
 
   RequestHolder rput(
-    IndexT const& idx, Lock l, T* ptr, uint64_t len, int offset
+    IndexT const& idx, Lock l, T* ptr, uint64_t len, uint64_t offset
   );
 
-  void put(IndexT const& idx, Lock l, T* ptr, uint64_t len, int offset);
+  void put(IndexT const& idx, Lock l, T* ptr, uint64_t len, uint64_t offset);
+
+  void putGroup(NodeType node, Lock l, std::vector<PutEntry> const& puts);
 
   RequestHolder raccum(
-    IndexT const& idx, Lock l, T* ptr, uint64_t len, int offset,
+    IndexT const& idx, Lock l, T* ptr, uint64_t len, uint64_t offset,
     MPI_Op op
   );
 
   void accum(
-    IndexT const& idx, Lock l, T* ptr, uint64_t len, int offset,
+    IndexT const& idx, Lock l, T* ptr, uint64_t len, uint64_t offset,
     MPI_Op op
   );
 
-  T fetchOp(IndexT const& idx, Lock l, T ptr, int offset, MPI_Op op);
+  T fetchOp(IndexT const& idx, Lock l, T ptr, uint64_t offset, MPI_Op op);
 
   bool isUniform() const { return uniform_size_; }
 
@@ -144,6 +166,10 @@ public:
 
   bool ready() const { return ready_; }
 
+  uint64_t getLayoutVersion() const { return layout_version_; }
+
+  void enableReadCache(std::size_t page_count);
+
   uint64_t totalLocalCount() const;
 
   std::size_t getNumHandles() const;
@@ -198,6 +224,8 @@ protected:
   std::unordered_map<IndexT, int> ordered_local_offset_;
   bool dense_start_with_zero_ = true;
   std::size_t deleted_count_ = 0;
+  uint64_t layout_version_ = 0;
+  std::size_t read_cache_page_count_ = 0;
 };
 
 }} /* end namespace vt::rdma */
@@ -325,7 +325,7 @@ IndexInfo SubHandle<T,E,IndexT>::resolveLocation(IndexT const& idx) {
 
 template <typename T, HandleEnum E, typename IndexT>
 void SubHandle<T,E,IndexT>::get(
-  IndexT const& idx, Lock l, T* ptr, uint64_t len, int offset
+  IndexT const& idx, Lock l, T* ptr, uint64_t len, uint64_t offset
 ) {
   auto info = resolveLocation(idx);
   auto node = info.getNode();
@@ -345,7 +345,7 @@ std::size_t SubHandle<T,E,IndexT>::getCount(IndexT const& idx, Lock) {
 
 template <typename T, HandleEnum E, typename IndexT>
 RequestHolder SubHandle<T,E,IndexT>::rget(
-  IndexT const& idx, Lock l, T* ptr, uint64_t len, int offset
+  IndexT const& idx, Lock l, T* ptr, uint64_t len, uint64_t offset
 ) {
   // @todo: make the location lookup async
   auto info = resolveLocation(idx);
@@ -356,7 +356,7 @@ RequestHolder SubHandle<T,E,IndexT>::rget(
 
 template <typename T, HandleEnum E, typename IndexT>
 RequestHolder SubHandle<T,E,IndexT>::rput(
-  IndexT const& idx, Lock l, T* ptr, uint64_t len, int offset
+  IndexT const& idx, Lock l, T* ptr, uint64_t len, uint64_t offset
 ) {
   // @todo: make the location lookup async
   auto info = resolveLocation(idx);
@@ -367,7 +367,7 @@ RequestHolder SubHandle<T,E,IndexT>::rput(
 
 template <typename T, HandleEnum E, typename IndexT>
 void SubHandle<T,E,IndexT>::put(
-  IndexT const& idx, Lock l, T* ptr, uint64_t len, int offset
+  IndexT const& idx, Lock l, T* ptr, uint64_t len, uint64_t offset
 ) {
   auto info = resolveLocation(idx);
   auto node = info.getNode();
@@ -375,9 +375,45 @@ void SubHandle<T,E,IndexT>::put(
   data_handle_.put(node, ptr, len, offset + chunk_offset, l);
 }
 
+template <typename T, HandleEnum E, typename IndexT>
+void SubHandle<T,E,IndexT>::putGroup(
+  NodeType node, Lock l, std::vector<PutEntry> const& puts
+) {
+  if (puts.size() == 0) {
+    return;
+  }
+
+  // Open one access epoch on the target for the whole group
+  data_handle_.lock(l, node);
+
+  std::vector<RequestHolder> reqs;
+  reqs.reserve(puts.size());
+  for (auto&& p : puts) {
+    reqs.emplace_back(
+      data_handle_.rput(node, p.ptr_, p.len_, p.offset_, Lock::None)
+    );
+  }
+  for (auto&& r : reqs) {
+    r.wait();
+  }
+  reqs.clear();
+
+  data_handle_.unlock();
+}
+
+template <typename T, HandleEnum E, typename IndexT>
+void SubHandle<T,E,IndexT>::enableReadCache(std::size_t page_count) {
+  read_cache_page_count_ = page_count;
+  if (page_count == 0) {
+    data_handle_.disableReadCache();
+  } else {
+    data_handle_.enableReadCache(page_count);
+  }
+}
+
 template <typename T, HandleEnum E, typename IndexT>
 RequestHolder SubHandle<T,E,IndexT>::raccum(
-  IndexT const& idx, Lock l, T* ptr, uint64_t len, int offset,
+  IndexT const& idx, Lock l, T* ptr, uint64_t len, uint64_t offset,
   MPI_Op op
 ) {
   // @todo: make the location lookup async
@@ -389,7 +425,7 @@ RequestHolder SubHandle<T,E,IndexT>::raccum(
 
 template <typename T, HandleEnum E, typename IndexT>
 void SubHandle<T,E,IndexT>::accum(
-  IndexT const& idx, Lock l, T* ptr, uint64_t len, int offset,
+  IndexT const& idx, Lock l, T* ptr, uint64_t len, uint64_t offset,
   MPI_Op op
 ) {
   auto info = resolveLocation(idx);
@@ -400,7 +436,7 @@ void SubHandle<T,E,IndexT>::accum(
 
 template <typename T, HandleEnum E, typename IndexT>
 T SubHandle<T,E,IndexT>::fetchOp(
-  IndexT const& idx, Lock l, T ptr, int offset, MPI_Op op
+  IndexT const& idx, Lock l, T ptr, uint64_t offset, MPI_Op op
 ) {
   auto info = resolveLocation(idx);
   auto node = info.getNode();
@@ -709,9 +745,15 @@ void SubHandle<T,E,IndexT>::checkChanged(impl::ReduceLBMsg* msg) {
     // Make the new sub-handles, with the new local indices now mapped here
     makeSubHandles(false);
 
+    // The read cache belongs to the old data window
+    if (read_cache_page_count_ != 0) {
+      data_handle_.enableReadCache(read_cache_page_count_);
+    }
+
     // Invalidate the cache, since handles have migrated and the cached
     // locations may not be valid anymore
     cache_.invalidate();
+    layout_version_++;
 
     // Make sure everyone has invalidated, as to not get bad values
     theCollective()->barrier();
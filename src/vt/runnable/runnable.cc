@@ -226,7 +226,28 @@ std::unordered_map<std::string, uint64_t> RunnableNew::getMetrics() {
 }
 #endif
 
+#if vt_check_enabled(alloc_tracking)
+util::memory::AllocContextKey RunnableNew::allocContextKey() const {
+  using util::memory::AllocContextKind;
+
+  if (contexts_.has_lb) {
+    auto const& elm_id = contexts_.lb.getCurrentElementID();
+    return {AllocContextKind::Collection, elm_id.id};
+  }
+  if (msg_ != nullptr) {
+    auto const handler = envelopeGetHandler(msg_->env);
+    auto const kind = HandlerManager::isHandlerObjGroup(handler) ?
+      AllocContextKind::ObjGroup : AllocContextKind::Handler;
+    return {kind, static_cast<uint64_t>(handler)};
+  }
+  return {};
+}
+#endif
+
 void RunnableNew::start(TimeType time) {
+#if vt_check_enabled(alloc_tracking)
+  util::memory::AllocTracker::pushContext(allocContextKey());
+#endif
   contexts_.setcontext.start();
   if (contexts_.has_td) contexts_.td.start();
   if (contexts_.has_col) contexts_.col.start();
@@ -245,6 +266,9 @@ void RunnableNew::finish(TimeType time) {
 #if vt_check_enabled(trace_enabled)
   if (contexts_.has_trace) contexts_.trace.finish(time);
 #endif
+#if vt_check_enabled(alloc_tracking)
+  util::memory::AllocTracker::popContext();
+#endif
 }
 
 void RunnableNew::suspend([[maybe_unused]] TimeType time) {
@@ -257,11 +281,17 @@ void RunnableNew::suspend([[maybe_unused]] TimeType time) {
 # if vt_check_enabled(trace_enabled)
     if (contexts_.has_trace) contexts_.trace.suspend(time);
 # endif
+# if vt_check_enabled(alloc_tracking)
+  util::memory::AllocTracker::popContext();
+# endif
 #endif
 }
 
 void RunnableNew::resume([[maybe_unused]] TimeType time) {
 #if vt_check_enabled(fcontext)
+# if vt_check_enabled(alloc_tracking)
+  util::memory::AllocTracker::pushContext(allocContextKey());
+# endif
   contexts_.setcontext.resume();
   if (contexts_.has_td) contexts_.td.resume();
   if (contexts_.has_col) contexts_.col.resume();
@@ -53,6 +53,7 @@
 #include "vt/context/runnable_context/continuation.h"
 #include "vt/pool/static_sized/memory_pool_equal.h"
 #include "vt/elm/elm_id.h"
+#include "vt/utils/memory/alloc_tracker.h"
 #if vt_check_enabled(perf)
 #include "vt/metrics/perf_data.h"
 #endif
@@ -202,6 +203,19 @@ public:
     vrt::collection::UntypedCollection* elm, HandlerType handler
   );
 
+  /**
+   * \brief Point this runnable at another element of a collection, replacing
+   * the handler object and the collection and LB contexts while keeping the
+   * rest (e.g., the epoch), so that one runnable can deliver a broadcast to
+   * each local element in turn
+   *
+   * \param[in] elm the element
+   * \param[in] handler the handler ID bits
+   * \param[in] msg the message, for recording communication LB data
+   */
+  template <typename ElmT, typename MsgT>
+  void resetElement(ElmT* elm, HandlerType handler, MsgT* msg);
+
   /**
    * \brief Set up a handler to run on an object group
    *
@@ -293,6 +307,14 @@ private:
    */
   void resume(TimeType time);
 
+#if vt_check_enabled(alloc_tracking)
+  /**
+   * \internal \brief Get the context heap allocations made by this runnable
+   * are attributed to
+   */
+  util::memory::AllocContextKey allocContextKey() const;
+#endif
+
 public:
   /**
    * \brief Loop through all contexts add run the \c send() method associated
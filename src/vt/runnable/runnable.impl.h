@@ -111,6 +111,22 @@ void RunnableNew::addContextTrace(Args&&... args) {
 }
 #endif
 
+template <typename ElmT, typename MsgT>
+void RunnableNew::resetElement(
+  ElmT* elm, HandlerType handler, [[maybe_unused]] MsgT* msg
+) {
+  // Convert to typeless before reinterpreting the pointer so the compiler does
+  // not produce the wrong offset
+  auto void_ptr = static_cast<void*>(elm);
+  setupHandlerElement(
+    reinterpret_cast<vrt::collection::UntypedCollection*>(void_ptr), handler
+  );
+  addContextCol(elm);
+#if vt_check_enabled(lblite)
+  addContextLB(elm, msg);
+#endif
+}
+
 }} /* end namespace vt::runnable */
 
 #endif /*INCLUDED_VT_RUNNABLE_RUNNABLE_IMPL_H*/
@@ -843,7 +843,8 @@ void Runtime::initializeComponents() {
     >{},
     RuntimeDeps<
       messaging::ActiveMessenger, // Depends on active messenger to send term msgs
-      sched::Scheduler            // Depends on scheduler for idle checks
+      sched::Scheduler,           // Depends on scheduler for idle checks
+      phase::PhaseManager         // For per-phase termination diagnostics
     >{}
   );
 
@@ -940,7 +941,8 @@ void Runtime::initializeComponents() {
     StartupDeps<
       ctx::Context,                        // Everything depends on theContext
       collective::CollectiveAlg,           // Depends on collective scope
-      objgroup::ObjGroupManager            // Since it's an objgroup
+      objgroup::ObjGroupManager,           // Since it's an objgroup
+      phase::PhaseManager                  // For read cache invalidation
     >{},
     RuntimeDeps<
       messaging::ActiveMessenger,         // Depends on active messenger for messaging
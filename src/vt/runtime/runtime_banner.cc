@@ -577,6 +577,21 @@ void Runtime::printStartupBanner() {
     }
   }
 
+  if (getAppConfig()->vt_term_batch_waves) {
+    auto f11 = fmt::format("Batching termination waves across epochs");
+    auto f12 = opt_on("--vt_term_batch_waves", f11);
+    fmt::print("{}\t{}{}", vt_pre, f12, reset);
+  }
+
+  if (getAppConfig()->vt_term_adaptive) {
+    auto f11 = fmt::format(
+      "Adaptive termination waves, max backoff {}s",
+      getAppConfig()->vt_term_adaptive_max_sec
+    );
+    auto f12 = opt_on("--vt_term_adaptive", f11);
+    fmt::print("{}\t{}{}", vt_pre, f12, reset);
+  }
+
   if (getAppConfig()->vt_no_sigint) {
     auto f11 = fmt::format("Disabling SIGINT signal handling");
     auto f12 = opt_on("--vt_no_SIGINT", f11);
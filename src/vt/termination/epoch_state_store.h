@@ -0,0 +1,275 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                             epoch_state_store.h
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_TERMINATION_EPOCH_STATE_STORE_H
+#define INCLUDED_VT_TERMINATION_EPOCH_STATE_STORE_H
+
+#include "vt/config.h"
+#include "vt/epoch/epoch_manip.h"
+
+#include <memory>
+#include <vector>
+#include <unordered_map>
+
+namespace vt { namespace term {
+
+/**
+ * \struct EpochStateStore
+ *
+ * \brief Associative container from \c EpochType to per-epoch state that
+ * exploits the sequential allocation of epochs by \c epoch::EpochWindow.
+ *
+ * Epochs are grouped by their archetype (the control bits: rooted, node,
+ * category). Within an archetype, live epochs are stored in a dense slab
+ * indexed by the epoch's sequence number relative to the oldest live epoch.
+ * Slots are trimmed from both ends as epochs are erased and the storage for
+ * erased values is recycled for later epochs, so the steady state of creating
+ * and terminating many small epochs does not allocate (recycled values are
+ * overwritten by assignment, so \c T must be assignable). Epochs whose
+ * sequence falls too far outside the current slab go into an overflow hash
+ * map.
+ *
+ * References returned by \c find and \c emplace are stable until the epoch is
+ * erased.
+ */
+template <typename T>
+struct EpochStateStore {
+  using ValueType = T;
+  using SeqType   = EpochType::ImplType;
+  using SlotType  = std::unique_ptr<T>;
+
+  /// Maximum number of slots a single archetype window may span
+  static constexpr SeqType const max_window_span = 1ull << 16;
+
+  /// Maximum number of recycled values kept for reuse
+  static constexpr std::size_t const max_recycled = 1024;
+
+private:
+  /**
+   * \internal \struct Window
+   *
+   * \brief Dense slab of epoch values for a single epoch archetype
+   */
+  struct Window {
+    /**
+     * \brief Get the slot for a sequence number if it is in the slab
+     *
+     * \param[in] seq the sequence number
+     *
+     * \return pointer to the slot; \c nullptr if outside the slab
+     */
+    SlotType* slot(SeqType seq);
+
+    /**
+     * \brief Number of slots currently spanned
+     */
+    std::size_t span() const { return slots_.size() - head_; }
+
+    /**
+     * \brief Trim empty slots from both ends of the slab
+     */
+    void trim();
+
+    template <typename SerializerT>
+    void serialize(SerializerT& s) {
+      s | base_
+        | head_
+        | slots_;
+    }
+
+    SeqType base_ = 0;            /**< Sequence of slot at \c head_ */
+    std::size_t head_ = 0;        /**< First slot in use */
+    std::vector<SlotType> slots_; /**< Slab of values, \c nullptr if empty */
+  };
+
+public:
+  EpochStateStore() = default;
+  EpochStateStore(EpochStateStore&&) = default;
+  EpochStateStore& operator=(EpochStateStore&&) = default;
+
+  /**
+   * \brief Find the value for an epoch
+   *
+   * \param[in] epoch the epoch
+   *
+   * \return pointer to the value; \c nullptr if it does not exist
+   */
+  T* find(EpochType epoch);
+
+  /**
+   * \brief Check if an epoch has a value
+   *
+   * \param[in] epoch the epoch
+   *
+   * \return whether it exists
+   */
+  bool contains(EpochType epoch) { return find(epoch) != nullptr; }
+
+  /**
+   * \brief Insert a value for an epoch if one does not already exist
+   *
+   * \param[in] epoch the epoch
+   * \param[in] args arguments to construct the value
+   *
+   * \return reference to the (possibly existing) value
+   */
+  template <typename... Args>
+  T& emplace(EpochType epoch, Args&&... args);
+
+  /**
+   * \brief Erase the value for an epoch if it exists
+   *
+   * \param[in] epoch the epoch
+   */
+  void erase(EpochType epoch);
+
+  /**
+   * \brief Number of live values
+   */
+  std::size_t size() const { return size_; }
+
+  /**
+   * \brief Whether the store is empty
+   */
+  bool empty() const { return size_ == 0; }
+
+  /**
+   * \brief Erase all values
+   */
+  void clear();
+
+  /**
+   * \brief Apply a function to each live (epoch, value). Values may be inserted
+   * during the traversal (they might or might not be visited, while every
+   * value live at the start is visited exactly once), but must not be erased.
+   *
+   * \param[in] fn function called with (EpochType, T&)
+   */
+  template <typename Callable>
+  void forEach(Callable&& fn);
+
+  /**
+   * \brief Apply a function to each live (epoch, value)
+   *
+   * \param[in] fn function called with (EpochType, T const&)
+   */
+  template <typename Callable>
+  void forEach(Callable&& fn) const;
+
+  template <typename SerializerT>
+  void serialize(SerializerT& s) {
+    s | windows_
+      | overflow_
+      | size_;
+
+    if (s.isUnpacking()) {
+      window_list_.clear();
+      for (auto&& w : windows_) {
+        window_list_.emplace_back(w.first, w.second.get());
+      }
+      last_window_ = nullptr;
+    }
+  }
+
+private:
+  /**
+   * \internal \brief Split an epoch into its archetype and sequence
+   *
+   * \param[in] epoch the epoch
+   *
+   * \return the archetype epoch (sequence bits zeroed)
+   */
+  static EpochType archetype(EpochType epoch);
+
+  /**
+   * \internal \brief Get the window for an archetype
+   *
+   * \param[in] arch the archetype epoch
+   * \param[in] create whether to create it if it does not exist
+   *
+   * \return the window; \c nullptr if it does not exist and \c create is false
+   */
+  Window* getWindow(EpochType arch, bool create);
+
+  /**
+   * \internal \brief Make a slot available in a window for a sequence number
+   *
+   * \param[in] window the window
+   * \param[in] seq the sequence number
+   *
+   * \return the slot; \c nullptr if it does not fit in the window
+   */
+  SlotType* makeSlot(Window* window, SeqType seq);
+
+  /**
+   * \internal \brief Construct a value, reusing recycled storage if available
+   *
+   * \param[in] args arguments to construct the value
+   *
+   * \return the owning pointer
+   */
+  template <typename... Args>
+  SlotType makeValue(Args&&... args);
+
+  /**
+   * \internal \brief Recycle the storage for an erased value
+   *
+   * \param[in] slot the slot to release
+   */
+  void recycle(SlotType& slot);
+
+private:
+  std::unordered_map<EpochType, std::unique_ptr<Window>> windows_ = {};
+  std::vector<std::pair<EpochType, Window*>> window_list_        = {};
+  std::unordered_map<EpochType, T> overflow_                     = {};
+  std::vector<SlotType> recycled_                                = {};
+  std::size_t size_                                              = 0;
+  EpochType last_arch_                                           = no_epoch;
+  Window* last_window_                                           = nullptr;
+};
+
+}} /* end namespace vt::term */
+
+#include "vt/termination/epoch_state_store.impl.h"
+
+#endif /*INCLUDED_VT_TERMINATION_EPOCH_STATE_STORE_H*/
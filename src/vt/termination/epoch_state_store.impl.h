@@ -0,0 +1,320 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                           epoch_state_store.impl.h
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_TERMINATION_EPOCH_STATE_STORE_IMPL_H
+#define INCLUDED_VT_TERMINATION_EPOCH_STATE_STORE_IMPL_H
+
+#include "vt/config.h"
+#include "vt/termination/epoch_state_store.h"
+
+#include <algorithm>
+
+namespace vt { namespace term {
+
+template <typename T>
+typename EpochStateStore<T>::SlotType*
+EpochStateStore<T>::Window::slot(SeqType seq) {
+  if (seq < base_) {
+    return nullptr;
+  }
+  auto const offset = seq - base_;
+  if (offset >= span()) {
+    return nullptr;
+  }
+  return &slots_[head_ + offset];
+}
+
+template <typename T>
+void EpochStateStore<T>::Window::trim() {
+  while (head_ < slots_.size() and slots_[head_] == nullptr) {
+    head_++;
+    base_++;
+  }
+  while (slots_.size() > head_ and slots_.back() == nullptr) {
+    slots_.pop_back();
+  }
+  if (head_ == slots_.size()) {
+    slots_.clear();
+    head_ = 0;
+  } else if (head_ > slots_.size() / 2) {
+    // Compact the slab so the dead prefix does not grow unbounded
+    slots_.erase(slots_.begin(), slots_.begin() + head_);
+    head_ = 0;
+  }
+}
+
+template <typename T>
+/*static*/ EpochType EpochStateStore<T>::archetype(EpochType epoch) {
+  auto arch = epoch;
+  epoch::EpochManip::setSeq(arch, 0);
+  return arch;
+}
+
+template <typename T>
+typename EpochStateStore<T>::Window*
+EpochStateStore<T>::getWindow(EpochType arch, bool create) {
+  if (last_window_ != nullptr and last_arch_ == arch) {
+    return last_window_;
+  }
+
+  auto iter = windows_.find(arch);
+  if (iter == windows_.end()) {
+    if (not create) {
+      return nullptr;
+    }
+    iter = windows_.emplace(arch, std::make_unique<Window>()).first;
+    window_list_.emplace_back(arch, iter->second.get());
+  }
+
+  last_arch_ = arch;
+  last_window_ = iter->second.get();
+  return last_window_;
+}
+
+template <typename T>
+typename EpochStateStore<T>::SlotType*
+EpochStateStore<T>::makeSlot(Window* window, SeqType seq) {
+  auto& slots = window->slots_;
+
+  if (window->span() == 0) {
+    slots.clear();
+    slots.emplace_back(nullptr);
+    window->head_ = 0;
+    window->base_ = seq;
+    return &slots[0];
+  }
+
+  if (seq < window->base_) {
+    auto const grow = window->base_ - seq;
+    if (grow + window->span() > max_window_span) {
+      return nullptr;
+    }
+    if (grow <= window->head_) {
+      // Reuse the dead prefix of the slab
+      window->head_ -= grow;
+    } else {
+      auto const extra = grow - window->head_;
+      std::vector<SlotType> grown(extra + slots.size());
+      std::move(slots.begin(), slots.end(), grown.begin() + extra);
+      slots = std::move(grown);
+      window->head_ = 0;
+    }
+    window->base_ = seq;
+    return &slots[window->head_];
+  }
+
+  auto const offset = seq - window->base_;
+  if (offset >= max_window_span) {
+    return nullptr;
+  }
+  if (offset >= window->span()) {
+    slots.resize(window->head_ + offset + 1);
+  }
+  return &slots[window->head_ + offset];
+}
+
+template <typename T>
+template <typename... Args>
+typename EpochStateStore<T>::SlotType
+EpochStateStore<T>::makeValue(Args&&... args) {
+  if (recycled_.empty()) {
+    return std::make_unique<T>(std::forward<Args>(args)...);
+  }
+  auto ptr = std::move(recycled_.back());
+  recycled_.pop_back();
+  *ptr = T(std::forward<Args>(args)...);
+  return ptr;
+}
+
+template <typename T>
+void EpochStateStore<T>::recycle(SlotType& slot) {
+  if (recycled_.size() < max_recycled) {
+    // Keep the storage to assign a later epoch's value into
+    recycled_.emplace_back(std::move(slot));
+  } else {
+    slot = nullptr;
+  }
+}
+
+template <typename T>
+T* EpochStateStore<T>::find(EpochType epoch) {
+  if (size_ == 0) {
+    return nullptr;
+  }
+
+  auto window = getWindow(archetype(epoch), false);
+  if (window != nullptr) {
+    auto s = window->slot(epoch::EpochManip::seq(epoch));
+    if (s != nullptr and *s != nullptr) {
+      return s->get();
+    }
+  }
+
+  if (not overflow_.empty()) {
+    auto iter = overflow_.find(epoch);
+    if (iter != overflow_.end()) {
+      return &iter->second;
+    }
+  }
+
+  return nullptr;
+}
+
+template <typename T>
+template <typename... Args>
+T& EpochStateStore<T>::emplace(EpochType epoch, Args&&... args) {
+  if (auto existing = find(epoch); existing != nullptr) {
+    return *existing;
+  }
+
+  size_++;
+
+  auto window = getWindow(archetype(epoch), true);
+  auto s = makeSlot(window, epoch::EpochManip::seq(epoch));
+  if (s != nullptr) {
+    *s = makeValue(std::forward<Args>(args)...);
+    return **s;
+  }
+
+  auto iter = overflow_.emplace(
+    std::piecewise_construct,
+    std::forward_as_tuple(epoch),
+    std::forward_as_tuple(std::forward<Args>(args)...)
+  ).first;
+  return iter->second;
+}
+
+template <typename T>
+void EpochStateStore<T>::erase(EpochType epoch) {
+  if (size_ == 0) {
+    return;
+  }
+
+  auto window = getWindow(archetype(epoch), false);
+  if (window != nullptr) {
+    auto s = window->slot(epoch::EpochManip::seq(epoch));
+    if (s != nullptr and *s != nullptr) {
+      recycle(*s);
+      window->trim();
+      size_--;
+      return;
+    }
+  }
+
+  auto iter = overflow_.find(epoch);
+  if (iter != overflow_.end()) {
+    overflow_.erase(iter);
+    size_--;
+  }
+}
+
+template <typename T>
+void EpochStateStore<T>::clear() {
+  windows_.clear();
+  window_list_.clear();
+  overflow_.clear();
+  size_ = 0;
+  last_arch_ = no_epoch;
+  last_window_ = nullptr;
+}
+
+template <typename T>
+template <typename Callable>
+void EpochStateStore<T>::forEach(Callable&& fn) {
+  // The callback may emplace, which can grow a slab at either end (shifting
+  // slot offsets) or rehash the overflow map. Walk each window by sequence
+  // over the range it spanned when the traversal reached it, and the overflow
+  // by a snapshot of its keys, so every value that was live at the start is
+  // visited exactly once
+  auto const num_windows = window_list_.size();
+  std::vector<EpochType> overflow_keys;
+  overflow_keys.reserve(overflow_.size());
+  for (auto&& elm : overflow_) {
+    overflow_keys.push_back(elm.first);
+  }
+
+  for (std::size_t w = 0; w < num_windows; w++) {
+    auto const arch = window_list_[w].first;
+    auto window = window_list_[w].second;
+    auto const first = window->base_;
+    auto const last = first + window->span();
+    for (SeqType seq = first; seq < last; seq++) {
+      auto s = window->slot(seq);
+      if (s != nullptr and *s != nullptr) {
+        auto epoch = arch;
+        epoch::EpochManip::setSeq(epoch, seq);
+        fn(epoch, **s);
+      }
+    }
+  }
+
+  for (auto&& epoch : overflow_keys) {
+    auto iter = overflow_.find(epoch);
+    if (iter != overflow_.end()) {
+      fn(iter->first, iter->second);
+    }
+  }
+}
+
+template <typename T>
+template <typename Callable>
+void EpochStateStore<T>::forEach(Callable&& fn) const {
+  for (auto const& w : window_list_) {
+    auto const window = w.second;
+    for (std::size_t i = 0; i < window->span(); i++) {
+      auto const& s = window->slots_[window->head_ + i];
+      if (s != nullptr) {
+        auto epoch = w.first;
+        epoch::EpochManip::setSeq(epoch, window->base_ + i);
+        fn(epoch, static_cast<T const&>(*s));
+      }
+    }
+  }
+  for (auto const& elm : overflow_) {
+    fn(elm.first, elm.second);
+  }
+}
+
+}} /* end namespace vt::term */
+
+#endif /*INCLUDED_VT_TERMINATION_EPOCH_STATE_STORE_IMPL_H*/
@@ -0,0 +1,175 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                            epoch_graph_summary.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include "vt/config.h"
+#include "vt/context/context.h"
+#include "vt/termination/graph/epoch_graph_summary.h"
+#include "vt/termination/term_common.h"
+#include "vt/epoch/epoch_headers.h"
+
+#include <algorithm>
+#include <cstdio>
+
+namespace vt { namespace termination { namespace graph {
+
+static constexpr char const* overflow_class = "<other>";
+
+/*static*/ EpochGraphSummary::ClassType EpochGraphSummary::classify(
+  EpochType epoch, std::string const& label
+) {
+  if (epoch == term::any_epoch_sentinel) {
+    return "Global";
+  }
+
+  auto const name = label == "" ? std::string{"<unlabeled>"} : label;
+  if (epoch::EpochManip::isRooted(epoch)) {
+    auto const ds_epoch = epoch::eEpochCategory::DijkstraScholtenEpoch;
+    if (epoch::EpochManip::category(epoch) == ds_epoch) {
+      return name + " (DS)";
+    } else {
+      return name + " (Wave)";
+    }
+  } else {
+    return name + " (C)";
+  }
+}
+
+EpochGraphSummary::ClassType EpochGraphSummary::bound(ClassType const& cls) {
+  if (
+    max_classes_ == 0 or
+    classes_.size() < max_classes_ or
+    classes_.find(cls) != classes_.end()
+  ) {
+    return cls;
+  }
+  return overflow_class;
+}
+
+void EpochGraphSummary::addEpochs(ClassType const& cls, CountType count) {
+  classes_[bound(cls)] += count;
+}
+
+void EpochGraphSummary::addLinks(
+  ClassType const& from, ClassType const& to, CountType count
+) {
+  auto const bfrom = bound(from);
+  auto const bto = bound(to);
+  // Make sure both ends of the link exist as vertices
+  classes_.emplace(bfrom, 0);
+  classes_.emplace(bto, 0);
+  links_[std::make_pair(bfrom, bto)] += count;
+}
+
+EpochGraphSummary::CountType EpochGraphSummary::getNumEpochs() const {
+  CountType total = 0;
+  for (auto const& elm : classes_) {
+    total += elm.second;
+  }
+  return total;
+}
+
+void EpochGraphSummary::writeDOTToFile(bool global, std::string tag) const {
+  auto const node = theContext()->getNode();
+  auto const base_file = "epoch_graph_summary";
+  if (tag != "") {
+    tag = tag + ".";
+  }
+  std::string file = "";
+  if (global) {
+    file = fmt::format("{}.global.{}dot", base_file, tag);
+  } else {
+    file = fmt::format("{}.{}.{}dot", base_file, node, tag);
+  }
+
+  auto fd = fopen(file.c_str(), "w+");
+  if (fd == nullptr) {
+    vt_print(term, "Could not open file={} to write epoch graph\n", file);
+    return;
+  }
+
+  // Written incrementally, one vertex/edge at a time, so the output is never
+  // materialized in memory
+  fmt::print(fd, "digraph graphname {{\n");
+  fmt::print(fd, "\tlabelloc = \"b\"\n");
+  fmt::print(fd, "\trankdir = \"TB\"\n");
+  fmt::print(fd, "\tranksep = \"1\"\n");
+  fmt::print(fd, "\tedge[\n\t\t\tpenwidth=2\n\t]\n");
+  fmt::print(
+    fd,
+    "\tnode[\n\t\tfontname=Monaco,\n\t\tpenwidth=1,\n\t\tfontsize=10,\n"
+    "\t\tmargin=.3,\n\t\tshape=box,\n\t\tfillcolor=lightblue,\n"
+    "\t\tstyle=\"rounded,filled\"\n\t]\n"
+  );
+
+  std::map<ClassType, std::size_t> ids;
+  for (auto const& elm : classes_) {
+    auto const id = ids.size();
+    ids[elm.first] = id;
+    fmt::print(
+      fd, "\tc{} [label=\"{}\\nlive epochs={}\"]\n", id, elm.first, elm.second
+    );
+  }
+  for (auto const& elm : links_) {
+    fmt::print(
+      fd, "\tc{}->c{} [label=\"{}\"];\n",
+      ids[elm.first.first], ids[elm.first.second], elm.second
+    );
+  }
+  fmt::print(fd, "}}\n");
+  fclose(fd);
+}
+
+/*friend*/ EpochGraphSummary operator+(
+  EpochGraphSummary a1, EpochGraphSummary const& a2
+) {
+  a1.max_classes_ = std::max(a1.max_classes_, a2.max_classes_);
+  for (auto const& elm : a2.classes_) {
+    a1.addEpochs(elm.first, elm.second);
+  }
+  for (auto const& elm : a2.links_) {
+    a1.addLinks(elm.first.first, elm.first.second, elm.second);
+  }
+  return a1;
+}
+
+}}} /* end namespace vt::termination::graph */
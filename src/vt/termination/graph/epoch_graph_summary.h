@@ -0,0 +1,160 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                            epoch_graph_summary.h
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_TERMINATION_GRAPH_EPOCH_GRAPH_SUMMARY_H
+#define INCLUDED_VT_TERMINATION_GRAPH_EPOCH_GRAPH_SUMMARY_H
+
+#include "vt/config.h"
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
+
+namespace vt { namespace termination { namespace graph {
+
+/**
+ * \struct EpochGraphSummary
+ *
+ * \brief A summarized epoch graph where epochs are collapsed into classes by
+ * their label and kind (collective, rooted wave, rooted DS), keeping a count of
+ * live epochs per class and of links between classes.
+ *
+ * The number of classes is bounded: once the bound is reached further classes
+ * are folded into a single overflow class. This bounds the size of each node's
+ * contribution and of the merged graph on the root regardless of the number of
+ * live epochs, unlike the full \c EpochGraph.
+ */
+struct EpochGraphSummary {
+  using ClassType   = std::string;
+  using CountType   = int64_t;
+  using LinkType    = std::pair<ClassType, ClassType>;
+  using ClassMap    = std::map<ClassType, CountType>;
+  using LinkMap     = std::map<LinkType, CountType>;
+
+  EpochGraphSummary() = default;
+
+  /**
+   * \brief Construct an empty summary
+   *
+   * \param[in] in_max_classes the maximum number of classes to keep
+   */
+  explicit EpochGraphSummary(std::size_t in_max_classes)
+    : max_classes_(in_max_classes)
+  { }
+
+  /**
+   * \brief Get the class an epoch is collapsed into
+   *
+   * \param[in] epoch the epoch
+   * \param[in] label the epoch's label
+   *
+   * \return the class
+   */
+  static ClassType classify(EpochType epoch, std::string const& label);
+
+  /**
+   * \brief Count a live epoch in a class
+   *
+   * \param[in] cls the class
+   * \param[in] count number of epochs
+   */
+  void addEpochs(ClassType const& cls, CountType count = 1);
+
+  /**
+   * \brief Count a link between classes
+   *
+   * \param[in] from the predecessor's class
+   * \param[in] to the successor's class
+   * \param[in] count number of links
+   */
+  void addLinks(ClassType const& from, ClassType const& to, CountType count = 1);
+
+  /**
+   * \brief Number of epochs summarized
+   */
+  CountType getNumEpochs() const;
+
+  ClassMap const& getClasses() const { return classes_; }
+  LinkMap const& getLinks() const { return links_; }
+
+  /**
+   * \brief Write the summary to a DOT file, one line at a time
+   *
+   * \param[in] global whether this is the merged (global) graph
+   * \param[in] tag optional tag for the file name
+   */
+  void writeDOTToFile(bool global = false, std::string tag = "") const;
+
+  // Merge the summaries, re-applying the class bound
+  friend EpochGraphSummary operator+(
+    EpochGraphSummary a1, EpochGraphSummary const& a2
+  );
+
+  template <typename SerializerT>
+  void serialize(SerializerT& s) {
+    s | max_classes_
+      | classes_
+      | links_;
+  }
+
+private:
+  /**
+   * \internal \brief Apply the class bound
+   *
+   * \param[in] cls the class
+   *
+   * \return \c cls if it is tracked or may be added; the overflow class
+   * otherwise
+   */
+  ClassType bound(ClassType const& cls);
+
+private:
+  std::size_t max_classes_ = 0; /**< Class bound, zero for unbounded */
+  ClassMap classes_ = {};       /**< Live epochs per class */
+  LinkMap links_ = {};          /**< Links between classes */
+};
+
+}}} /* end namespace vt::termination::graph */
+
+#endif /*INCLUDED_VT_TERMINATION_GRAPH_EPOCH_GRAPH_SUMMARY_H*/
@@ -48,6 +48,8 @@
 #include "vt/messaging/message.h"
 #include "vt/termination/term_state.h"
 
+#include <vector>
+
 namespace vt { namespace term {
 
 struct TermMsg : vt::ShortMessage {
@@ -102,6 +104,98 @@ struct TermCounterMsg : vt::ShortMessage {
   { }
 };
 
+/**
+ * \struct TermCounterEntry
+ *
+ * \brief Counts for one epoch's wave sent up the spanning tree as part of a
+ * batched \c TermCounterBatchMsg
+ */
+struct TermCounterEntry {
+  TermCounterEntry() = default;
+  TermCounterEntry(
+    EpochType const in_epoch,
+    TermCounterType const in_prod, TermCounterType const in_cons
+  ) : epoch(in_epoch), prod(in_prod), cons(in_cons)
+  { }
+
+  template <typename SerializerT>
+  void serialize(SerializerT& s) {
+    s | epoch | prod | cons;
+  }
+
+  EpochType epoch = no_epoch;
+  TermCounterType prod = 0, cons = 0;
+};
+
+/**
+ * \struct TermCounterBatchMsg
+ *
+ * \brief The wave counts for all epochs ready to propagate to the parent
+ * during a progress cycle
+ */
+struct TermCounterBatchMsg : vt::Message {
+  using MessageParentType = vt::Message;
+  vt_msg_serialize_required(); // vector
+
+  TermCounterBatchMsg() = default;
+  explicit TermCounterBatchMsg(std::vector<TermCounterEntry>&& in_entries)
+    : entries(std::move(in_entries))
+  { }
+
+  template <typename SerializerT>
+  void serialize(SerializerT& s) {
+    MessageParentType::serialize(s);
+    s | entries;
+  }
+
+  std::vector<TermCounterEntry> entries;
+};
+
+/**
+ * \struct TermWaveEntry
+ *
+ * \brief Instruction from the root for one epoch: continue with the next wave
+ * or terminate
+ */
+struct TermWaveEntry {
+  TermWaveEntry() = default;
+  TermWaveEntry(EpochType const in_epoch, TermCounterType const in_wave)
+    : epoch(in_epoch), wave(in_wave)
+  { }
+
+  template <typename SerializerT>
+  void serialize(SerializerT& s) {
+    s | epoch | wave;
+  }
+
+  EpochType epoch = no_epoch;
+  TermCounterType wave = -1;      /**< The next wave; -1 if terminated */
+};
+
+/**
+ * \struct TermWaveBatchMsg
+ *
+ * \brief The continue/terminate decisions made by the root during a progress
+ * cycle, broadcast together
+ */
+struct TermWaveBatchMsg : vt::Message {
+  using MessageParentType = vt::Message;
+  vt_msg_serialize_required(); // vector
+
+  TermWaveBatchMsg() = default;
+  explicit TermWaveBatchMsg(std::vector<TermWaveEntry>&& in_entries)
+    : entries(std::move(in_entries))
+  { }
+
+  template <typename SerializerT>
+  void serialize(SerializerT& s) {
+    MessageParentType::serialize(s);
+    s | entries;
+  }
+
+  std::vector<TermWaveEntry> entries;
+};
+
 struct BuildGraphMsg : vt::ShortMessage { };
 
 }} //end namespace vt::term
@@ -56,8 +56,13 @@
 #include "vt/configs/debug/debug_colorize.h"
 #include "vt/collective/collective_alg.h"
 #include "vt/pipe/pipe_headers.h"
+#include "vt/phase/phase_manager.h"
 
+#include <algorithm>
+#include <functional>
+#include <list>
 #include <memory>
+#include <unordered_set>
 
 namespace vt { namespace term {
 
@@ -87,6 +92,30 @@ TerminationDetector::propagateEpochHandler(TermCounterMsg* msg) {
   theTerm()->epochContinue(msg->new_epoch, msg->wave);
 }
 
+/*static*/ void
+TerminationDetector::propagateEpochBatchHandler(TermCounterBatchMsg* msg) {
+  auto term = theTerm();
+  for (auto const& entry : msg->entries) {
+    term->propagateEpochExternal(entry.epoch, entry.prod, entry.cons);
+  }
+  // Forward what became ready from this batch right away instead of waiting
+  // for the next progress cycle
+  term->flushBatchedWaves();
+}
+
+/*static*/ void
+TerminationDetector::epochWaveBatchHandler(TermWaveBatchMsg* msg) {
+  auto term = theTerm();
+  for (auto const& entry : msg->entries) {
+    if (entry.wave == -1) {
+      term->epochTerminated(entry.epoch, CallFromEnum::NonRoot);
+    } else {
+      term->receiveContinue(entry.epoch, entry.wave);
+    }
+  }
+  term->maybePropagate();
+}
+
 /*static*/ void TerminationDetector::inquireEpochTerminated(
   TermTerminatedMsg* msg
 ) {
@@ -99,6 +128,155 @@ TerminationDetector::propagateEpochHandler(TermCounterMsg* msg) {
   theTerm()->replyTerminated(msg->getEpoch(),msg->isTerminated());
 }
 
+void TerminationDetector::initialize() {
+  // Number of batched wave messages sent up or broadcast down the tree
+  termBatchMsgCount = registerCounter(
+    "term_batch_msgs", "batched termination wave messages"
+  );
+
+  // Number of epoch waves carried by those messages
+  termBatchEntryCount = registerCounter(
+    "term_batch_entries", "epoch waves in batched messages"
+  );
+
+  // Number of termination messages (waves, decisions, hang checks) sent
+  termMsgCount = registerCounter("term_msgs", "termination messages sent");
+
+  // Number of waves propagated from this node
+  termWaveCount = registerCounter("term_waves", "termination waves");
+
+  // Number of times waves were held back because the scheduler was busy
+  termDeferredCount = registerCounter(
+    "term_deferred", "termination waves deferred (busy)"
+  );
+
+  // Min/max/avg of the per-phase termination messages and waves
+  termMsgPhaseGauge = registerGauge(
+    "term_msgs_per_phase", "termination messages per phase"
+  );
+  termWavePhaseGauge = registerGauge(
+    "term_waves_per_phase", "termination waves per phase"
+  );
+}
+
+void TerminationDetector::startup() {
+  thePhase()->registerHookUnsynchronized(phase::PhaseHook::End, [this]{
+    vt_debug_print(
+      normal, term,
+      "phase={}: term_msgs={}, term_waves={}\n",
+      thePhase()->getCurrentPhase(), phase_term_msgs_, phase_waves_
+    );
+
+    termMsgPhaseGauge.update(phase_term_msgs_);
+    termWavePhaseGauge.update(phase_waves_);
+    phase_term_msgs_ = 0;
+    phase_waves_ = 0;
+  });
+}
+
+int TerminationDetector::progress([[maybe_unused]] TimeType current_time) {
+  if (propagate_deferred_) {
+    maybePropagate();
+  }
+  return flushBatchedWaves();
+}
+
+void TerminationDetector::tryPropagate(TermStateType& state) {
+  if (deferPropagate()) {
+    return;
+  }
+
+  if (propagate_deferred_) {
+    // Other epochs were held back during the backoff interval; sweep them all
+    // along with this one
+    maybePropagate();
+  } else {
+    propagateEpoch(state);
+  }
+}
+
+bool TerminationDetector::deferPropagate() {
+  if (not theConfig()->vt_term_adaptive or theSched()->workQueueEmpty()) {
+    return false;
+  }
+
+  auto const now = theSched()->getRecentTime();
+  if (now - last_propagate_time_ < propagate_backoff_) {
+    if (not propagate_deferred_) {
+      propagate_deferred_ = true;
+      termDeferredCount.increment(1);
+    }
+    return true;
+  }
+
+  return false;
+}
+
+void TerminationDetector::notePropagate() {
+  phase_waves_++;
+  termWaveCount.increment(1);
+
+  if (not theConfig()->vt_term_adaptive) {
+    return;
+  }
+
+  if (theSched()->workQueueEmpty()) {
+    // Idle: nothing to interfere with, so run waves as fast as they come back
+    propagate_backoff_ = TimeType{0.};
+    return;
+  }
+
+  auto const now = theSched()->getRecentTime();
+  if (now - last_propagate_time_ >= propagate_backoff_) {
+    // Start a new interval, doubling it while the scheduler remains busy
+    auto const max_backoff = TimeType{theConfig()->vt_term_adaptive_max_sec};
+    auto const min_backoff = max_backoff / 64.;
+    propagate_backoff_ = std::min(
+      std::max(propagate_backoff_ * 2., min_backoff), max_backoff
+    );
+    last_propagate_time_ = now;
+  }
+}
+
+int TerminationDetector::flushBatchedWaves() {
+  int num_sent = 0;
+
+  if (not pending_counts_.empty()) {
+    vt_debug_print(
+      verbose, term,
+      "flushBatchedWaves: sending to parent: {}, epochs={}\n",
+      getParent(), pending_counts_.size()
+    );
+
+    termBatchEntryCount.increment(pending_counts_.size());
+    auto msg = makeMessage<TermCounterBatchMsg>(std::move(pending_counts_));
+    pending_counts_.clear();
+    theMsg()->markAsTermMessage(msg);
+    theMsg()->sendMsg<propagateEpochBatchHandler>(getParent(), msg);
+    countTermMsg();
+    num_sent++;
+  }
+
+  if (not pending_waves_.empty()) {
+    vt_debug_print(
+      verbose, term,
+      "flushBatchedWaves [root]: broadcasting epochs={}\n",
+      pending_waves_.size()
+    );
+
+    termBatchEntryCount.increment(pending_waves_.size());
+    auto msg = makeMessage<TermWaveBatchMsg>(std::move(pending_waves_));
+    pending_waves_.clear();
+    theMsg()->markAsTermMessage(msg);
+    theMsg()->broadcastMsg<epochWaveBatchHandler>(msg, false);
+    countTermMsg();
+    num_sent++;
+  }
+
+  termBatchMsgCount.increment(num_sent);
+  return num_sent;
+}
+
 TermCounterType TerminationDetector::getNumUnits() const {
   return any_epoch_state_.g_cons2;
 }
@@ -128,20 +306,13 @@ TerminationDetector::findOrCreateState(EpochType const& epoch, bool is_ready) {
 
   vtAssert(epoch != any_epoch_sentinel, "Should not be any epoch");
 
-  auto epoch_iter = epoch_state_.find(epoch);
-
-  if (epoch_iter == epoch_state_.end()) {
-    epoch_state_.emplace(
-      std::piecewise_construct,
-      std::forward_as_tuple(epoch),
-      std::forward_as_tuple(
-        TermStateType{epoch, epoch_active, local_term, num_children_}
-      )
-    );
-    epoch_iter = epoch_state_.find(epoch);
+  if (auto state = epoch_state_.find(epoch); state != nullptr) {
+    return *state;
   }
 
-  return epoch_iter->second;
+  return epoch_state_.emplace(
+    epoch, epoch, epoch_active, local_term, num_children_
+  );
 }
 
 TerminationDetector::TermStateDSType*
@@ -171,6 +342,12 @@ TerminationDetector::getDSTerm(EpochType epoch, bool is_root) {
 }
 
 void TerminationDetector::maybePropagate() {
+  if (deferPropagate()) {
+    return;
+  }
+
+  propagate_deferred_ = false;
+
   if (any_epoch_state_.isActive() and any_epoch_state_.readySubmitParent()) {
     propagateEpoch(any_epoch_state_);
   }
@@ -179,11 +356,13 @@ void TerminationDetector::maybePropagate() {
     propagateEpoch(hang_);
   }
 
-  for (auto&& state : epoch_state_) {
-    if (state.second.isActive() and state.second.readySubmitParent()) {
-      propagateEpoch(state.second);
+  epoch_state_.forEach([this](EpochType, TermStateType& state) {
+    if (state.isActive() and state.readySubmitParent()) {
+      propagateEpoch(state);
     }
-  }
+  });
+
+  flushBatchedWaves();
 }
 
 void TerminationDetector::propagateEpochExternalState(
@@ -202,7 +381,7 @@ void TerminationDetector::propagateEpochExternalState(
   state.notifyChildReceive();
 
   if (state.isActive() and state.readySubmitParent()) {
-    propagateEpoch(state);
+    tryPropagate(state);
   }
 }
 
@@ -234,13 +413,8 @@ void TerminationDetector::resetGlobalTerm() {
 }
 
 void TerminationDetector::freeEpoch(EpochType const& epoch) {
-  // Clean up epoch ready std::unordered_set
-  {
-    auto iter = epoch_ready_.find(epoch);
-    if (iter != epoch_ready_.end()) {
-      epoch_ready_.erase(iter);
-    }
-  }
+  // Clean up epoch ready set
+  epoch_ready_.erase(epoch);
 
   // Clean up any actions lambdas associated with epoch
   {
@@ -251,12 +425,7 @@ void TerminationDetector::freeEpoch(EpochType const& epoch) {
   }
 
   // Clean up local epoch state associated with epoch
-  {
-    auto iter = epoch_state_.find(epoch);
-    if (iter != epoch_state_.end()) {
-      epoch_state_.erase(iter);
-    }
-  }
+  epoch_state_.erase(epoch);
 }
 
 std::shared_ptr<TerminationDetector::EpochGraph> TerminationDetector::makeGraph() {
@@ -278,16 +447,15 @@ std::shared_ptr<TerminationDetector::EpochGraph> TerminationDetector::makeGraph(
     // Collect non-rooted epochs, just collective, excluding DS or other rooted
     // epochs (info about them is localized on the creation node)
 
-    for (auto const& elm : epoch_state_) {
-      auto const ep = elm.first;
+    epoch_state_.forEach([&](EpochType ep, TermStateType const& state) {
       bool const rooted = epoch::EpochManip::isRooted(ep);
       if (not rooted or (epoch::EpochManip::node(ep) == this_node_)) {
-        if (not isEpochTerminated(elm.first)) {
-          auto label = elm.second.getLabel();
+        if (not isEpochTerminated(ep)) {
+          auto label = state.getLabel();
           live_epochs[ep] = std::make_shared<EpochGraph>(ep, label);
         }
       }
-    }
+    });
     for (auto const& elm : term_) {
       // Only include DS epochs that are created here. Other nodes do not have
       // proper successor info about the rooted, DS epochs
@@ -324,11 +492,130 @@ std::shared_ptr<TerminationDetector::EpochGraph> TerminationDetector::makeGraph(
   }
 }
 
+TerminationDetector::EpochGraphSummary
+TerminationDetector::makeGraphSummary(std::size_t max_classes) {
+  EpochGraphSummary summary{max_classes};
+  if (any_epoch_state_.isTerminated()) {
+    return summary;
+  }
+
+  // Walk the live epochs once, counting each into its class as it is visited
+  // and adding a link from the class of each of its successors. Unlike
+  // `makeGraph`, nothing per-epoch is kept beyond the visit. Collective epochs
+  // (and the global epoch) are live on every node, so only node 0, the root of
+  // the reduction, counts them and their links; rooted epochs are counted on
+  // the node that created them, as in the full graph.
+  bool const count_collective = this_node_ == 0;
+  auto const global = EpochGraphSummary::classify(
+    any_epoch_state_.getEpoch(), "Global"
+  );
+  if (count_collective) {
+    summary.addEpochs(global);
+  }
+
+  auto labelOf = [this](EpochType ep) -> std::string {
+    if (isDS(ep)) {
+      auto iter = term_.find(ep);
+      return iter != term_.end() ? iter->second.getLabel() : std::string{};
+    } else {
+      auto state = epoch_state_.find(ep);
+      return state != nullptr ? state->getLabel() : std::string{};
+    }
+  };
+
+  auto record = [&](EpochType ep, std::string const& label) {
+    auto const cls = EpochGraphSummary::classify(ep, label);
+    summary.addEpochs(cls);
+    auto const& successors = getEpochDep(ep)->getSuccessors();
+    if (successors.size() == 0) {
+      summary.addLinks(global, cls);
+    } else {
+      for (auto&& p : successors) {
+        summary.addLinks(EpochGraphSummary::classify(p, labelOf(p)), cls);
+      }
+    }
+  };
+
+  epoch_state_.forEach([&](EpochType ep, TermStateType const& state) {
+    bool const rooted = epoch::EpochManip::isRooted(ep);
+    bool const counted = rooted ?
+      epoch::EpochManip::node(ep) == this_node_ : count_collective;
+    if (counted and not isEpochTerminated(ep)) {
+      record(ep, state.getLabel());
+    }
+  });
+  for (auto const& elm : term_) {
+    if (epoch::EpochManip::node(elm.first) == this_node_) {
+      if (not isEpochTerminated(elm.first)) {
+        record(elm.first, elm.second.getLabel());
+      }
+    }
+  }
+
+  return summary;
+}
+
+void TerminationDetector::detectDependencyCycles() {
+  // DFS from every live epoch toward the epochs it depends on. The stack
+  // holds the current path; `done` holds epochs whose dependencies were
+  // already searched, so each epoch is visited once
+  std::unordered_set<EpochType> done;
+  std::list<EpochType> stack;
+
+  std::function<void(EpochType)> visit = [&](EpochType ep) {
+    if (done.find(ep) != done.end()) {
+      return;
+    }
+    auto on_stack = std::find(stack.begin(), stack.end(), ep);
+    if (on_stack != stack.end()) {
+      std::string cycle_diagnostic = "";
+      for (auto iter = on_stack; iter != stack.end(); ++iter) {
+        cycle_diagnostic += fmt::format("{:x}<-", *iter);
+      }
+      cycle_diagnostic += fmt::format("{:x}", ep);
+      vtAbort(
+        fmt::format(
+          "Cycle detected in epoch graph:\nCycle: {}\n", cycle_diagnostic
+        )
+      );
+      return;
+    }
+    stack.push_back(ep);
+    for (auto&& p : getEpochDep(ep)->getSuccessors()) {
+      // Rooted epochs created elsewhere may not have local state to follow
+      bool const local = isDS(p) ?
+        term_.find(p) != term_.end() : epoch_state_.contains(p);
+      if (local) {
+        visit(p);
+      }
+    }
+    stack.pop_back();
+    done.insert(ep);
+  };
+
+  epoch_state_.forEach([&](EpochType ep, TermStateType const&) {
+    bool const rooted = epoch::EpochManip::isRooted(ep);
+    if (not rooted or (epoch::EpochManip::node(ep) == this_node_)) {
+      if (not isEpochTerminated(ep)) {
+        visit(ep);
+      }
+    }
+  });
+  for (auto const& elm : term_) {
+    if (epoch::EpochManip::node(elm.first) == this_node_) {
+      if (not isEpochTerminated(elm.first)) {
+        visit(elm.first);
+      }
+    }
+  }
+}
+
 
 bool TerminationDetector::propagateEpoch(TermStateType& state) {
   bool const& is_ready = state.readySubmitParent();
   bool const& is_root = isRoot();
   auto const& parent = getParent();
+  bool const batch_waves = theConfig()->vt_term_batch_waves;
 
   vt_debug_print(
     verbose, term,
@@ -341,6 +628,8 @@ bool TerminationDetector::propagateEpoch(TermStateType& state) {
   if (is_ready) {
     bool is_term = false;
 
+    notePropagate();
+
     // Update the global counters for a given epoch
     state.g_prod1 += state.l_prod;
     state.g_cons1 += state.l_cons;
@@ -353,7 +642,13 @@ bool TerminationDetector::propagateEpoch(TermStateType& state) {
       state.getRecvChildCount(), state.getNumChildren()
     );
 
-    if (not is_root) {
+    if (not is_root and batch_waves) {
+      // Coalesced with the other epochs ready this progress cycle and sent in
+      // one message by flushBatchedWaves
+      pending_counts_.emplace_back(
+        state.getEpoch(), state.g_prod1, state.g_cons1
+      );
+    } else if (not is_root) {
       auto msg = makeMessage<TermCounterMsg>(
         state.getEpoch(), state.g_prod1, state.g_cons1
       );
@@ -366,6 +661,7 @@ bool TerminationDetector::propagateEpoch(TermStateType& state) {
       );
 
       theMsg()->sendMsg<propagateEpochHandler>(parent, msg);
+      countTermMsg();
     } else /*if (is_root) */ {
       is_term =
         state.g_prod1 == state.g_cons1 and
@@ -402,9 +698,16 @@ bool TerminationDetector::propagateEpoch(TermStateType& state) {
       }
 
       if (is_term) {
-        auto msg = makeMessage<TermMsg>(state.getEpoch());
-        theMsg()->markAsTermMessage(msg);
-        theMsg()->broadcastMsg<epochTerminatedHandler>(msg, false);
+        // Global termination is broadcast right away: the runtime may stop
+        // polling once it has been detected
+        if (batch_waves and state.getEpoch() != any_epoch_sentinel) {
+          pending_waves_.emplace_back(state.getEpoch(), -1);
+        } else {
+          auto msg = makeMessage<TermMsg>(state.getEpoch());
+          theMsg()->markAsTermMessage(msg);
+          theMsg()->broadcastMsg<epochTerminatedHandler>(msg, false);
+          countTermMsg();
+        }
 
         vt_debug_print(
           terse, term,
@@ -439,9 +742,14 @@ bool TerminationDetector::propagateEpoch(TermStateType& state) {
           state.getEpoch(), state.getCurWave()
         );
 
-        auto msg = makeMessage<TermMsg>(state.getEpoch(), state.getCurWave());
-        theMsg()->markAsTermMessage(msg);
-        theMsg()->broadcastMsg<epochContinueHandler>(msg, false);
+        if (batch_waves) {
+          pending_waves_.emplace_back(state.getEpoch(), state.getCurWave());
+        } else {
+          auto msg = makeMessage<TermMsg>(state.getEpoch(), state.getCurWave());
+          theMsg()->markAsTermMessage(msg);
+          theMsg()->broadcastMsg<epochContinueHandler>(msg, false);
+          countTermMsg();
+        }
       }
     }
 
@@ -521,6 +829,7 @@ void TerminationDetector::countsConstant(TermStateType& state) {
               auto msg = makeMessage<HangCheckMsg>();
               theMsg()->markAsTermMessage(msg.get());
               theMsg()->broadcastMsg<hangCheckHandler>(msg, false);
+              countTermMsg();
               hangCheckHandler(nullptr);
             }
           }
@@ -545,7 +854,10 @@ void TerminationDetector::startEpochGraphBuild() {
 /*static*/ void TerminationDetector::hangCheckHandler(
   [[maybe_unused]] HangCheckMsg* msg
 ) {
-  fmt::print("{}:hangCheckHandler\n",theContext()->getNode());
+  vt_debug_print(
+    normal, term,
+    "hangCheckHandler: activating hang detection epoch\n"
+  );
   theTerm()->hang_.activateEpoch();
 }
 
@@ -558,6 +870,42 @@ void TerminationDetector::startEpochGraphBuild() {
     "buildLocalGraphHandler: building local epoch graph\n"
   );
 
+  NodeType root = 0;
+
+  if (theConfig()->vt_epoch_graph_summary) {
+    /*
+     * Check for cycles on the dependencies directly, since the full graph is
+     * never built in this mode
+     */
+    theTerm()->detectDependencyCycles();
+
+    /*
+     * Collapse the live epochs by label so the contribution from each node and
+     * the merged graph on the root are bounded by the number of classes, not
+     * the number of live epochs
+     */
+    auto const max_classes = static_cast<std::size_t>(
+      std::max(theConfig()->vt_epoch_graph_max_classes, int64_t{0})
+    );
+    auto summary = std::make_shared<EpochGraphSummary>(
+      theTerm()->makeGraphSummary(max_classes)
+    );
+
+    summary->writeDOTToFile();
+
+    using SummaryOp = collective::PlusOp<EpochGraphSummary>;
+    auto msg = makeMessage<EpochGraphSummaryMsg>(summary);
+    auto cb = vt::theCB()->makeSend<epochGraphSummaryBuiltHandler>(root);
+
+    auto r = theTerm()->reducer();
+    r->reduce<SummaryOp>(root, msg.get(), cb);
+
+    if (theContext()->getNode() != root) {
+      theTerm()->has_printed_epoch_graph = true;
+    }
+    return;
+  }
+
   /*
    * Make the local epoch graph on this node
    */
@@ -576,7 +924,6 @@ void TerminationDetector::startEpochGraphBuild() {
   auto str = graph->outputDOT();
   graph->writeToFile(str);
   auto msg = makeMessage<MsgType>(graph);
-  NodeType root = 0;
   auto cb = vt::theCB()->makeSend<epochGraphBuiltHandler>(root);
 
   auto r = theTerm()->reducer();
@@ -599,6 +946,22 @@ void TerminationDetector::startEpochGraphBuild() {
   theTerm()->has_printed_epoch_graph = true;
 }
 
+/*static*/ void TerminationDetector::epochGraphSummaryBuiltHandler(
+  EpochGraphSummaryMsg* msg
+) {
+  auto const& summary = msg->getConstVal();
+
+  vt_debug_print(
+    verbose, term,
+    "epochGraphSummaryBuiltHandler: collected global summary: classes={}, "
+    "epochs={}\n",
+    summary.getClasses().size(), summary.getNumEpochs()
+  );
+
+  summary.writeDOTToFile(true);
+  theTerm()->has_printed_epoch_graph = true;
+}
+
 void TerminationDetector::cleanupEpoch(EpochType const& epoch, CallFromEnum from) {
   vt_debug_print(
     normal, term,
@@ -622,10 +985,7 @@ void TerminationDetector::cleanupEpoch(EpochType const& epoch, CallFromEnum from
       // For the non-root, epoch_state_ can be cleaned immediately. Otherwise,
       // we might be iterating through state so its not safe to erase
       if (from == CallFromEnum::NonRoot) {
-        auto iter = epoch_state_.find(epoch);
-        if (iter != epoch_state_.end()) {
-          epoch_state_.erase(iter);
-        }
+        epoch_state_.erase(epoch);
       } else {
         // Schedule the cleanup for later, we are in the midst of iterating and
         // can't safely erase it immediately
@@ -635,10 +995,7 @@ void TerminationDetector::cleanupEpoch(EpochType const& epoch, CallFromEnum from
       }
     }
     // Clean up ready state since the epoch has terminated
-    auto ready_iter = epoch_ready_.find(epoch);
-    if (ready_iter != epoch_ready_.end()) {
-      epoch_ready_.erase(ready_iter);
-    }
+    epoch_ready_.erase(epoch);
   }
 }
 
@@ -722,10 +1079,7 @@ void TerminationDetector::replyTerminated(
   vtAssertExpr(is_terminated == true);
 
   // Remove the entry for the pending status of this remote epoch
-  auto iter = epoch_wait_status_.find(epoch);
-  if (iter != epoch_wait_status_.end()) {
-    epoch_wait_status_.erase(iter);
-  }
+  epoch_wait_status_.erase(epoch);
 
   epochTerminated(epoch, CallFromEnum::NonRoot);
 }
@@ -768,15 +1122,14 @@ TermStatusEnum TerminationDetector::testEpochTerminated(EpochType epoch) {
         status = TermStatusEnum::Terminated;
       }
     } else {
-      auto iter = epoch_wait_status_.find(epoch);
-      if (iter == epoch_wait_status_.end()) {
+      if (not epoch_wait_status_.contains(epoch)) {
         /*
          * Send a message to the root node to find out whether this epoch is
          * terminated or not
          */
         auto msg = makeMessage<TermTerminatedMsg>(epoch,this_node_);
         theMsg()->sendMsg<inquireEpochTerminated>(root, msg);
-        epoch_wait_status_.insert(epoch);
+        epoch_wait_status_.emplace(epoch, true);
       }
       status = TermStatusEnum::Remote;
     }
@@ -807,18 +1160,23 @@ void TerminationDetector::epochContinue(
     epoch, wave
   );
 
+  receiveContinue(epoch, wave);
+
+  theTerm()->maybePropagate();
+}
+
+void TerminationDetector::receiveContinue(
+  EpochType const& epoch, TermWaveType const& wave
+) {
   if (epoch == any_epoch_sentinel) {
     any_epoch_state_.receiveContinueSignal(wave);
   } else if (epoch == no_epoch) {
     hang_.receiveContinueSignal(wave);
   } else {
-    auto epoch_iter = epoch_state_.find(epoch);
-    if (epoch_iter != epoch_state_.end()) {
-      epoch_iter->second.receiveContinueSignal(wave);
+    if (auto state = epoch_state_.find(epoch); state != nullptr) {
+      state->receiveContinueSignal(wave);
     }
   }
-
-  theTerm()->maybePropagate();
 }
 
 EpochDependency* TerminationDetector::getEpochDep(EpochType epoch) {
@@ -908,9 +1266,8 @@ void TerminationDetector::releaseLocalDependency(EpochType epoch) {
 }
 
 void TerminationDetector::finishNoActivateEpoch(EpochType const& epoch) {
-  auto ready_iter = epoch_ready_.find(epoch);
-  if (ready_iter == epoch_ready_.end()) {
-    epoch_ready_.emplace(epoch);
+  if (not epoch_ready_.contains(epoch)) {
+    epoch_ready_.emplace(epoch, true);
     consume(epoch,1);
   }
 }
@@ -919,7 +1276,7 @@ void TerminationDetector::finishedEpoch(EpochType const& epoch) {
   vt_debug_print(
     normal, term,
     "finishedEpoch: epoch={:x}, finished={}\n",
-    epoch, epoch_ready_.find(epoch) != epoch_ready_.end()
+    epoch, epoch_ready_.contains(epoch)
   );
 
   finishNoActivateEpoch(epoch);
@@ -1160,15 +1517,15 @@ void TerminationDetector::makeRootedHan(
 void TerminationDetector::setupNewEpoch(
   EpochType const& epoch, std::string const& label
 ) {
-  auto epoch_iter = epoch_state_.find(epoch);
+  auto existing = epoch_state_.find(epoch);
 
-  bool const found = epoch_iter != epoch_state_.end();
+  bool const found = existing != nullptr;
 
   vt_debug_print(
     normal, term,
     "setupNewEpoch: epoch={:x}, found={}, count={}\n",
     epoch, print_bool(found),
-    (found ? epoch_iter->second.getRecvChildCount() : -1)
+    (found ? existing->getRecvChildCount() : -1)
   );
 
   auto& state = findOrCreateState(epoch, false);
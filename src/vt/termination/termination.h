@@ -53,11 +53,13 @@
 #include "vt/termination/epoch_dependency.h"
 #include "vt/termination/dijkstra-scholten/ds_headers.h"
 #include "vt/termination/graph/epoch_graph.h"
+#include "vt/termination/graph/epoch_graph_summary.h"
 #include "vt/epoch/epoch.h"
 #include "vt/activefn/activefn.h"
 #include "vt/collective/tree/tree.h"
 #include "vt/termination/graph/epoch_graph_reduce.h"
 #include "vt/termination/epoch_tags.h"
+#include "vt/termination/epoch_state_store.h"
 #include "vt/runtime/component/component_pack.h"
 
 #include <cstdint>
@@ -104,16 +106,20 @@ struct EpochStack {
  * across all nodes) are equal, termination is reached.
  */
 struct TerminationDetector :
-  runtime::component::Component<TerminationDetector>,
+  runtime::component::PollableComponent<TerminationDetector>,
   TermAction, collective::tree::Tree, DijkstraScholtenTerm, TermInterface
 {
   template <typename T>
-  using EpochContainerType = std::unordered_map<EpochType, T>;
+  using EpochContainerType = EpochStateStore<T>;
+  using EpochSetType       = EpochStateStore<bool>;
   using TermStateType      = TermState;
   using TermStateDSType    = term::ds::StateDS::TerminatorType;
   using SuccessorBagType   = EpochDependency::SuccessorBagType;
   using EpochGraph         = termination::graph::EpochGraph;
   using EpochGraphMsg      = termination::graph::EpochGraphMsg<EpochGraph>;
+  using EpochGraphSummary  = termination::graph::EpochGraphSummary;
+  using EpochGraphSummaryMsg =
+    termination::graph::EpochGraphMsg<EpochGraphSummary>;
   using EpochStackType     = EpochStack;
 
   /**
@@ -137,6 +143,21 @@ struct TerminationDetector :
 
   std::string name() override { return "TerminationDetector"; }
 
+  void initialize() override;
+
+  void startup() override;
+
+  /**
+   * \internal \brief Run waves held back while the scheduler was busy (when
+   * \c vt_term_adaptive is enabled) and flush the termination waves batched
+   * during this progress cycle (when \c vt_term_batch_waves is enabled)
+   *
+   * \param[in] current_time current time
+   *
+   * \return number of batched messages sent
+   */
+  int progress(TimeType current_time) override;
+
   /****************************************************************************
    *
    * Termination interface: produce(..)/consume(..) for 4-counter wave-based
@@ -570,6 +591,24 @@ public:
    */
   std::shared_ptr<EpochGraph> makeGraph();
 
+  /**
+   * \brief Make the summarized local epoch graph directly from the live
+   * epochs, without building the full graph
+   *
+   * Collective epochs are only counted on node 0 so that the merged summary
+   * counts each of them once.
+   *
+   * \param[in] max_classes the maximum number of classes to keep
+   *
+   * \return the summary
+   */
+  EpochGraphSummary makeGraphSummary(std::size_t max_classes);
+
+  /**
+   * \brief Abort if the live epochs' dependencies contain a cycle
+   */
+  void detectDependencyCycles();
+
 private:
   /**
    * \internal \brief Handler for hang checking
@@ -592,6 +631,14 @@ private:
    */
   static void epochGraphBuiltHandler(EpochGraphMsg* msg);
 
+  /**
+   * \internal \brief Handler when the summarized epoch graph is merged on the
+   * root
+   *
+   * \param[in] msg the message
+   */
+  static void epochGraphSummaryBuiltHandler(EpochGraphSummaryMsg* msg);
+
 private:
   /**
    * \internal \brief Propagate a particular epoch
@@ -618,6 +665,15 @@ private:
    */
   void epochContinue(EpochType const& epoch, TermWaveType const& wave);
 
+  /**
+   * \internal \brief Apply the continue signal for an epoch without trying to
+   * propagate
+   *
+   * \param[in] epoch the epoch
+   * \param[in] wave the wave count so far
+   */
+  void receiveContinue(EpochType const& epoch, TermWaveType const& wave);
+
   /**
    * \internal \brief Setup state for a new epoch
    *
@@ -689,8 +745,8 @@ public:
 public:
   // Methods for testing state of TD from unit tests
   EpochContainerType<TermStateType> const& getEpochState() { return epoch_state_; }
-  std::unordered_set<EpochType> const& getEpochReadySet() { return epoch_ready_; }
-  std::unordered_set<EpochType> const& getEpochWaitSet() { return epoch_wait_status_; }
+  EpochSetType const& getEpochReadySet() { return epoch_ready_; }
+  EpochSetType const& getEpochWaitSet() { return epoch_wait_status_; }
 
   template <typename SerializerT>
   void serialize(SerializerT& s) {
@@ -699,7 +755,21 @@ public:
       | epoch_state_
       | epoch_ready_
       | epoch_wait_status_
-      | has_printed_epoch_graph;
+      | has_printed_epoch_graph
+      | pending_counts_
+      | pending_waves_
+      | propagate_deferred_
+      | propagate_backoff_
+      | last_propagate_time_
+      | phase_term_msgs_
+      | phase_waves_
+      | termBatchMsgCount
+      | termBatchEntryCount
+      | termMsgCount
+      | termWaveCount
+      | termDeferredCount
+      | termMsgPhaseGauge
+      | termWavePhaseGauge;
   }
 
 private:
@@ -795,6 +865,60 @@ private:
    */
   static void epochContinueHandler(TermMsg* msg);
 
+  /**
+   * \internal \brief Propagate a batch of epoch waves handler
+   *
+   * \param[in] msg the message
+   */
+  static void propagateEpochBatchHandler(TermCounterBatchMsg* msg);
+
+  /**
+   * \internal \brief Continue or terminate a batch of epochs handler
+   *
+   * \param[in] msg the message
+   */
+  static void epochWaveBatchHandler(TermWaveBatchMsg* msg);
+
+  /**
+   * \internal \brief Send the wave counts and root decisions accumulated for
+   * all epochs in one message per tree edge
+   *
+   * \return number of messages sent
+   */
+  int flushBatchedWaves();
+
+  /**
+   * \internal \brief Propagate an epoch's wave if it is ready, unless waves
+   * are being held back while the scheduler is busy
+   *
+   * \param[in] state the epoch's state
+   */
+  void tryPropagate(TermStateType& state);
+
+  /**
+   * \internal \brief Whether to hold back waves now: with
+   * \c vt_term_adaptive, waves are sent eagerly while the scheduler is idle
+   * and, while it has work, at most once per backoff interval (which doubles
+   * up to \c vt_term_adaptive_max_sec while the scheduler stays busy)
+   *
+   * \return whether to defer propagation
+   */
+  bool deferPropagate();
+
+  /**
+   * \internal \brief Record that a wave is being propagated from this node
+   * to adjust the backoff interval
+   */
+  void notePropagate();
+
+  /**
+   * \internal \brief Count a termination message sent from this node
+   */
+  void countTermMsg() {
+    termMsgCount.increment(1);
+    phase_term_msgs_++;
+  }
+
 public:
   inline EpochType getEpoch() const;
   inline void pushEpoch(EpochType epoch);
@@ -817,13 +941,35 @@ private:
   // epoch termination state
   EpochContainerType<TermStateType> epoch_state_        = {};
   // ready epoch list (misnomer: finishedEpoch was invoked)
-  std::unordered_set<EpochType> epoch_ready_            = {};
+  EpochSetType epoch_ready_                             = {};
   // list of remote epochs pending status report of finished
-  std::unordered_set<EpochType> epoch_wait_status_      = {};
+  EpochSetType epoch_wait_status_                       = {};
   // has printed epoch graph during abort
   bool has_printed_epoch_graph                          = false;
+  // wave counts waiting to be sent to the parent in one message
+  std::vector<TermCounterEntry> pending_counts_         = {};
+  // root continue/terminate decisions waiting to be broadcast in one message
+  std::vector<TermWaveEntry> pending_waves_             = {};
+  // whether a wave was held back because the scheduler was busy
+  bool propagate_deferred_                              = false;
+  // current interval between waves while the scheduler is busy
+  TimeType propagate_backoff_                           = TimeType{0.};
+  // time the current backoff interval started
+  TimeType last_propagate_time_                         = TimeType{0.};
+  // termination messages sent during the current phase
+  int64_t phase_term_msgs_                              = 0;
+  // waves propagated from this node during the current phase
+  int64_t phase_waves_                                  = 0;
   NodeType this_node_ = uninitialized_destination;
   EpochStackType epoch_stack_;
+
+  diagnostic::Counter termBatchMsgCount;
+  diagnostic::Counter termBatchEntryCount;
+  diagnostic::Counter termMsgCount;
+  diagnostic::Counter termWaveCount;
+  diagnostic::Counter termDeferredCount;
+  diagnostic::Gauge termMsgPhaseGauge;
+  diagnostic::Gauge termWavePhaseGauge;
 };
 
 }} // end namespace vt::term
@@ -98,7 +98,7 @@ inline void TerminationDetector::produceConsumeState(
   );
 
   if (state.isActive() and state.readySubmitParent()) {
-    propagateEpoch(state);
+    tryPropagate(state);
   }
 }
 
@@ -305,6 +305,16 @@ struct EntityLocationCoord : LocationCoord {
    */
   bool isCached(EntityID const& id) const;
 
+  /**
+   * \internal \brief Get the known location of an entity without sending any
+   * messages: local registration first, then the cache
+   *
+   * \param[in] id the entity ID
+   *
+   * \return the node; \c uninitialized_destination if the location is unknown
+   */
+  NodeType getCachedLocation(EntityID const& id);
+
   /**
    * \internal \brief Clear the cache
    */
@@ -226,6 +226,22 @@ bool EntityLocationCoord<EntityID>::isCached(EntityID const& id) const {
   return recs_.exists(id);
 }
 
+template <typename EntityID>
+NodeType EntityLocationCoord<EntityID>::getCachedLocation(EntityID const& id) {
+  if (local_registered_.find(id) != local_registered_.end()) {
+    return theContext()->getNode();
+  }
+  if (recs_.exists(id)) {
+    auto const& rec = recs_.get(id);
+    if (rec.isLocal()) {
+      return theContext()->getNode();
+    } else if (rec.isRemote()) {
+      return rec.getRemoteNode();
+    }
+  }
+  return uninitialized_destination;
+}
+
 template <typename EntityID>
 void EntityLocationCoord<EntityID>::clearCache() {
   recs_.clearCache();
@@ -74,5 +74,6 @@
 #include "vt/objgroup/headers.h"
 #include "vt/scheduler/priority.h"
 #include "vt/rdmahandle/manager.h"
+#include "vt/rdmahandle/halo.h"
 
 #endif /*INCLUDED_VT_TRANSPORT_H*/
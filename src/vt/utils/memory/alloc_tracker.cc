@@ -0,0 +1,402 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                               alloc_tracker.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include "vt/config.h"
+#include "vt/utils/memory/alloc_tracker.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <unordered_map>
+
+namespace vt { namespace util { namespace memory {
+
+namespace {
+
+struct SlotCounters {
+  std::atomic<int64_t> live_bytes{0};
+  std::atomic<uint64_t> phase_bytes{0};
+  std::atomic<uint64_t> phase_count{0};
+};
+
+/// Placed right before each block returned by \c AllocTracker::allocate
+struct BlockHeader {
+  uint64_t size;
+  uint32_t slot;
+  uint32_t offset;   /**< Distance from the start of the malloc'ed memory */
+};
+
+static_assert(sizeof(BlockHeader) == 16, "Block header must be 16 bytes");
+
+/// The slot of blocks allocated before tracking was enabled
+static constexpr AllocTracker::SlotType const uncounted_slot = ~0u;
+
+struct KeyHash {
+  std::size_t operator()(AllocContextKey const& key) const {
+    return std::hash<uint64_t>{}(key.id) ^
+      (static_cast<std::size_t>(key.kind) << 1);
+  }
+};
+
+/*
+ * These are intentionally never freed: blocks can be released during static
+ * destruction, after any static object holding them would be gone.
+ */
+std::atomic<SlotCounters*> counters{nullptr};
+std::unordered_map<AllocContextKey, AllocTracker::SlotType, KeyHash>*
+  slot_map = nullptr;
+std::vector<AllocContextKey>* slot_keys = nullptr;
+std::vector<AllocTracker::SlotType>* free_slots = nullptr;
+std::vector<AllocTracker::SlotType>* released_slots = nullptr;
+bool warned_full = false;
+
+thread_local AllocTracker::SlotType context_stack[AllocTracker::max_depth];
+thread_local int context_depth = 0;
+
+AllocTracker::SlotType currentSlot() {
+  auto const depth = std::min(context_depth, AllocTracker::max_depth);
+  return depth > 0 ? context_stack[depth - 1] : AllocTracker::runtime_slot;
+}
+
+} /* end anon namespace */
+
+/*static*/ void AllocTracker::enable() {
+  if (not isAvailable() or isEnabled()) {
+    return;
+  }
+  slot_keys = new std::vector<AllocContextKey>(1, AllocContextKey{});
+  slot_map = new std::unordered_map<AllocContextKey, SlotType, KeyHash>();
+  slot_map->emplace(AllocContextKey{}, runtime_slot);
+  free_slots = new std::vector<SlotType>();
+  released_slots = new std::vector<SlotType>();
+  counters.store(new SlotCounters[max_slots], std::memory_order_release);
+}
+
+/*static*/ bool AllocTracker::isEnabled() {
+  return counters.load(std::memory_order_relaxed) != nullptr;
+}
+
+/*static*/ void AllocTracker::pushContext(AllocContextKey key) {
+  if (not isEnabled()) {
+    return;
+  }
+
+  // Contexts past the slot limit are charged to the runtime
+  SlotType slot = runtime_slot;
+  auto iter = slot_map->find(key);
+  if (iter != slot_map->end()) {
+    slot = iter->second;
+  } else if (not free_slots->empty()) {
+    slot = free_slots->back();
+    free_slots->pop_back();
+    auto c = counters.load(std::memory_order_relaxed);
+    c[slot].phase_bytes.store(0, std::memory_order_relaxed);
+    c[slot].phase_count.store(0, std::memory_order_relaxed);
+    (*slot_keys)[slot] = key;
+    slot_map->emplace(key, slot);
+  } else if (slot_keys->size() < max_slots) {
+    slot = static_cast<SlotType>(slot_keys->size());
+    slot_keys->push_back(key);
+    slot_map->emplace(key, slot);
+  } else if (not warned_full) {
+    warned_full = true;
+    vtWarn(
+      fmt::format(
+        "Allocation tracking ran out of its {} context slots: allocations of "
+        "new contexts are charged to the runtime", max_slots
+      )
+    );
+  }
+
+  if (context_depth < max_depth) {
+    context_stack[context_depth] = slot;
+  }
+  context_depth++;
+}
+
+/*static*/ void AllocTracker::popContext() {
+  if (context_depth > 0) {
+    context_depth--;
+  }
+}
+
+/*static*/ void AllocTracker::releaseContext(AllocContextKey key) {
+  auto c = counters.load(std::memory_order_acquire);
+  if (c == nullptr) {
+    return;
+  }
+  auto iter = slot_map->find(key);
+  if (iter == slot_map->end() or iter->second == runtime_slot) {
+    return;
+  }
+
+  // Blocks still charged to the slot free into it, so it waits until they are
+  // all gone before another context gets it
+  auto const slot = iter->second;
+  slot_map->erase(iter);
+  if (c[slot].live_bytes.load(std::memory_order_relaxed) == 0) {
+    free_slots->push_back(slot);
+  } else {
+    released_slots->push_back(slot);
+  }
+}
+
+/*static*/ std::vector<AllocContextStats> AllocTracker::getStats() {
+  std::vector<AllocContextStats> stats;
+  auto c = counters.load(std::memory_order_acquire);
+  if (c == nullptr) {
+    return stats;
+  }
+  auto const num_slots = slot_keys->size();
+  stats.reserve(num_slots);
+  for (std::size_t i = 0; i < num_slots; i++) {
+    AllocContextStats s;
+    s.key = (*slot_keys)[i];
+    s.live_bytes = c[i].live_bytes.load(std::memory_order_relaxed);
+    s.phase_bytes = c[i].phase_bytes.load(std::memory_order_relaxed);
+    s.phase_count = c[i].phase_count.load(std::memory_order_relaxed);
+    stats.push_back(s);
+  }
+  return stats;
+}
+
+/*static*/ int64_t AllocTracker::getLiveBytes(AllocContextKey key) {
+  auto c = counters.load(std::memory_order_acquire);
+  if (c == nullptr) {
+    return 0;
+  }
+  auto iter = slot_map->find(key);
+  if (iter == slot_map->end()) {
+    return 0;
+  }
+  return c[iter->second].live_bytes.load(std::memory_order_relaxed);
+}
+
+/*static*/ void AllocTracker::resetPhase() {
+  auto c = counters.load(std::memory_order_acquire);
+  if (c == nullptr) {
+    return;
+  }
+  auto const num_slots = slot_keys->size();
+  for (std::size_t i = 0; i < num_slots; i++) {
+    c[i].phase_bytes.store(0, std::memory_order_relaxed);
+    c[i].phase_count.store(0, std::memory_order_relaxed);
+  }
+
+  auto const reclaimed = std::stable_partition(
+    released_slots->begin(), released_slots->end(), [c](SlotType slot) {
+      return c[slot].live_bytes.load(std::memory_order_relaxed) != 0;
+    }
+  );
+  free_slots->insert(free_slots->end(), reclaimed, released_slots->end());
+  released_slots->erase(reclaimed, released_slots->end());
+}
+
+/*static*/ void* AllocTracker::allocate(std::size_t size, std::size_t align) {
+  align = std::max(align, alignof(std::max_align_t));
+  auto const header = sizeof(BlockHeader);
+  auto raw = static_cast<std::byte*>(std::malloc(size + header + align - 1));
+  if (raw == nullptr) {
+    return nullptr;
+  }
+
+  auto const raw_addr = reinterpret_cast<uintptr_t>(raw);
+  auto const mask = ~(static_cast<uintptr_t>(align) - 1);
+  auto const addr = (raw_addr + header + align - 1) & mask;
+  auto block = reinterpret_cast<BlockHeader*>(addr - header);
+  block->size = size;
+  block->offset = static_cast<uint32_t>(addr - raw_addr);
+  block->slot = uncounted_slot;
+
+  auto c = counters.load(std::memory_order_acquire);
+  if (c != nullptr) {
+    auto const slot = currentSlot();
+    c[slot].live_bytes.fetch_add(size, std::memory_order_relaxed);
+    c[slot].phase_bytes.fetch_add(size, std::memory_order_relaxed);
+    c[slot].phase_count.fetch_add(1, std::memory_order_relaxed);
+    block->slot = slot;
+  }
+
+  return reinterpret_cast<void*>(addr);
+}
+
+/*static*/ void AllocTracker::deallocate(void* ptr) {
+  if (ptr == nullptr) {
+    return;
+  }
+
+  auto const addr = reinterpret_cast<uintptr_t>(ptr);
+  auto block = reinterpret_cast<BlockHeader*>(addr - sizeof(BlockHeader));
+  if (block->slot != uncounted_slot) {
+    auto c = counters.load(std::memory_order_acquire);
+    c[block->slot].live_bytes.fetch_sub(block->size, std::memory_order_relaxed);
+  }
+  std::free(reinterpret_cast<void*>(addr - block->offset));
+}
+
+}}} /* end namespace vt::util::memory */
+
+#if vt_check_enabled(alloc_tracking)
+
+namespace {
+
+using vt::util::memory::AllocTracker;
+
+void* trackedNew(std::size_t size, std::size_t align) {
+  if (size == 0) {
+    size = 1;
+  }
+  while (true) {
+    if (auto ptr = AllocTracker::allocate(size, align); ptr != nullptr) {
+      return ptr;
+    }
+    auto handler = std::get_new_handler();
+    if (handler == nullptr) {
+      throw std::bad_alloc{};
+    }
+    handler();
+  }
+}
+
+void* trackedNewNoThrow(std::size_t size, std::size_t align) noexcept {
+  try {
+    return trackedNew(size, align);
+  } catch (...) {
+    return nullptr;
+  }
+}
+
+constexpr std::size_t const default_align = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+} /* end anon namespace */
+
+void* operator new(std::size_t size) {
+  return trackedNew(size, default_align);
+}
+
+void* operator new[](std::size_t size) {
+  return trackedNew(size, default_align);
+}
+
+void* operator new(std::size_t size, std::nothrow_t const&) noexcept {
+  return trackedNewNoThrow(size, default_align);
+}
+
+void* operator new[](std::size_t size, std::nothrow_t const&) noexcept {
+  return trackedNewNoThrow(size, default_align);
+}
+
+void* operator new(std::size_t size, std::align_val_t align) {
+  return trackedNew(size, static_cast<std::size_t>(align));
+}
+
+void* operator new[](std::size_t size, std::align_val_t align) {
+  return trackedNew(size, static_cast<std::size_t>(align));
+}
+
+void* operator new(
+  std::size_t size, std::align_val_t align, std::nothrow_t const&
+) noexcept {
+  return trackedNewNoThrow(size, static_cast<std::size_t>(align));
+}
+
+void* operator new[](
+  std::size_t size, std::align_val_t align, std::nothrow_t const&
+) noexcept {
+  return trackedNewNoThrow(size, static_cast<std::size_t>(align));
+}
+
+void operator delete(void* ptr) noexcept {
+  AllocTracker::deallocate(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+  AllocTracker::deallocate(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+  AllocTracker::deallocate(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept {
+  AllocTracker::deallocate(ptr);
+}
+
+void operator delete(void* ptr, std::nothrow_t const&) noexcept {
+  AllocTracker::deallocate(ptr);
+}
+
+void operator delete[](void* ptr, std::nothrow_t const&) noexcept {
+  AllocTracker::deallocate(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept {
+  AllocTracker::deallocate(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t) noexcept {
+  AllocTracker::deallocate(ptr);
+}
+
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept {
+  AllocTracker::deallocate(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept {
+  AllocTracker::deallocate(ptr);
+}
+
+void operator delete(
+  void* ptr, std::align_val_t, std::nothrow_t const&
+) noexcept {
+  AllocTracker::deallocate(ptr);
+}
+
+void operator delete[](
+  void* ptr, std::align_val_t, std::nothrow_t const&
+) noexcept {
+  AllocTracker::deallocate(ptr);
+}
+
+#endif /*vt_check_enabled(alloc_tracking)*/
@@ -0,0 +1,206 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                               alloc_tracker.h
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_UTILS_MEMORY_ALLOC_TRACKER_H
+#define INCLUDED_VT_UTILS_MEMORY_ALLOC_TRACKER_H
+
+#include "vt/config.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+namespace vt { namespace util { namespace memory {
+
+/// The kind of task that heap allocations are attributed to
+enum struct AllocContextKind : int8_t {
+  Runtime    = 0,
+  Handler    = 1,
+  ObjGroup   = 2,
+  Collection = 3
+};
+
+/**
+ * \struct AllocContextKey
+ *
+ * \brief Identifies what allocations are attributed to: a handler or object
+ * group method by its handler ID, or a collection element by its element ID.
+ */
+struct AllocContextKey {
+  AllocContextKind kind = AllocContextKind::Runtime;
+  uint64_t id = 0;
+
+  bool operator==(AllocContextKey const& other) const {
+    return kind == other.kind and id == other.id;
+  }
+};
+
+/**
+ * \struct AllocContextStats
+ *
+ * \brief The allocations attributed to one context
+ */
+struct AllocContextStats {
+  AllocContextKey key = {};
+  int64_t live_bytes = 0;       /**< Bytes it allocated that are not freed */
+  uint64_t phase_bytes = 0;     /**< Bytes allocated since the phase began */
+  uint64_t phase_count = 0;     /**< Allocations since the phase began */
+};
+
+/**
+ * \struct AllocTracker
+ *
+ * \brief Attributes heap allocations to the task running when they are made.
+ *
+ * When VT is built with \c vt_alloc_tracking_enabled, global \c operator new
+ * and \c operator delete are replaced with versions that put a small header
+ * before each block recording its size and the context that allocated it, so
+ * a free is charged back to the context that allocated the block, whichever
+ * context frees it. Runnables push their context when they start and pop it
+ * when they finish; allocations made outside any task, or on threads other
+ * than the one running tasks, are charged to the runtime.
+ *
+ * Nothing is counted until \c enable is called (by \c MemoryUsage with
+ * \c --vt_alloc_tracking). Allocations that bypass \c operator new (e.g.,
+ * \c malloc or VT's message pool) are not tracked.
+ *
+ * Each context takes one of \c max_slots counter slots. A destroyed
+ * collection element releases its slot, which is reused once the blocks still
+ * charged to it are freed. When all slots are taken, new contexts are charged
+ * to the runtime and a warning is printed once.
+ */
+struct AllocTracker {
+  using SlotType = uint32_t;
+
+  static constexpr SlotType const runtime_slot = 0;
+  static constexpr SlotType const max_slots = 1 << 16;
+  static constexpr int const max_depth = 64;
+
+  /**
+   * \brief Whether the tracking allocator is compiled in
+   */
+  static constexpr bool isAvailable() {
+#if vt_check_enabled(alloc_tracking)
+    return true;
+#else
+    return false;
+#endif
+  }
+
+  /**
+   * \brief Start counting allocations
+   */
+  static void enable();
+
+  /**
+   * \brief Whether allocations are being counted
+   */
+  static bool isEnabled();
+
+  /**
+   * \brief Charge allocations on this thread to a context until popped
+   *
+   * \param[in] key the context
+   */
+  static void pushContext(AllocContextKey key);
+
+  /**
+   * \brief Return to charging the previously pushed context
+   */
+  static void popContext();
+
+  /**
+   * \brief Release a context that will not run again (e.g., a destroyed
+   * collection element) so its slot can be reused
+   *
+   * The slot is reused right away if the context has no live bytes, otherwise
+   * at the first \c resetPhase after its remaining blocks are freed. Its
+   * counts are reported until then.
+   *
+   * \param[in] key the context
+   */
+  static void releaseContext(AllocContextKey key);
+
+  /**
+   * \brief Get the counts of every context that has allocated
+   *
+   * \return the counts, the runtime first
+   */
+  static std::vector<AllocContextStats> getStats();
+
+  /**
+   * \brief Get the live bytes allocated by a context
+   *
+   * \param[in] key the context
+   *
+   * \return the live bytes or zero if it never allocated
+   */
+  static int64_t getLiveBytes(AllocContextKey key);
+
+  /**
+   * \brief Reset the per-phase allocation counts and reclaim released slots
+   * whose blocks were all freed
+   */
+  static void resetPhase();
+
+  /**
+   * \internal \brief Allocate a block, recording its size and context
+   *
+   * \param[in] size the number of bytes
+   * \param[in] align the required alignment
+   *
+   * \return the block or \c nullptr if out of memory
+   */
+  static void* allocate(std::size_t size, std::size_t align);
+
+  /**
+   * \internal \brief Free a block from \c allocate
+   *
+   * \param[in] ptr the block
+   */
+  static void deallocate(void* ptr);
+};
+
+}}} /* end namespace vt::util::memory */
+
+#endif /*INCLUDED_VT_UTILS_MEMORY_ALLOC_TRACKER_H*/
@@ -46,6 +46,7 @@
 #include "vt/utils/memory/memory_usage.h"
 #include "vt/phase/phase_manager.h"
 #include "vt/context/context.h"
+#include "vt/timing/timing.h"
 
 #include <vector>
 #include <memory>
@@ -54,6 +55,7 @@
 #include <istream>
 #include <fstream>
 #include <cstdio>
+#include <algorithm>
 
 #if defined(vt_has_malloc_h)
 # include <malloc.h>
@@ -358,6 +360,17 @@ MemoryUsage::MemoryUsage() {
     r->getUsage();
   }
   getFirstUsage();
+
+  if (theConfig()->vt_alloc_tracking and AllocTracker::isAvailable()) {
+    allocCount = registerCounter("alloc_count", "tracked heap allocations");
+    allocBytes = registerCounter(
+      "alloc_bytes", "tracked heap bytes allocated", UnitType::Bytes
+    );
+    allocLiveBytes = registerGauge(
+      "alloc_live_bytes", "tracked live heap bytes at phase end",
+      UnitType::Bytes
+    );
+  }
 }
 
 void MemoryUsage::initialize() {
@@ -381,6 +394,100 @@ void MemoryUsage::initialize() {
       }
     }
   }
+
+  if (theConfig()->vt_alloc_tracking) {
+    if (not AllocTracker::isAvailable()) {
+      if (theContext()->getNode() == 0) {
+        vtWarn(
+          "--vt_alloc_tracking has no effect: VT was not built with "
+          "vt_alloc_tracking_enabled"
+        );
+      }
+    } else {
+      AllocTracker::enable();
+      alloc_phase_start_ = timing::getCurrentTime();
+      thePhase()->registerHookUnsynchronized(
+        phase::PhaseHook::EndPostMigration, [this]{ endAllocPhase(); }
+      );
+    }
+  }
+}
+
+void MemoryUsage::endAllocPhase() {
+  auto const stats = AllocTracker::getStats();
+  uint64_t count = 0;
+  uint64_t bytes = 0;
+  int64_t live = 0;
+  for (auto&& s : stats) {
+    count += s.phase_count;
+    bytes += s.phase_bytes;
+    live += s.live_bytes;
+  }
+
+  allocCount.increment(count);
+  allocBytes.increment(bytes);
+  allocLiveBytes.update(live);
+
+  auto const this_node = theContext()->getNode();
+  auto const top = theConfig()->vt_alloc_tracking_top;
+  if (
+    top > 0 and (
+      "all" == theConfig()->vt_print_memory_node or
+      std::to_string(this_node) == theConfig()->vt_print_memory_node
+    )
+  ) {
+    auto const now = timing::getCurrentTime();
+    auto const secs = static_cast<double>(now - alloc_phase_start_);
+    auto const rate = secs > 0 ? static_cast<double>(bytes) / secs : 0.;
+    auto const best = getBestMemoryUnit(static_cast<std::size_t>(rate));
+    vt_print(
+      gen,
+      "Allocation Tracking: phase={}: allocations={}, rate={:.1f} {}/s\n{}",
+      thePhase()->getCurrentPhase(), count, std::get<1>(best),
+      std::get<0>(best), getAllocSummary(top)
+    );
+  }
+
+  AllocTracker::resetPhase();
+  alloc_phase_start_ = timing::getCurrentTime();
+}
+
+std::string MemoryUsage::getAllocSummary(int top) {
+  auto stats = AllocTracker::getStats();
+  auto const num = std::min(static_cast<std::size_t>(top), stats.size());
+  std::partial_sort(
+    stats.begin(), stats.begin() + num, stats.end(),
+    [](AllocContextStats const& a, AllocContextStats const& b) {
+      return a.live_bytes > b.live_bytes;
+    }
+  );
+
+  auto pretty = [](int64_t in_bytes) {
+    auto const bytes = static_cast<std::size_t>(std::max<int64_t>(in_bytes, 0));
+    auto const best = getBestMemoryUnit(bytes);
+    return fmt::format("{:.1f} {}", std::get<1>(best), std::get<0>(best));
+  };
+
+  std::string builder;
+  for (std::size_t i = 0; i < num; i++) {
+    auto const& s = stats[i];
+    std::string name;
+    switch (s.key.kind) {
+    case AllocContextKind::Runtime:    name = "runtime"; break;
+    case AllocContextKind::Handler:
+      name = fmt::format("handler {:x}", s.key.id); break;
+    case AllocContextKind::ObjGroup:
+      name = fmt::format("objgroup handler {:x}", s.key.id); break;
+    case AllocContextKind::Collection:
+      name = fmt::format("element {}", s.key.id); break;
+    }
+    builder += fmt::format(
+      "  {:<32} live={:>12} allocated={:>12} allocations={}\n",
+      name, pretty(s.live_bytes),
+      pretty(static_cast<int64_t>(s.phase_bytes)), s.phase_count
+    );
+  }
+  return builder;
 }
 
 std::size_t MemoryUsage::getAverageUsage() {
@@ -48,6 +48,7 @@
 #include "vt/runtime/component/component_pack.h"
 #include "vt/utils/memory/memory_units.h"
 #include "vt/utils/memory/memory_reporter.h"
+#include "vt/utils/memory/alloc_tracker.h"
 
 #include <string>
 #include <memory>
@@ -184,15 +185,41 @@ struct MemoryUsage : runtime::component::Component<MemoryUsage> {
    */
   std::size_t convertBytesFromString(std::string const& in);
 
+  /**
+   * \brief Get a summary of the contexts with the most live heap bytes from
+   * allocation tracking (\c --vt_alloc_tracking)
+   *
+   * \param[in] top the number of contexts to include
+   *
+   * \return the summary, one line per context
+   */
+  std::string getAllocSummary(int top);
+
   template <typename SerializerT>
   void serialize(SerializerT& s) {
     s | reporters_
-      | first_valid_reporter_;
+      | first_valid_reporter_
+      | alloc_phase_start_
+      | allocCount
+      | allocBytes
+      | allocLiveBytes;
   }
 
+private:
+  /**
+   * \internal \brief Record and print the allocations of the phase that
+   * ended, then start counting the next
+   */
+  void endAllocPhase();
+
 private:
   std::vector<std::unique_ptr<Reporter>> reporters_;
   int first_valid_reporter_ = -1;
+  TimeType alloc_phase_start_ = TimeType{0.};
+
+  diagnostic::Counter allocCount;
+  diagnostic::Counter allocBytes;
+  diagnostic::Gauge allocLiveBytes;
 };
 
 }}} /* end namespace vt::util::memory */
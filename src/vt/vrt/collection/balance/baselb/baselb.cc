@@ -56,6 +56,7 @@
 #include "vt/vrt/collection/balance/model/load_model.h"
 #include "vt/phase/phase_manager.h"
 
+#include <algorithm>
 #include <tuple>
 
 namespace vt { namespace vrt { namespace collection { namespace lb {
@@ -76,11 +77,19 @@ std::shared_ptr<const balance::Reassignment> BaseLB::startLB(
 
   importProcessorData(in_stats, in_comm_lb_data, in_data_map);
 
-  runInEpochCollective("BaseLB::startLB -> runLB", [this,total_load]{
-    getArgs(phase_);
-    inputParams(config_entry_.get());
-    runLB(total_load);
-  });
+  bool const incremental = theConfig()->vt_lb_incremental and
+    theConfig()->vt_lb_imbalance_threshold > 0.;
+
+  auto const run = [this,total_load,incremental]{
+    if (incremental) {
+      runIncremental();
+    } else {
+      getArgs(phase_);
+      inputParams(config_entry_.get());
+      runLB(total_load);
+    }
+  };
+  runInEpochCollective("BaseLB::startLB -> runLB", run);
 
   return normalizeReassignments();
 }
@@ -130,11 +139,6 @@ std::shared_ptr<const balance::Reassignment> BaseLB::normalizeReassignments() {
   auto this_node = theContext()->getNode();
   pending_reassignment_->node_ = this_node;
 
-  runInEpochCollective("Sum migrations", [&] {
-    int32_t local_migration_count = transfers_.size();
-    proxy_.allreduce<&BaseLB::finalize, collective::PlusOp>(local_migration_count);
-  });
-
   std::map<NodeType, ObjDestinationListType> migrate_other;
 
   // Do local setup of reassignment data structure
@@ -214,6 +218,20 @@ std::shared_ptr<const balance::Reassignment> BaseLB::normalizeReassignments() {
   // And now, all nodes should have complete data on which objects
   // will be arriving, and how much load they represent
 
+  int32_t local_rejected_count = 0;
+  if (theConfig()->vt_lb_memory_capacity > 0) {
+    runInEpochCollective("BaseLB -> rejectOverCapacity", [&]{
+      local_rejected_count = rejectOverCapacity();
+    });
+  }
+
+  runInEpochCollective("Sum migrations", [&] {
+    int32_t local_migration_count = pending_reassignment_->depart_.size();
+    proxy_.allreduce<&BaseLB::finalize, collective::PlusOp>(
+      local_migration_count, local_rejected_count
+    );
+  });
+
   return pending_reassignment_;
 }
 
@@ -243,31 +261,263 @@ void BaseLB::notifyNewHostNodeOfObjectsArriving(
   }
 }
 
+int32_t BaseLB::rejectOverCapacity() {
+  using namespace balance;
+
+  auto const this_node = theContext()->getNode();
+  auto const capacity = static_cast<double>(theConfig()->vt_lb_memory_capacity);
+  PhaseOffset const when{PhaseOffset::NEXT_PHASE, PhaseOffset::WHOLE_PHASE};
+
+  double resident = theLBManager()->getMemoryBaseline();
+  for (auto obj : *load_model_) {
+    resident += getObjectMemory(load_model_, obj, when);
+  }
+
+  std::vector<std::tuple<double, ObjIDType>> arrivals;
+  for (auto&& arrival : pending_reassignment_->arrive_) {
+    auto const obj_id = std::get<0>(arrival);
+    if (obj_id.curr_node != this_node) {
+      auto const& obj_user_data = std::get<2>(arrival.second);
+      arrivals.emplace_back(getObjectMemory(obj_user_data), obj_id);
+    }
+  }
+
+  // Admit the smallest objects first so that as many transfers as possible
+  // fit; ties are broken by ID so the outcome is deterministic
+  std::sort(
+    arrivals.begin(), arrivals.end(), [](auto const& a, auto const& b) {
+      if (std::get<0>(a) != std::get<0>(b)) {
+        return std::get<0>(a) < std::get<0>(b);
+      }
+      return std::get<1>(a).id < std::get<1>(b).id;
+    }
+  );
+
+  int32_t rejected_count = 0;
+  std::map<NodeType, ObjListType> rejected;
+  for (auto&& [mem, obj_id] : arrivals) {
+    if (resident + mem <= capacity) {
+      resident += mem;
+    } else {
+      pending_reassignment_->arrive_.erase(obj_id);
+      rejected[obj_id.curr_node].push_back(obj_id);
+      rejected_count++;
+    }
+  }
+
+  vt_debug_print(
+    normal, lb,
+    "rejectOverCapacity: capacity={}, resident={}, arrivals={}, rejected={}\n",
+    capacity, resident, arrivals.size(), rejected_count
+  );
+
+  using RejectMsgType = TransferMsg<ObjListType>;
+  for (auto&& [current_host, vec] : rejected) {
+    proxy_[current_host].template send<
+      RejectMsgType, &BaseLB::notifyCurrentHostNodeOfObjectsRejected
+    >(vec);
+  }
+
+  return rejected_count;
+}
+
+void BaseLB::runIncremental() {
+  using namespace balance;
+
+  auto const this_node = theContext()->getNode();
+  auto const num_nodes = theContext()->getNumNodes();
+  auto const threshold = theConfig()->vt_lb_imbalance_threshold;
+  PhaseOffset const when{PhaseOffset::NEXT_PHASE, PhaseOffset::WHOLE_PHASE};
+
+  LoadType this_load = 0;
+  for (auto obj : *load_model_) {
+    this_load += load_model_->getModeledLoad(obj, when);
+  }
+  auto const avg_load =
+    base_stats_->at(Statistic::Rank_load_modeled).at(StatisticQuantity::avg);
+  bool const overloaded =
+    avg_load > 0 and this_load / avg_load - 1.0 >= threshold;
+
+  neighbors_.clear();
+  neighbor_loads_.clear();
+  load_requests_.clear();
+  load_grants_.clear();
+
+  std::set<NodeType> candidates;
+  if (num_nodes > 1) {
+    candidates.insert((this_node + num_nodes - 1) % num_nodes);
+    candidates.insert((this_node + 1) % num_nodes);
+  }
+  for (auto&& [key, volume] : *comm_data) {
+    if (key.commCategory() == elm::CommCategory::SendRecv and key.offNode()) {
+      for (auto node : {key.fromObj().curr_node, key.toObj().curr_node}) {
+        if (node != this_node) {
+          candidates.insert(node);
+        }
+      }
+    }
+  }
+  neighbors_.insert(candidates.begin(), candidates.end());
+
+  // A rank that names this one as a neighbor becomes a neighbor here too
+  runInEpochCollective("BaseLB::runIncremental -> neighbors", [&]{
+    for (auto node : candidates) {
+      proxy_[node].template send<
+        TransferMsg<NodeType>, &BaseLB::addNeighbor
+      >(this_node);
+    }
+  });
+
+  runInEpochCollective("BaseLB::runIncremental -> loads", [&]{
+    for (auto node : neighbors_) {
+      proxy_[node].template send<
+        TransferMsg<NodeLoadType>, &BaseLB::recvNeighborLoad
+      >(NodeLoadType{this_node, this_load});
+    }
+  });
+
+  // Ask the neighbors below the average for room, in proportion to how far
+  // below it they are
+  runInEpochCollective("BaseLB::runIncremental -> request", [&]{
+    if (not overloaded) {
+      return;
+    }
+    LoadType total_room = 0;
+    for (auto&& [node, load] : neighbor_loads_) {
+      total_room += std::max(avg_load - load, 0.);
+    }
+    if (total_room <= 0) {
+      return;
+    }
+    auto const wanted = std::min(this_load - avg_load, total_room);
+    for (auto&& [node, load] : neighbor_loads_) {
+      if (load < avg_load) {
+        proxy_[node].template send<
+          TransferMsg<NodeLoadType>, &BaseLB::recvLoadRequest
+        >(NodeLoadType{this_node, wanted * (avg_load - load) / total_room});
+      }
+    }
+  });
+
+  // Split the room here among the requests, so that together the objects
+  // arriving never take this rank above the average
+  runInEpochCollective("BaseLB::runIncremental -> grant", [&]{
+    LoadType total_requested = 0;
+    for (auto&& [node, amount] : load_requests_) {
+      total_requested += amount;
+    }
+    auto const room = avg_load - this_load;
+    if (total_requested <= 0 or room <= 0) {
+      return;
+    }
+    auto const scale = std::min(1.0, room / total_requested);
+    for (auto&& [node, amount] : load_requests_) {
+      proxy_[node].template send<
+        TransferMsg<NodeLoadType>, &BaseLB::recvLoadGrant
+      >(NodeLoadType{this_node, amount * scale});
+    }
+  });
+
+  // Fill each grant with the heaviest objects that still fit
+  std::vector<std::tuple<LoadType, ObjIDType>> objs;
+  if (not load_grants_.empty()) {
+    for (auto obj : *load_model_) {
+      if (obj.isMigratable()) {
+        objs.emplace_back(load_model_->getModeledLoad(obj, when), obj);
+      }
+    }
+    std::sort(
+      objs.begin(), objs.end(), [](auto const& a, auto const& b) {
+        if (std::get<0>(a) != std::get<0>(b)) {
+          return std::get<0>(a) > std::get<0>(b);
+        }
+        return std::get<1>(a).id < std::get<1>(b).id;
+      }
+    );
+  }
+
+  std::vector<bool> moved(objs.size(), false);
+  int32_t moved_count = 0;
+  for (auto&& [node, grant] : load_grants_) {
+    auto left = grant;
+    for (std::size_t i = 0; i < objs.size(); i++) {
+      auto const& [load, obj] = objs[i];
+      if (not moved[i] and load <= left) {
+        moved[i] = true;
+        left -= load;
+        migrateObjectTo(obj, node);
+        moved_count++;
+      }
+    }
+  }
+
+  vt_debug_print(
+    normal, lb,
+    "runIncremental: load={}, avg={}, overloaded={}, neighbors={}, "
+    "grants={}, moved={}\n",
+    this_load, avg_load, overloaded, neighbors_.size(), load_grants_.size(),
+    moved_count
+  );
+}
+
+void BaseLB::addNeighbor(TransferMsg<NodeType>* msg) {
+  neighbors_.insert(msg->getTransfer());
+}
+
+void BaseLB::recvNeighborLoad(TransferMsg<NodeLoadType>* msg) {
+  auto const& [node, load] = msg->getTransfer();
+  neighbor_loads_[node] = load;
+}
+
+void BaseLB::recvLoadRequest(TransferMsg<NodeLoadType>* msg) {
+  auto const& [node, amount] = msg->getTransfer();
+  load_requests_[node] = amount;
+}
+
+void BaseLB::recvLoadGrant(TransferMsg<NodeLoadType>* msg) {
+  auto const& [node, amount] = msg->getTransfer();
+  load_grants_[node] = amount;
+}
+
+void BaseLB::notifyCurrentHostNodeOfObjectsRejected(
+  TransferMsg<ObjListType>* msg
+) {
+  for (auto&& obj_id : msg->getTransfer()) {
+    pending_reassignment_->depart_.erase(obj_id);
+  }
+}
+
 void BaseLB::migrateObjectTo(ObjIDType const obj_id, NodeType const to) {
   if (obj_id.curr_node != to || theConfig()->vt_lb_self_migration) {
     transfers_.push_back(TransferDestType{obj_id, to});
   }
 }
 
-void BaseLB::finalize(int32_t global_count) {
+void BaseLB::finalize(int32_t global_count, int32_t global_rejected_count) {
   if (migration_count_cb_) {
     migration_count_cb_(global_count);
   }
 
   pending_reassignment_->global_migration_count = global_count;
+  pending_reassignment_->global_rejected_count = global_rejected_count;
+  pending_reassignment_->strategy_stats_ = strategy_stats_;
 
   auto const& this_node = theContext()->getNode();
   if (this_node == 0) {
     auto const total_time = timing::getCurrentTime() - start_time_;
     vt_debug_print(
       terse, lb,
-      "BaseLB::finalize: LB total time={}\n",
-      total_time
+      "BaseLB::finalize: LB total time={}, rejected transfers={}\n",
+      total_time, global_rejected_count
     );
     fflush(stdout);
   }
 }
 
+void BaseLB::recordStrategyStatistic(std::string const& name, double value) {
+  strategy_stats_[name] = value;
+}
+
 void BaseLB::recvSharedEdges(CommMsg* msg) {
   auto phase = thePhase()->getCurrentPhase();
   auto comm_map = theNodeLBData()->getNodeComm(phase);
@@ -53,6 +53,7 @@
 
 #include <set>
 #include <map>
+#include <string>
 #include <unordered_map>
 #include <tuple>
 #include <chrono>
@@ -82,6 +83,8 @@ struct BaseLB {
     std::tuple<ObjIDType, LoadSummary, LoadSummary, balance::ElmUserDataType>
   >;
   using ObjDestinationListType = std::vector<std::tuple<ObjIDType, NodeType>>;
+  using ObjListType      = std::vector<ObjIDType>;
+  using NodeLoadType     = std::tuple<NodeType, LoadType>;
 
   explicit BaseLB(bool in_comm_aware = false)
     : comm_aware_(in_comm_aware),
@@ -141,6 +144,13 @@ struct BaseLB {
   void notifyNewHostNodeOfObjectsArriving(
     TransferMsg<ObjLoadListType>* msg
   );
+  void notifyCurrentHostNodeOfObjectsRejected(
+    TransferMsg<ObjListType>* msg
+  );
+  void addNeighbor(TransferMsg<NodeType>* msg);
+  void recvNeighborLoad(TransferMsg<NodeLoadType>* msg);
+  void recvLoadRequest(TransferMsg<NodeLoadType>* msg);
+  void recvLoadGrant(TransferMsg<NodeLoadType>* msg);
 
   LoadType loadMilli(LoadType const& load);
 
@@ -151,7 +161,7 @@ struct BaseLB {
   void migrateObjectTo(ObjIDType const obj_id, NodeType const node);
   void transferSend(NodeType from, TransferVecType const& transfer);
   void transferMigrations(TransferMsg<TransferVecType>* msg);
-  void finalize(int32_t global_count);
+  void finalize(int32_t global_count, int32_t global_rejected_count);
 
   virtual void inputParams(balance::ConfigEntry* config) = 0;
   virtual void runLB(LoadType total_load) = 0;
@@ -185,6 +195,45 @@ protected:
    */
   std::shared_ptr<const balance::Reassignment> normalizeReassignments();
 
+  /**
+   * \brief Reject arriving objects that would take this rank over the memory
+   * capacity given by \c --vt_lb_memory_capacity, notifying their current
+   * hosts so they stay in place
+   *
+   * This applies to the transfers of every strategy after they are proposed.
+   * The objects departing this rank are still counted against it, since their
+   * own destinations may reject them.
+   *
+   * \return the number of rejected transfers
+   */
+  int32_t rejectOverCapacity();
+
+  /**
+   * \brief Rebalance locally instead of running the strategy, when the LB was
+   * triggered by \c --vt_lb_imbalance_threshold with \c --vt_lb_incremental
+   *
+   * The neighbors of a rank are the adjacent ranks and the ranks its objects
+   * communicate with, made symmetric by telling each of them. Neighbors
+   * exchange their loads; a rank whose own imbalance reaches the threshold
+   * asks its neighbors below the average for room, each of those splits its
+   * room among the requests, and the overloaded rank fills its grants with
+   * its heaviest objects that fit. Only overloaded ranks look at their
+   * objects, so the cost follows how much the loads changed, and no rank is
+   * taken above the average.
+   *
+   * This must be called collectively.
+   */
+  void runIncremental();
+
+  /**
+   * \brief Record a quantity about this run of the strategy, such as its
+   * predicted imbalance, to report with the post-LB statistics
+   *
+   * \param[in] name the key under "strategy" in the statistics file
+   * \param[in] value the value, which must be the same on every rank
+   */
+  void recordStrategyStatistic(std::string const& name, double value);
+
   static void setStrategySpecificModel(
     std::shared_ptr<balance::LoadModel> model
   );
@@ -221,6 +270,11 @@ private:
   int32_t local_migration_count_                  = 0;
   MigrationCountCB migration_count_cb_            = nullptr;
   StatisticMapType const* base_stats_             = nullptr;
+  std::map<std::string, double> strategy_stats_   = {};
+  std::set<NodeType> neighbors_                   = {};
+  std::map<NodeType, LoadType> neighbor_loads_    = {};
+  std::map<NodeType, LoadType> load_requests_     = {};
+  std::map<NodeType, LoadType> load_grants_       = {};
   std::shared_ptr<balance::Reassignment> pending_reassignment_ = nullptr;
 };
 
@@ -0,0 +1,128 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                              lb_thread_pool.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include "vt/config.h"
+#include "vt/vrt/collection/balance/baselb/lb_thread_pool.h"
+
+namespace vt { namespace vrt { namespace collection { namespace lb {
+
+LBThreadPool::LBThreadPool(int in_num_threads)
+  : num_threads_(std::max(in_num_threads, 1))
+{
+  for (int t = 1; t < num_threads_; t++) {
+    workers_.emplace_back([this, t]{ workerLoop(static_cast<std::size_t>(t)); });
+  }
+}
+
+LBThreadPool::~LBThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  start_cv_.notify_all();
+  for (auto&& worker : workers_) {
+    worker.join();
+  }
+}
+
+std::size_t LBThreadPool::numChunks(std::size_t n) const {
+  return std::min(n, static_cast<std::size_t>(num_threads_));
+}
+
+void LBThreadPool::parallelFor(std::size_t n, RangeFnType fn) {
+  auto const k = numChunks(n);
+  if (k <= 1) {
+    if (n > 0) {
+      fn(0, n);
+    }
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    job_ = fn;
+    job_size_ = n;
+    job_chunks_ = k;
+    pending_ = workers_.size();
+    generation_++;
+  }
+  start_cv_.notify_all();
+
+  fn(chunkBegin(n, k, 0), chunkBegin(n, k, 1));
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  done_cv_.wait(lock, [this]{ return pending_ == 0; });
+  job_ = nullptr;
+}
+
+void LBThreadPool::workerLoop(std::size_t chunk) {
+  uint64_t seen = 0;
+  while (true) {
+    RangeFnType fn = nullptr;
+    std::size_t n = 0, k = 0;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      start_cv_.wait(lock, [&]{ return stop_ or generation_ != seen; });
+      if (stop_) {
+        return;
+      }
+      seen = generation_;
+      fn = job_;
+      n = job_size_;
+      k = job_chunks_;
+    }
+
+    // Jobs with fewer chunks than threads leave the last workers idle
+    if (chunk < k) {
+      fn(chunkBegin(n, k, chunk), chunkBegin(n, k, chunk + 1));
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      pending_--;
+    }
+    done_cv_.notify_one();
+  }
+}
+
+}}}} /* end namespace vt::vrt::collection::lb */
@@ -0,0 +1,179 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                               lb_thread_pool.h
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_VRT_COLLECTION_BALANCE_BASELB_LB_THREAD_POOL_H
+#define INCLUDED_VT_VRT_COLLECTION_BALANCE_BASELB_LB_THREAD_POOL_H
+
+#include "vt/config.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace vt { namespace vrt { namespace collection { namespace lb {
+
+/**
+ * \struct LBThreadPool
+ *
+ * \brief A fixed pool of threads that LB strategies use to compute a new
+ * distribution on a rank.
+ *
+ * The pool only runs pure computation over the strategy's local data: no
+ * messages are sent and no runtime components are touched from the workers.
+ * Work is split into static, contiguous chunks (the calling thread runs the
+ * first one), so a strategy that writes each result to its own slot and
+ * combines the slots in order gets the same answer for any number of threads.
+ */
+struct LBThreadPool {
+  using RangeFnType = std::function<void(std::size_t, std::size_t)>;
+
+  /**
+   * \brief Start the workers
+   *
+   * \param[in] in_num_threads the number of threads, including the caller
+   */
+  explicit LBThreadPool(int in_num_threads);
+
+  LBThreadPool(LBThreadPool const&) = delete;
+  LBThreadPool& operator=(LBThreadPool const&) = delete;
+
+  ~LBThreadPool();
+
+  /**
+   * \brief Get the number of threads, including the caller
+   */
+  int getNumThreads() const { return num_threads_; }
+
+  /**
+   * \brief Run \c fn over <tt>[0, n)</tt> split into contiguous chunks, one
+   * per thread; returns when all chunks are done
+   *
+   * \param[in] n the number of indices
+   * \param[in] fn called with <tt>[begin, end)</tt> of each chunk
+   */
+  void parallelFor(std::size_t n, RangeFnType fn);
+
+  /**
+   * \brief Sort a random-access range; the result is the same as
+   * \c std::stable_sort for any number of threads
+   *
+   * \param[in] begin the beginning of the range
+   * \param[in] end the end of the range
+   * \param[in] comp the comparator
+   */
+  template <typename RandomIt, typename CompareT>
+  void sort(RandomIt begin, RandomIt end, CompareT comp) {
+    auto const n = static_cast<std::size_t>(std::distance(begin, end));
+    auto const k = numChunks(n);
+    if (k <= 1) {
+      std::stable_sort(begin, end, comp);
+      return;
+    }
+
+    auto bound = [&](std::size_t c) { return begin + chunkBegin(n, k, c); };
+
+    parallelFor(k, [&](std::size_t cb, std::size_t ce) {
+      for (std::size_t c = cb; c < ce; c++) {
+        std::stable_sort(bound(c), bound(c + 1), comp);
+      }
+    });
+
+    // Merge neighboring runs; the left run always wins ties, so the result
+    // is stable
+    for (std::size_t width = 1; width < k; width *= 2) {
+      auto const pairs = (k + 2 * width - 1) / (2 * width);
+      parallelFor(pairs, [&](std::size_t pb, std::size_t pe) {
+        for (std::size_t p = pb; p < pe; p++) {
+          auto const lo = p * 2 * width;
+          auto const mid = std::min(lo + width, k);
+          auto const hi = std::min(lo + 2 * width, k);
+          if (mid < hi) {
+            std::inplace_merge(bound(lo), bound(mid), bound(hi), comp);
+          }
+        }
+      });
+    }
+  }
+
+private:
+  /**
+   * \internal \brief The number of chunks to split \c n indices into
+   */
+  std::size_t numChunks(std::size_t n) const;
+
+  /**
+   * \internal \brief The first index of chunk \c c of \c k over \c n indices
+   */
+  static std::size_t chunkBegin(std::size_t n, std::size_t k, std::size_t c) {
+    return n * c / k;
+  }
+
+  /**
+   * \internal \brief The loop each worker runs until the pool is destroyed
+   *
+   * \param[in] chunk the chunk this worker runs in each job
+   */
+  void workerLoop(std::size_t chunk);
+
+private:
+  int num_threads_ = 1;
+  std::vector<std::thread> workers_;
+  std::mutex mutex_;
+  std::condition_variable start_cv_;
+  std::condition_variable done_cv_;
+  RangeFnType job_ = nullptr;
+  std::size_t job_size_ = 0;
+  std::size_t job_chunks_ = 0;
+  uint64_t generation_ = 0;
+  std::size_t pending_ = 0;
+  bool stop_ = false;
+};
+
+}}}} /* end namespace vt::vrt::collection::lb */
+
+#endif /*INCLUDED_VT_VRT_COLLECTION_BALANCE_BASELB_LB_THREAD_POOL_H*/
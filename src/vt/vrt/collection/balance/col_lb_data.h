@@ -76,6 +76,11 @@ public:
 
 protected:
   static std::unordered_map<VirtualProxyType, SubphaseType> focused_subphase_;
+
+  /// The element's serialized size for the LB memory capacity, measured the
+  /// first time it is needed and again only in phases that run the LB
+  std::size_t serialized_bytes_ = 0;
+  bool has_serialized_bytes_ = false;
 };
 
 }}}} /* end namespace vt::vrt::collection::balance */
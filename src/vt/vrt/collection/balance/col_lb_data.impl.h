@@ -74,6 +74,25 @@ void CollectionLBData::syncNextPhase(ColT* col, CollectStatsMsg<ColT>* msg) {
 
   auto const proxy = col->getProxy();
   auto const subphase = getFocusedSubPhase(proxy);
+
+  if (
+    theConfig()->vt_lb_memory_capacity > 0 and
+    not col->valExists(footprint_bytes_key)
+  ) {
+    // Sizing walks the whole element, so other phases reuse the last size
+    auto const phase = lb_data.getPhase();
+    if (
+      not lb_data.has_serialized_bytes_ or
+      theLBManager()->decideLBToRun(phase) != LBType::NoLB
+    ) {
+      lb_data.serialized_bytes_ = checkpoint::getSize(*col);
+      lb_data.has_serialized_bytes_ = true;
+    }
+    theNodeLBData()->addSerializedSize(
+      col->elm_id_, phase, lb_data.serialized_bytes_
+    );
+  }
+
   theNodeLBData()->addNodeLBData(col->elm_id_, &col->lb_data_, col, subphase);
 
   std::vector<uint64_t> idx;
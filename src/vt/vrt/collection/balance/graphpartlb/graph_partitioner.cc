@@ -0,0 +1,495 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                             graph_partitioner.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include "vt/config.h"
+#include "vt/vrt/collection/balance/graphpartlb/graph_partitioner.h"
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <set>
+
+namespace vt { namespace vrt { namespace collection { namespace lb {
+
+PartGraph::VertexType PartGraph::addVertex(
+  LoadType load, NodeType home, bool fixed
+) {
+  load_.push_back(load);
+  home_.push_back(home);
+  fixed_.push_back(fixed ? 1 : 0);
+  adj_.emplace_back();
+  return load_.size() - 1;
+}
+
+void PartGraph::addEdge(VertexType a, VertexType b, double weight) {
+  if (a != b) {
+    adj_[a].emplace_back(b, weight);
+    adj_[b].emplace_back(a, weight);
+  }
+}
+
+void PartGraph::finalize() {
+  for (auto&& edges : adj_) {
+    std::sort(
+      edges.begin(), edges.end(), [](EdgeType const& e1, EdgeType const& e2) {
+        return std::get<0>(e1) < std::get<0>(e2);
+      }
+    );
+    std::vector<EdgeType> merged;
+    for (auto&& [u, w] : edges) {
+      if (not merged.empty() and std::get<0>(merged.back()) == u) {
+        std::get<1>(merged.back()) += w;
+      } else {
+        merged.emplace_back(u, w);
+      }
+    }
+    edges = std::move(merged);
+  }
+}
+
+LoadType PartGraph::getTotalLoad() const {
+  LoadType total = 0;
+  for (auto&& load : load_) {
+    total += load;
+  }
+  return total;
+}
+
+double PartGraph::getEdgeCut(std::vector<NodeType> const& part) const {
+  double cut = 0;
+  for (VertexType v = 0; v < adj_.size(); v++) {
+    for (auto&& [u, w] : adj_[v]) {
+      if (v < u and part[v] != part[u]) {
+        cut += w;
+      }
+    }
+  }
+  return cut;
+}
+
+MultilevelPartitioner::MultilevelPartitioner(
+  int in_num_parts, double in_tolerance, std::size_t in_coarse_target,
+  int in_refine_passes
+) : num_parts_(std::max(in_num_parts, 1)),
+    tolerance_(in_tolerance),
+    coarse_target_(in_coarse_target),
+    refine_passes_(in_refine_passes)
+{ }
+
+/*static*/ std::vector<MultilevelPartitioner::VertexType>
+MultilevelPartitioner::matchHeavyEdges(
+  PartGraph const& graph, LoadType max_load, std::size_t& num_coarse
+) {
+  auto const n = graph.getNumVertices();
+  std::vector<VertexType> coarse_of(n, PartGraph::no_vertex);
+
+  num_coarse = 0;
+  for (VertexType v = 0; v < n; v++) {
+    if (coarse_of[v] != PartGraph::no_vertex) {
+      continue;
+    }
+    coarse_of[v] = num_coarse;
+
+    if (not graph.isFixed(v)) {
+      // Neighbors are sorted, so ties go to the lowest vertex
+      VertexType best = PartGraph::no_vertex;
+      double best_weight = 0;
+      for (auto&& [u, w] : graph.getEdges(v)) {
+        if (
+          coarse_of[u] == PartGraph::no_vertex and not graph.isFixed(u) and
+          graph.getLoad(v) + graph.getLoad(u) <= max_load and w > best_weight
+        ) {
+          best = u;
+          best_weight = w;
+        }
+      }
+      if (best != PartGraph::no_vertex) {
+        coarse_of[best] = num_coarse;
+      }
+    }
+
+    num_coarse++;
+  }
+
+  return coarse_of;
+}
+
+/*static*/ PartGraph MultilevelPartitioner::contract(
+  PartGraph const& graph, std::vector<VertexType> const& coarse_of,
+  std::size_t num_coarse
+) {
+  auto const n = graph.getNumVertices();
+
+  std::vector<LoadType> load(num_coarse, 0.);
+  std::vector<LoadType> heaviest(num_coarse, -1.);
+  std::vector<NodeType> home(num_coarse, uninitialized_destination);
+  std::vector<bool> fixed(num_coarse, false);
+  for (VertexType v = 0; v < n; v++) {
+    auto const c = coarse_of[v];
+    load[c] += graph.getLoad(v);
+    if (graph.getLoad(v) > heaviest[c]) {
+      heaviest[c] = graph.getLoad(v);
+      home[c] = graph.getHome(v);
+    }
+    fixed[c] = fixed[c] or graph.isFixed(v);
+  }
+
+  PartGraph coarse;
+  for (VertexType c = 0; c < num_coarse; c++) {
+    coarse.addVertex(load[c], home[c], fixed[c]);
+  }
+  for (VertexType v = 0; v < n; v++) {
+    for (auto&& [u, w] : graph.getEdges(v)) {
+      if (v < u) {
+        coarse.addEdge(coarse_of[v], coarse_of[u], w);
+      }
+    }
+  }
+  coarse.finalize();
+  return coarse;
+}
+
+std::vector<NodeType> MultilevelPartitioner::partition(
+  PartGraph const& graph
+) const {
+  auto const total_load = graph.getTotalLoad();
+  auto const max_part_load = total_load / num_parts_ * (1.0 + tolerance_);
+  auto const target = std::max(
+    coarse_target_, static_cast<std::size_t>(num_parts_)
+  );
+
+  // Cap the coarse vertices so that the coarsest graph still has enough of
+  // them to balance
+  auto const max_vertex_load = total_load / target;
+
+  std::vector<PartGraph> levels;
+  std::vector<std::vector<VertexType>> maps;
+  auto current = [&]() -> PartGraph const& {
+    return levels.empty() ? graph : levels.back();
+  };
+
+  while (current().getNumVertices() > target) {
+    std::size_t num_coarse = 0;
+    auto coarse_of = matchHeavyEdges(current(), max_vertex_load, num_coarse);
+
+    // Stop when matching barely shrinks the graph any more
+    if (num_coarse * 10 > current().getNumVertices() * 9) {
+      break;
+    }
+
+    auto coarse = contract(current(), coarse_of, num_coarse);
+    maps.push_back(std::move(coarse_of));
+    levels.push_back(std::move(coarse));
+  }
+
+  // Start from the current placement, so that balancing and refinement only
+  // move what they need to
+  auto const& coarsest = current();
+  std::vector<NodeType> part(coarsest.getNumVertices());
+  for (VertexType v = 0; v < part.size(); v++) {
+    auto const home = coarsest.getHome(v);
+    part[v] = home >= 0 and home < num_parts_ ?
+      home : static_cast<NodeType>(v % num_parts_);
+  }
+  refine(coarsest, part, max_part_load);
+
+  for (std::size_t level = maps.size(); level > 0; level--) {
+    auto const& fine = level == 1 ? graph : levels[level - 2];
+    auto const& coarse_of = maps[level - 1];
+
+    std::vector<NodeType> fine_part(fine.getNumVertices());
+    for (VertexType v = 0; v < fine_part.size(); v++) {
+      fine_part[v] = part[coarse_of[v]];
+    }
+    part = std::move(fine_part);
+    refine(fine, part, max_part_load);
+  }
+
+  return part;
+}
+
+void MultilevelPartitioner::refine(
+  PartGraph const& graph, std::vector<NodeType>& part,
+  LoadType max_part_load
+) const {
+  auto const n = graph.getNumVertices();
+
+  std::vector<LoadType> part_load(num_parts_, 0.);
+  for (VertexType v = 0; v < n; v++) {
+    part_load[part[v]] += graph.getLoad(v);
+  }
+
+  auto move = [&](VertexType v, NodeType to) {
+    part_load[part[v]] -= graph.getLoad(v);
+    part_load[to] += graph.getLoad(v);
+    part[v] = to;
+  };
+
+  // The edge weight from a vertex to each part it is connected to
+  std::vector<std::tuple<NodeType, double>> conn;
+  auto connect = [&](VertexType v) {
+    conn.clear();
+    for (auto&& [u, w] : graph.getEdges(v)) {
+      auto iter = std::find_if(
+        conn.begin(), conn.end(), [&](auto const& c) {
+          return std::get<0>(c) == part[u];
+        }
+      );
+      if (iter != conn.end()) {
+        std::get<1>(*iter) += w;
+      } else {
+        conn.emplace_back(part[u], w);
+      }
+    }
+  };
+  auto connTo = [&](NodeType p) {
+    for (auto&& [q, w] : conn) {
+      if (q == p) {
+        return w;
+      }
+    }
+    return 0.0;
+  };
+
+  for (int pass = 0; pass < refine_passes_; pass++) {
+    bool moved = false;
+
+    // Drain the parts over the bound, trying the vertices that cost the least
+    // edge cut to move first
+    std::vector<std::tuple<double, VertexType>> candidates;
+    for (VertexType v = 0; v < n; v++) {
+      if (not graph.isFixed(v) and part_load[part[v]] > max_part_load) {
+        connect(v);
+        double external = 0;
+        for (auto&& [q, w] : conn) {
+          if (q != part[v]) {
+            external = std::max(external, w);
+          }
+        }
+        candidates.emplace_back(external - connTo(part[v]), v);
+      }
+    }
+    std::stable_sort(
+      candidates.begin(), candidates.end(), [](auto const& a, auto const& b) {
+        return std::get<0>(a) > std::get<0>(b);
+      }
+    );
+
+    for (auto&& [gain, v] : candidates) {
+      auto const from = part[v];
+      auto const load = graph.getLoad(v);
+      if (part_load[from] <= max_part_load) {
+        continue;
+      }
+
+      // Prefer the best connected part that can take the vertex
+      connect(v);
+      NodeType to = uninitialized_destination;
+      double best = 0;
+      for (auto&& [q, w] : conn) {
+        if (
+          q != from and part_load[q] + load <= max_part_load and
+          (to == uninitialized_destination or w > best)
+        ) {
+          to = q;
+          best = w;
+        }
+      }
+
+      // Otherwise the least loaded part, as long as the pair gets more even
+      if (to == uninitialized_destination) {
+        auto const least = static_cast<NodeType>(
+          std::min_element(part_load.begin(), part_load.end()) -
+          part_load.begin()
+        );
+        if (least != from and part_load[least] + load < part_load[from]) {
+          to = least;
+        }
+      }
+
+      if (to != uninitialized_destination) {
+        move(v, to);
+        moved = true;
+      }
+    }
+
+    if (passFM(graph, part, part_load, max_part_load)) {
+      moved = true;
+    }
+
+    if (not moved) {
+      break;
+    }
+  }
+}
+
+bool MultilevelPartitioner::passFM(
+  PartGraph const& graph, std::vector<NodeType>& part,
+  std::vector<LoadType>& part_load, LoadType max_part_load
+) const {
+  auto const n = graph.getNumVertices();
+
+  auto move = [&](VertexType v, NodeType to) {
+    part_load[part[v]] -= graph.getLoad(v);
+    part_load[to] += graph.getLoad(v);
+    part[v] = to;
+  };
+
+  // The part a vertex gains the most edge weight by moving to, as long as the
+  // bound holds there; the gain may be negative
+  std::vector<std::tuple<NodeType, double>> conn;
+  auto bestMove = [&](VertexType v) {
+    conn.clear();
+    for (auto&& [u, w] : graph.getEdges(v)) {
+      auto iter = std::find_if(
+        conn.begin(), conn.end(), [&](auto const& c) {
+          return std::get<0>(c) == part[u];
+        }
+      );
+      if (iter != conn.end()) {
+        std::get<1>(*iter) += w;
+      } else {
+        conn.emplace_back(part[u], w);
+      }
+    }
+
+    auto const from = part[v];
+    double internal = 0;
+    for (auto&& [q, w] : conn) {
+      if (q == from) {
+        internal = w;
+      }
+    }
+
+    NodeType to = uninitialized_destination;
+    double best_gain = 0;
+    for (auto&& [q, w] : conn) {
+      if (
+        q != from and part_load[q] + graph.getLoad(v) <= max_part_load and
+        (to == uninitialized_destination or w - internal > best_gain)
+      ) {
+        to = q;
+        best_gain = w - internal;
+      }
+    }
+    return std::make_tuple(to, best_gain);
+  };
+
+  // Gain buckets of the unlocked boundary vertices; within a bucket, the
+  // lowest vertex goes first
+  std::map<double, std::set<VertexType>, std::greater<>> buckets;
+  std::vector<double> gain_of(n, 0.);
+  std::vector<int8_t> queued(n, 0);
+  std::vector<int8_t> locked(n, 0);
+
+  auto enqueue = [&](VertexType v) {
+    auto const [to, gain] = bestMove(v);
+    if (to != uninitialized_destination) {
+      gain_of[v] = gain;
+      queued[v] = 1;
+      buckets[gain].insert(v);
+    }
+  };
+  auto dequeue = [&](VertexType v) {
+    if (queued[v]) {
+      auto iter = buckets.find(gain_of[v]);
+      iter->second.erase(v);
+      if (iter->second.empty()) {
+        buckets.erase(iter);
+      }
+      queued[v] = 0;
+    }
+  };
+
+  for (VertexType v = 0; v < n; v++) {
+    if (not graph.isFixed(v)) {
+      enqueue(v);
+    }
+  }
+
+  // Keep moving past the best cut seen, through moves that make it worse, to
+  // climb out of local minima; give up after a stretch without improvement
+  auto const max_stall = std::max(min_fm_stall, n / 4);
+
+  std::vector<std::tuple<VertexType, NodeType>> moves;
+  double total_gain = 0;
+  double best_gain = 0;
+  std::size_t best_prefix = 0;
+  while (not buckets.empty() and moves.size() - best_prefix < max_stall) {
+    auto const v = *buckets.begin()->second.begin();
+    dequeue(v);
+    locked[v] = 1;
+
+    // Other moves may have filled the part this vertex was queued for
+    auto const [to, gain] = bestMove(v);
+    if (to == uninitialized_destination) {
+      continue;
+    }
+
+    moves.emplace_back(v, part[v]);
+    move(v, to);
+    total_gain += gain;
+    if (total_gain > best_gain) {
+      best_gain = total_gain;
+      best_prefix = moves.size();
+    }
+
+    for (auto&& [u, w] : graph.getEdges(v)) {
+      if (not locked[u] and not graph.isFixed(u)) {
+        dequeue(u);
+        enqueue(u);
+      }
+    }
+  }
+
+  // Roll back to the prefix of moves with the largest total gain
+  while (moves.size() > best_prefix) {
+    auto const [v, from] = moves.back();
+    move(v, from);
+    moves.pop_back();
+  }
+
+  return best_prefix > 0;
+}
+
+}}}} /* end namespace vt::vrt::collection::lb */
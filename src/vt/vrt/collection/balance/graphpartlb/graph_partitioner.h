@@ -0,0 +1,236 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                             graph_partitioner.h
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_VRT_COLLECTION_BALANCE_GRAPHPARTLB_GRAPH_PARTITIONER_H
+#define INCLUDED_VT_VRT_COLLECTION_BALANCE_GRAPHPARTLB_GRAPH_PARTITIONER_H
+
+#include "vt/config.h"
+
+#include <cstdint>
+#include <limits>
+#include <tuple>
+#include <vector>
+
+namespace vt { namespace vrt { namespace collection { namespace lb {
+
+/**
+ * \struct PartGraph
+ *
+ * \brief An undirected graph with weighted vertices and edges, where each
+ * vertex has the rank it currently lives on
+ *
+ * Fixed vertices are never matched or moved by the partitioner.
+ */
+struct PartGraph {
+  using VertexType = std::size_t;
+  using EdgeType   = std::tuple<VertexType, double>;
+
+  static constexpr VertexType const no_vertex =
+    std::numeric_limits<VertexType>::max();
+
+  /**
+   * \brief Add a vertex
+   *
+   * \param[in] load the weight of the vertex
+   * \param[in] home the rank the vertex lives on
+   * \param[in] fixed whether the vertex must stay on its rank
+   *
+   * \return the new vertex
+   */
+  VertexType addVertex(LoadType load, NodeType home, bool fixed = false);
+
+  /**
+   * \brief Add weight to the edge between two vertices; self edges are
+   * ignored and parallel edges are merged by \c finalize
+   *
+   * \param[in] a the first vertex
+   * \param[in] b the second vertex
+   * \param[in] weight the weight to add
+   */
+  void addEdge(VertexType a, VertexType b, double weight);
+
+  /**
+   * \brief Merge parallel edges and sort the neighbors of each vertex; must be
+   * called after the last \c addEdge
+   */
+  void finalize();
+
+  std::size_t getNumVertices() const { return load_.size(); }
+  LoadType getLoad(VertexType v) const { return load_[v]; }
+  NodeType getHome(VertexType v) const { return home_[v]; }
+  bool isFixed(VertexType v) const { return fixed_[v] != 0; }
+  std::vector<EdgeType> const& getEdges(VertexType v) const { return adj_[v]; }
+
+  /**
+   * \brief Get the total load of all vertices
+   */
+  LoadType getTotalLoad() const;
+
+  /**
+   * \brief Get the total weight of the edges between vertices in different
+   * parts
+   *
+   * \param[in] part the part of each vertex
+   */
+  double getEdgeCut(std::vector<NodeType> const& part) const;
+
+private:
+  std::vector<LoadType> load_;
+  std::vector<NodeType> home_;
+  std::vector<int8_t> fixed_;
+  std::vector<std::vector<EdgeType>> adj_;
+};
+
+/**
+ * \struct MultilevelPartitioner
+ *
+ * \brief Multilevel graph partitioner: coarsening by heavy-edge matching, an
+ * initial partition from the current placement, and Fiduccia-Mattheyses (FM)
+ * refinement while projecting back to the input graph
+ *
+ * Every step visits vertices and parts in index order, so the partition only
+ * depends on the input graph.
+ */
+struct MultilevelPartitioner {
+  using VertexType = PartGraph::VertexType;
+
+  /// The fewest moves an FM pass makes past its best cut before giving up
+  static constexpr std::size_t const min_fm_stall = 50;
+
+  /**
+   * \brief Construct a partitioner
+   *
+   * \param[in] in_num_parts the number of parts (ranks)
+   * \param[in] in_tolerance the allowed load of a part above the average, as
+   * a fraction of the average
+   * \param[in] in_coarse_target stop coarsening at this number of vertices
+   * \param[in] in_refine_passes the maximum refinement passes per level
+   */
+  MultilevelPartitioner(
+    int in_num_parts, double in_tolerance, std::size_t in_coarse_target,
+    int in_refine_passes
+  );
+
+  /**
+   * \brief Partition a finalized graph
+   *
+   * \param[in] graph the graph
+   *
+   * \return the part of each vertex
+   */
+  std::vector<NodeType> partition(PartGraph const& graph) const;
+
+  /**
+   * \brief Match each vertex with the unmatched neighbor it shares the
+   * heaviest edge with, as long as their combined load stays under a cap
+   *
+   * \param[in] graph the graph
+   * \param[in] max_load the largest load of a matched pair
+   * \param[out] num_coarse the number of coarse vertices
+   *
+   * \return the coarse vertex of each vertex
+   */
+  static std::vector<VertexType> matchHeavyEdges(
+    PartGraph const& graph, LoadType max_load, std::size_t& num_coarse
+  );
+
+  /**
+   * \brief Contract a graph along a matching; a coarse vertex lives where its
+   * heaviest member lives
+   *
+   * \param[in] graph the graph
+   * \param[in] coarse_of the coarse vertex of each vertex
+   * \param[in] num_coarse the number of coarse vertices
+   *
+   * \return the finalized coarse graph
+   */
+  static PartGraph contract(
+    PartGraph const& graph, std::vector<VertexType> const& coarse_of,
+    std::size_t num_coarse
+  );
+
+private:
+  /**
+   * \internal \brief Move vertices out of parts over the load bound, then run
+   * FM passes, until neither changes the partition
+   *
+   * \param[in] graph the graph
+   * \param[in,out] part the part of each vertex
+   * \param[in] max_part_load the load bound of a part
+   */
+  void refine(
+    PartGraph const& graph, std::vector<NodeType>& part,
+    LoadType max_part_load
+  ) const;
+
+  /**
+   * \internal \brief Run one FM pass
+   *
+   * Boundary vertices sit in gain buckets. The pass repeatedly moves the
+   * vertex with the highest gain to its best part under the load bound, even
+   * when the gain is negative, locks it and updates the gains of its
+   * neighbors. It then rolls back to the prefix of moves with the largest
+   * total gain.
+   *
+   * \param[in] graph the graph
+   * \param[in,out] part the part of each vertex
+   * \param[in,out] part_load the load of each part
+   * \param[in] max_part_load the load bound of a part
+   *
+   * \return whether the pass reduced the edge cut
+   */
+  bool passFM(
+    PartGraph const& graph, std::vector<NodeType>& part,
+    std::vector<LoadType>& part_load, LoadType max_part_load
+  ) const;
+
+private:
+  int num_parts_ = 1;
+  double tolerance_ = 0.05;
+  std::size_t coarse_target_ = 0;
+  int refine_passes_ = 4;
+};
+
+}}}} /* end namespace vt::vrt::collection::lb */
+
+#endif /*INCLUDED_VT_VRT_COLLECTION_BALANCE_GRAPHPARTLB_GRAPH_PARTITIONER_H*/
@@ -0,0 +1,585 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                graphpartlb.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include "vt/config.h"
+#include "vt/vrt/collection/balance/graphpartlb/graphpartlb.h"
+#include "vt/vrt/collection/balance/graphpartlb/graph_partitioner.h"
+#include "vt/vrt/collection/balance/model/load_model.h"
+#include "vt/context/context.h"
+#include "vt/timing/timing.h"
+
+#include <algorithm>
+#include <map>
+#include <numeric>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace vt { namespace vrt { namespace collection { namespace lb {
+
+void GraphPartLB::init(objgroup::proxy::Proxy<GraphPartLB> in_proxy) {
+  proxy = in_proxy;
+}
+
+/*static*/ std::unordered_map<std::string, std::string>
+GraphPartLB::getInputKeysWithHelp() {
+  std::unordered_map<std::string, std::string> const keys_help = {
+    {
+      "tolerance",
+      R"(
+Values: <double>
+Default: 0.05
+Description:
+  The load a rank may have above the average rank load after load balancing,
+  as a fraction of the average. Larger values leave the partitioner more room
+  to reduce communication between ranks.
+)"
+    },
+    {
+      "clusters_per_rank",
+      R"(
+Values: <int>
+Default: 8
+Description:
+  Bound on the load of the clusters each rank coarsens its objects into, as
+  the average rank load divided by this value. Objects in a cluster always
+  migrate together, so larger values allow finer balance at the cost of a
+  larger graph on the root.
+)"
+    },
+    {
+      "coarse_vertices_per_rank",
+      R"(
+Values: <int>
+Default: 4
+Description:
+  The root stops coarsening the gathered graph once it has at most this many
+  vertices per rank.
+)"
+    },
+    {
+      "refine_passes",
+      R"(
+Values: <int>
+Default: 8
+Description:
+  The maximum number of refinement passes at each level of the multilevel
+  partitioner.
+)"
+    },
+    {
+      "match_rounds",
+      R"(
+Values: <int>
+Default: 2
+Description:
+  The number of rounds in which clusters match with clusters on neighboring
+  ranks before they are gathered on the root. In each round, every cluster
+  proposes to the remote cluster it communicates with the most, and mutual
+  proposals match. With 0, only the local clusters are gathered.
+)"
+    }
+  };
+  return keys_help;
+}
+
+void GraphPartLB::inputParams(balance::ConfigEntry* config) {
+  auto keys_help = getInputKeysWithHelp();
+
+  std::vector<std::string> allowed;
+  for (auto&& elm : keys_help) {
+    allowed.push_back(elm.first);
+  }
+  config->checkAllowedKeys(allowed);
+  tolerance_ = config->getOrDefault<double>("tolerance", tolerance_);
+  clusters_per_rank_ = config->getOrDefault<int32_t>(
+    "clusters_per_rank", clusters_per_rank_
+  );
+  coarse_vertices_per_rank_ = config->getOrDefault<int32_t>(
+    "coarse_vertices_per_rank", coarse_vertices_per_rank_
+  );
+  refine_passes_ = config->getOrDefault<int32_t>(
+    "refine_passes", refine_passes_
+  );
+  match_rounds_ = config->getOrDefault<int32_t>("match_rounds", match_rounds_);
+
+  vtAbortIf(tolerance_ < 0, "GraphPartLB: tolerance must not be negative");
+  vtAbortIf(
+    clusters_per_rank_ < 1 or coarse_vertices_per_rank_ < 1,
+    "GraphPartLB: clusters_per_rank and coarse_vertices_per_rank must be "
+    "positive"
+  );
+  vtAbortIf(
+    match_rounds_ < 0, "GraphPartLB: match_rounds must not be negative"
+  );
+}
+
+void GraphPartLB::runLB(LoadType) {
+  auto const this_node = theContext()->getNode();
+
+  if (theContext()->getNumNodes() > 1) {
+    swapEdges();
+  }
+
+  auto payload = coarsenLocal();
+
+  if (match_rounds_ > 0 and theContext()->getNumNodes() > 1) {
+    matchAcrossRanks(payload);
+  }
+
+  if (this_node == 0) {
+    payloads_.resize(theContext()->getNumNodes());
+  }
+
+  runInEpochCollective("GraphPartLB::runLB -> gather", [&]{
+    proxy[0].send<&GraphPartLB::collectHandler>(payload);
+  });
+
+  runInEpochCollective("GraphPartLB::runLB -> partition", [&]{
+    if (this_node == 0) {
+      partitionAtRoot();
+    }
+  });
+}
+
+GraphPartPayload GraphPartLB::coarsenLocal() {
+  using namespace balance;
+  using VertexType = PartGraph::VertexType;
+
+  auto const this_node = theContext()->getNode();
+  PhaseOffset const when{PhaseOffset::NEXT_PHASE, PhaseOffset::WHOLE_PHASE};
+
+  // Sort the objects so that the clusters are deterministic
+  std::vector<ObjIDType> objs;
+  for (auto obj : *load_model_) {
+    objs.push_back(obj);
+  }
+  std::sort(objs.begin(), objs.end());
+
+  PartGraph graph;
+  std::unordered_map<ElementIDType, VertexType> vertex_of;
+  for (auto&& obj : objs) {
+    vertex_of[obj.id] = graph.addVertex(
+      load_model_->getModeledLoad(obj, when), this_node, not obj.isMigratable()
+    );
+  }
+
+  // Messages between elements are recorded on the receiving rank only, so an
+  // edge between ranks is reported to the root by the rank of its receiver.
+  // The sending rank learns of the edge from swapEdges
+  std::vector<std::tuple<VertexType, ElementIDType, double>> remote;
+  std::vector<std::tuple<VertexType, ObjIDType, double>> cross;
+  std::set<VertexType> boundary;
+  for (auto&& [key, volume] : *comm_data) {
+    if (key.commCategory() != elm::CommCategory::SendRecv) {
+      continue;
+    }
+    auto from = vertex_of.find(key.fromObj().id);
+    auto to = vertex_of.find(key.toObj().id);
+    if (from != vertex_of.end() and to != vertex_of.end()) {
+      graph.addEdge(from->second, to->second, volume.bytes);
+    } else if (to != vertex_of.end()) {
+      remote.emplace_back(to->second, key.fromObj().id, volume.bytes);
+      cross.emplace_back(to->second, key.fromObj(), volume.bytes);
+      boundary.insert(to->second);
+    }
+  }
+  for (auto&& [obj, remote_obj, bytes] : given_edges_) {
+    if (auto iter = vertex_of.find(obj); iter != vertex_of.end()) {
+      cross.emplace_back(iter->second, remote_obj, bytes);
+      boundary.insert(iter->second);
+    }
+  }
+  given_edges_.clear();
+  graph.finalize();
+
+  // Match repeatedly while clusters stay under the load bound
+  auto const max_cluster_load = getMaxClusterLoad();
+
+  std::vector<VertexType> cluster_of(graph.getNumVertices());
+  std::iota(cluster_of.begin(), cluster_of.end(), 0);
+  PartGraph clusters = std::move(graph);
+  while (true) {
+    std::size_t num_coarse = 0;
+    auto coarse_of = MultilevelPartitioner::matchHeavyEdges(
+      clusters, max_cluster_load, num_coarse
+    );
+    if (num_coarse == clusters.getNumVertices()) {
+      break;
+    }
+    for (auto&& c : cluster_of) {
+      c = coarse_of[c];
+    }
+    clusters = MultilevelPartitioner::contract(clusters, coarse_of, num_coarse);
+  }
+
+  auto const num_clusters = clusters.getNumVertices();
+  cluster_objs_.clear();
+  cluster_objs_.resize(num_clusters);
+  for (VertexType v = 0; v < objs.size(); v++) {
+    cluster_objs_[cluster_of[v]].push_back(objs[v]);
+  }
+
+  GraphPartPayload payload;
+  payload.node = this_node;
+  for (VertexType c = 0; c < num_clusters; c++) {
+    payload.loads.push_back(clusters.getLoad(c));
+    payload.fixed.push_back(clusters.isFixed(c) ? 1 : 0);
+    for (auto&& [u, w] : clusters.getEdges(c)) {
+      if (c < u) {
+        payload.local_edges.emplace_back(
+          static_cast<int32_t>(c), static_cast<int32_t>(u), w
+        );
+      }
+    }
+  }
+  for (auto&& [v, id, w] : remote) {
+    payload.remote_edges.emplace_back(
+      static_cast<int32_t>(cluster_of[v]), id, w
+    );
+  }
+  for (auto&& v : boundary) {
+    payload.boundary.emplace_back(
+      objs[v].id, static_cast<int32_t>(cluster_of[v])
+    );
+  }
+  cross_edges_.clear();
+  for (auto&& [v, remote_obj, w] : cross) {
+    cross_edges_.emplace_back(
+      static_cast<int32_t>(cluster_of[v]), objs[v].id, remote_obj, w
+    );
+  }
+
+  vt_debug_print(
+    normal, lb,
+    "GraphPartLB::coarsenLocal: objects={}, clusters={}, remote edges={}\n",
+    objs.size(), num_clusters, remote.size()
+  );
+
+  return payload;
+}
+
+void GraphPartLB::swapEdges() {
+  using namespace balance;
+
+  std::unordered_set<ElementIDType> local;
+  for (auto obj : *load_model_) {
+    local.insert(obj.id);
+  }
+
+  // Give the rank of each remote sender the edges recorded here, so both ends
+  // of an edge between ranks know of it
+  std::map<
+    NodeType, std::vector<std::tuple<ElementIDType, ObjIDType, double>>
+  > edges;
+  for (auto&& [key, volume] : *comm_data) {
+    if (key.commCategory() != elm::CommCategory::SendRecv) {
+      continue;
+    }
+    auto const& from = key.fromObj();
+    auto const& to = key.toObj();
+    if (local.find(to.id) != local.end() and
+        local.find(from.id) == local.end()) {
+      edges[from.curr_node].emplace_back(from.id, to, volume.bytes);
+    }
+  }
+
+  runInEpochCollective("GraphPartLB::swapEdges", [&]{
+    for (auto&& [node, list] : edges) {
+      proxy[node].send<&GraphPartLB::edgesHandler>(list);
+    }
+  });
+}
+
+LoadType GraphPartLB::getMaxClusterLoad() const {
+  auto const avg_load = getStats()->at(
+    lb::Statistic::Rank_load_modeled
+  ).at(lb::StatisticQuantity::avg);
+  return avg_load / clusters_per_rank_;
+}
+
+void GraphPartLB::matchAcrossRanks(GraphPartPayload& payload) {
+  using ElementIDType = balance::ElementIDType;
+
+  auto const this_node = theContext()->getNode();
+  auto const max_cluster_load = getMaxClusterLoad();
+  auto const num_clusters = payload.loads.size();
+
+  // Tell each neighboring rank the cluster of every object here it
+  // communicates with; fixed clusters stay out of the matching
+  std::map<
+    NodeType, std::vector<std::tuple<ElementIDType, int32_t, LoadType>>
+  > boundary;
+  for (auto&& [c, obj, remote_obj, w] : cross_edges_) {
+    if (payload.fixed[c] == 0) {
+      boundary[remote_obj.curr_node].emplace_back(obj, c, payload.loads[c]);
+    }
+  }
+
+  runInEpochCollective("GraphPartLB::matchAcrossRanks -> boundary", [&]{
+    for (auto&& [node, objs] : boundary) {
+      std::sort(objs.begin(), objs.end());
+      objs.erase(std::unique(objs.begin(), objs.end()), objs.end());
+      proxy[node].send<&GraphPartLB::boundaryHandler>(this_node, objs);
+    }
+  });
+
+  std::vector<int8_t> matched(num_clusters, 0);
+  std::size_t num_matched = 0;
+  for (int32_t round = 0; round < match_rounds_; round++) {
+    // Sum the bytes between each unmatched cluster and the remote clusters it
+    // may match with
+    std::map<std::tuple<int32_t, NodeType, int32_t>, double> weights;
+    for (auto&& [c, obj, remote_obj, w] : cross_edges_) {
+      auto iter = remote_clusters_.find(remote_obj.id);
+      if (matched[c] or payload.fixed[c] or iter == remote_clusters_.end()) {
+        continue;
+      }
+      auto const& [node, remote_c, remote_load] = iter->second;
+      if (payload.loads[c] + remote_load <= max_cluster_load) {
+        weights[std::make_tuple(c, node, remote_c)] += w;
+      }
+    }
+
+    // Propose along the heaviest edge; ties go to the lowest rank and cluster
+    std::vector<std::tuple<NodeType, int32_t, double>> best(
+      num_clusters, std::make_tuple(uninitialized_destination, -1, 0.0)
+    );
+    for (auto&& [key, w] : weights) {
+      auto const& [c, node, remote_c] = key;
+      if (w > std::get<2>(best[c])) {
+        best[c] = std::make_tuple(node, remote_c, w);
+      }
+    }
+
+    std::map<
+      NodeType, std::vector<std::tuple<int32_t, int32_t, LoadType>>
+    > proposals;
+    for (std::size_t c = 0; c < num_clusters; c++) {
+      auto const& [node, remote_c, w] = best[c];
+      if (node != uninitialized_destination) {
+        proposals[node].emplace_back(
+          remote_c, static_cast<int32_t>(c), payload.loads[c]
+        );
+      }
+    }
+
+    runInEpochCollective("GraphPartLB::matchAcrossRanks -> propose", [&]{
+      for (auto&& [node, list] : proposals) {
+        proxy[node].send<&GraphPartLB::proposeHandler>(this_node, list);
+      }
+    });
+
+    // A proposal from the cluster this one proposed to is mutual. Both ranks
+    // fold the lighter cluster of the pair into the heavier one, so they
+    // agree on where the pair lives
+    for (auto&& [node, c, remote_c, remote_load] : proposals_) {
+      auto const& [best_node, best_c, w] = best[c];
+      if (matched[c] or best_node != node or best_c != remote_c) {
+        continue;
+      }
+      matched[c] = 1;
+      num_matched++;
+
+      auto const load = payload.loads[c];
+      if (remote_load > load or (remote_load == load and node < this_node)) {
+        payload.merged.emplace_back(c, node, remote_c);
+      }
+    }
+    proposals_.clear();
+  }
+
+  vt_debug_print(
+    normal, lb,
+    "GraphPartLB::matchAcrossRanks: clusters={}, matched={}, folded={}\n",
+    num_clusters, num_matched, payload.merged.size()
+  );
+
+  cross_edges_.clear();
+  remote_clusters_.clear();
+}
+
+void GraphPartLB::boundaryHandler(
+  NodeType from,
+  std::vector<std::tuple<balance::ElementIDType, int32_t, LoadType>> const&
+    objs
+) {
+  for (auto&& [obj, c, load] : objs) {
+    remote_clusters_[obj] = std::make_tuple(from, c, load);
+  }
+}
+
+void GraphPartLB::edgesHandler(
+  std::vector<std::tuple<balance::ElementIDType, ObjIDType, double>> const&
+    edges
+) {
+  given_edges_.insert(given_edges_.end(), edges.begin(), edges.end());
+}
+
+void GraphPartLB::proposeHandler(
+  NodeType from,
+  std::vector<std::tuple<int32_t, int32_t, LoadType>> const& proposals
+) {
+  for (auto&& [c, remote_c, remote_load] : proposals) {
+    proposals_.emplace_back(from, c, remote_c, remote_load);
+  }
+}
+
+void GraphPartLB::collectHandler(GraphPartPayload payload) {
+  auto const node = payload.node;
+  payloads_[node] = std::move(payload);
+}
+
+void GraphPartLB::partitionAtRoot() {
+  using VertexType = PartGraph::VertexType;
+
+  auto const num_nodes = theContext()->getNumNodes();
+  auto const start_time = timing::getCurrentTime();
+
+  // A cluster matched across ranks is folded into its partner, which carries
+  // the load of both
+  std::vector<std::vector<LoadType>> loads(num_nodes);
+  std::vector<std::vector<int8_t>> folded(num_nodes);
+  for (NodeType node = 0; node < num_nodes; node++) {
+    loads[node] = payloads_[node].loads;
+    folded[node].resize(loads[node].size(), 0);
+  }
+  for (NodeType node = 0; node < num_nodes; node++) {
+    for (auto&& [c, owner, owner_c] : payloads_[node].merged) {
+      loads[owner][owner_c] += payloads_[node].loads[c];
+      folded[node][c] = 1;
+    }
+  }
+
+  PartGraph graph;
+  std::vector<std::vector<VertexType>> vertex(num_nodes);
+  for (NodeType node = 0; node < num_nodes; node++) {
+    auto const& payload = payloads_[node];
+    vertex[node].resize(payload.loads.size(), PartGraph::no_vertex);
+    for (std::size_t c = 0; c < payload.loads.size(); c++) {
+      if (not folded[node][c]) {
+        vertex[node][c] = graph.addVertex(
+          loads[node][c], node, payload.fixed[c] != 0
+        );
+      }
+    }
+  }
+  for (NodeType node = 0; node < num_nodes; node++) {
+    for (auto&& [c, owner, owner_c] : payloads_[node].merged) {
+      vertex[node][c] = vertex[owner][owner_c];
+    }
+  }
+
+  std::unordered_map<balance::ElementIDType, VertexType> vertex_of;
+  for (NodeType node = 0; node < num_nodes; node++) {
+    for (auto&& [obj, c] : payloads_[node].boundary) {
+      vertex_of[obj] = vertex[node][c];
+    }
+  }
+  for (NodeType node = 0; node < num_nodes; node++) {
+    auto const& payload = payloads_[node];
+    for (auto&& [a, b, w] : payload.local_edges) {
+      graph.addEdge(vertex[node][a], vertex[node][b], w);
+    }
+    for (auto&& [c, obj, w] : payload.remote_edges) {
+      if (auto iter = vertex_of.find(obj); iter != vertex_of.end()) {
+        graph.addEdge(vertex[node][c], iter->second, w);
+      }
+    }
+  }
+  graph.finalize();
+
+  MultilevelPartitioner partitioner{
+    num_nodes, tolerance_,
+    static_cast<std::size_t>(coarse_vertices_per_rank_) * num_nodes,
+    refine_passes_
+  };
+  auto const part = partitioner.partition(graph);
+
+  std::vector<NodeType> home(graph.getNumVertices());
+  std::vector<LoadType> before(num_nodes, 0.), after(num_nodes, 0.);
+  for (VertexType v = 0; v < home.size(); v++) {
+    home[v] = graph.getHome(v);
+    before[home[v]] += graph.getLoad(v);
+    after[part[v]] += graph.getLoad(v);
+  }
+
+  auto const avg_load = graph.getTotalLoad() / num_nodes;
+  auto const max_before = *std::max_element(before.begin(), before.end());
+  auto const max_after = *std::max_element(after.begin(), after.end());
+  auto const partition_time = timing::getCurrentTime() - start_time;
+  vt_debug_print(
+    terse, lb,
+    "GraphPartLB: clusters={}, partition time={}, edge cut: before={}, "
+    "after={}, I: before={:.2f}, after={:.2f}\n",
+    graph.getNumVertices(), partition_time, graph.getEdgeCut(home),
+    graph.getEdgeCut(part),
+    avg_load > 0 ? max_before / avg_load - 1.0 : 0.0,
+    avg_load > 0 ? max_after / avg_load - 1.0 : 0.0
+  );
+
+  for (NodeType node = 0; node < num_nodes; node++) {
+    std::vector<NodeType> dests;
+    for (auto&& v : vertex[node]) {
+      dests.push_back(part[v]);
+    }
+    proxy[node].send<&GraphPartLB::assignHandler>(dests);
+  }
+
+  payloads_.clear();
+}
+
+void GraphPartLB::assignHandler(std::vector<NodeType> const& dests) {
+  auto const this_node = theContext()->getNode();
+  for (std::size_t c = 0; c < dests.size(); c++) {
+    if (dests[c] != this_node) {
+      for (auto&& obj : cluster_objs_[c]) {
+        if (obj.isMigratable()) {
+          migrateObjectTo(obj, dests[c]);
+        }
+      }
+    }
+  }
+}
+
+}}}} /* end namespace vt::vrt::collection::lb */
@@ -0,0 +1,167 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                graphpartlb.h
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_VRT_COLLECTION_BALANCE_GRAPHPARTLB_GRAPHPARTLB_H
+#define INCLUDED_VT_VRT_COLLECTION_BALANCE_GRAPHPARTLB_GRAPHPARTLB_H
+
+#include "vt/config.h"
+#include "vt/vrt/collection/balance/baselb/baselb.h"
+#include "vt/vrt/collection/balance/graphpartlb/graphpartlb_msgs.h"
+
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+namespace vt { namespace vrt { namespace collection { namespace lb {
+
+/**
+ * \struct GraphPartLB
+ *
+ * \brief Communication-aware LB by multilevel graph partitioning, without
+ * external partitioning libraries
+ *
+ * Each rank coarsens the graph of its objects, with edges weighted by the
+ * bytes they communicate, into clusters by heavy-edge matching. Clusters on
+ * neighboring ranks then match across ranks in a few rounds of proposals
+ * along their heaviest edges. The clusters of all ranks, along with the edges
+ * between them, are gathered on the root, which runs \c MultilevelPartitioner
+ * to assign each cluster to a rank. The objects of a cluster, or of a pair of
+ * clusters matched across ranks, migrate together.
+ */
+struct GraphPartLB : BaseLB {
+  GraphPartLB() { comm_aware_ = true; }
+
+  void init(objgroup::proxy::Proxy<GraphPartLB> in_proxy);
+  void runLB(LoadType total_load) override;
+  void inputParams(balance::ConfigEntry* config) override;
+
+  static std::unordered_map<std::string, std::string> getInputKeysWithHelp();
+
+private:
+  /**
+   * \internal \brief Send each edge between ranks recorded here to the rank
+   * of its sender
+   *
+   * Messages between elements are recorded on the receiving rank only; the
+   * sending rank needs the edge to report its object as a boundary object and
+   * to match across ranks along it.
+   */
+  void swapEdges();
+
+  /**
+   * \internal \brief Coarsen the local objects into clusters
+   *
+   * \return the clusters to send to the root
+   */
+  GraphPartPayload coarsenLocal();
+
+  /**
+   * \internal \brief Match clusters with clusters on neighboring ranks
+   *
+   * In each round, every unmatched cluster proposes to the remote cluster it
+   * shares the heaviest edge with, as long as their combined load stays under
+   * the cluster bound. Mutual proposals match, and the lighter cluster of the
+   * pair is folded into the heavier one in the payload.
+   *
+   * \param[in,out] payload the local clusters
+   */
+  void matchAcrossRanks(GraphPartPayload& payload);
+
+  /**
+   * \internal \brief Get the bound on the load of a cluster
+   */
+  LoadType getMaxClusterLoad() const;
+
+  /**
+   * \internal \brief Partition the gathered clusters and send each rank the
+   * destination of its clusters; called on the root
+   */
+  void partitionAtRoot();
+
+  void boundaryHandler(
+    NodeType from,
+    std::vector<std::tuple<balance::ElementIDType, int32_t, LoadType>> const&
+      objs
+  );
+  void edgesHandler(
+    std::vector<std::tuple<balance::ElementIDType, ObjIDType, double>> const&
+      edges
+  );
+  void proposeHandler(
+    NodeType from,
+    std::vector<std::tuple<int32_t, int32_t, LoadType>> const& proposals
+  );
+  void collectHandler(GraphPartPayload payload);
+  void assignHandler(std::vector<NodeType> const& dests);
+
+private:
+  objgroup::proxy::Proxy<GraphPartLB> proxy = {};
+  double tolerance_ = 0.05;
+  int32_t clusters_per_rank_ = 8;
+  int32_t coarse_vertices_per_rank_ = 4;
+  int32_t refine_passes_ = 8;
+  int32_t match_rounds_ = 2;
+  /// The objects in each local cluster
+  std::vector<std::vector<ObjIDType>> cluster_objs_ = {};
+  /// Edges to local objects recorded on the ranks of their receivers: (local
+  /// object, remote object, bytes)
+  std::vector<std::tuple<balance::ElementIDType, ObjIDType, double>>
+    given_edges_ = {};
+  /// Edges to objects on other ranks: (cluster, local object, remote object,
+  /// bytes), from both of their ends
+  std::vector<std::tuple<int32_t, balance::ElementIDType, ObjIDType, double>>
+    cross_edges_ = {};
+  /// The rank, cluster and cluster load of remote objects next to this rank
+  std::unordered_map<
+    balance::ElementIDType, std::tuple<NodeType, int32_t, LoadType>
+  > remote_clusters_ = {};
+  /// Proposals received this round: (rank, local cluster, remote cluster,
+  /// remote cluster load)
+  std::vector<std::tuple<NodeType, int32_t, int32_t, LoadType>> proposals_ = {};
+  /// The clusters of each rank, on the root
+  std::vector<GraphPartPayload> payloads_ = {};
+};
+
+}}}} /* end namespace vt::vrt::collection::lb */
+
+#endif /*INCLUDED_VT_VRT_COLLECTION_BALANCE_GRAPHPARTLB_GRAPHPARTLB_H*/
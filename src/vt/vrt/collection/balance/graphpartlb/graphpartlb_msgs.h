@@ -0,0 +1,92 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                              graphpartlb_msgs.h
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_VRT_COLLECTION_BALANCE_GRAPHPARTLB_GRAPHPARTLB_MSGS_H
+#define INCLUDED_VT_VRT_COLLECTION_BALANCE_GRAPHPARTLB_GRAPHPARTLB_MSGS_H
+
+#include "vt/config.h"
+#include "vt/vrt/collection/balance/lb_common.h"
+
+#include <tuple>
+#include <vector>
+
+namespace vt { namespace vrt { namespace collection { namespace lb {
+
+/**
+ * \struct GraphPartPayload
+ *
+ * \brief The clusters a rank coarsened its objects into, sent to the root
+ * to be partitioned
+ *
+ * Clusters are indexed locally. Edges to objects on other ranks name the
+ * remote object, which the root resolves through the boundary objects that
+ * rank reported.
+ */
+struct GraphPartPayload {
+  using ElementIDType = balance::ElementIDType;
+
+  /// The rank the clusters live on
+  NodeType node = uninitialized_destination;
+  /// The load of each cluster
+  std::vector<LoadType> loads;
+  /// Whether each cluster holds a non-migratable object
+  std::vector<int8_t> fixed;
+  /// Edges between two clusters: (cluster, cluster, bytes)
+  std::vector<std::tuple<int32_t, int32_t, double>> local_edges;
+  /// Edges to objects on other ranks: (cluster, remote object, bytes)
+  std::vector<std::tuple<int32_t, ElementIDType, double>> remote_edges;
+  /// The cluster of each object with edges to other ranks: (object, cluster)
+  std::vector<std::tuple<ElementIDType, int32_t>> boundary;
+  /// Clusters matched with a heavier cluster on another rank, which stand in
+  /// for both: (cluster, rank, cluster on that rank)
+  std::vector<std::tuple<int32_t, NodeType, int32_t>> merged;
+
+  template <typename SerializerT>
+  void serialize(SerializerT& s) {
+    s | node | loads | fixed | local_edges | remote_edges | boundary | merged;
+  }
+};
+
+}}}} /* end namespace vt::vrt::collection::lb */
+
+#endif /*INCLUDED_VT_VRT_COLLECTION_BALANCE_GRAPHPARTLB_GRAPHPARTLB_MSGS_H*/
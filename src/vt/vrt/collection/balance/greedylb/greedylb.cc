@@ -51,6 +51,7 @@
 #include "vt/vrt/collection/balance/greedylb/greedylb_constants.h"
 #include "vt/vrt/collection/balance/greedylb/greedylb_msgs.h"
 #include "vt/vrt/collection/balance/read_lb.h"
+#include "vt/vrt/collection/balance/lb_invoke/lb_manager.h"
 #include "vt/serialization/messaging/serialized_messenger.h"
 #include "vt/context/context.h"
 #include "vt/vrt/collection/manager.h"
@@ -62,6 +63,7 @@
 #include <memory>
 #include <vector>
 #include <algorithm>
+#include <functional>
 #include <cassert>
 
 namespace vt { namespace vrt { namespace collection { namespace lb {
@@ -115,6 +117,32 @@ Values: {scatter, bcast, pt2pt}
 Default: scatter
 Description:
   How to distribute the data after the centralized LB makes a decision
+)"
+    },
+    {
+      "group_size",
+      R"(
+Values: <int>
+Default: 0
+Description:
+  When greater than zero, run hierarchically over groups of this many
+  consecutive ranks instead of on a single root: each group gathers its
+  candidate objects to its first rank, the groups exchange only their
+  aggregate loads, candidates move from groups in surplus to groups in
+  deficit, and every group root makes its greedy assignment in parallel.
+  The "strategy" parameter does not apply.
+)"
+    },
+    {
+      "compare",
+      R"(
+Values: {true, false}
+Default: false
+Description:
+  With "group_size", also gather the same candidates to rank 0 and compute the
+  single-root assignment without applying it. Its predicted imbalance and time
+  are reported next to the hierarchical ones under "strategy" in the LB
+  statistics.
 )"
     }
   };
@@ -141,6 +169,9 @@ void GreedyLB::inputParams(balance::ConfigEntry* config) {
     }
   );
   strat_ = strategy_converter_.getFromConfig(config, strat_);
+  group_size_ = config->getOrDefault<int32_t>("group_size", 0);
+  vtAbortIf(group_size_ < 0, "GreedyLB: group_size must not be negative");
+  compare_ = config->getOrDefault<bool>("compare", false);
 }
 
 void GreedyLB::runLB(LoadType total_load) {
@@ -188,7 +219,11 @@ void GreedyLB::loadStats() {
 
   if (should_lb) {
     calcLoadOver();
-    reduceCollect();
+    if (group_size_ > 0) {
+      runHierarchical();
+    } else {
+      reduceCollect();
+    }
   }
 }
 
@@ -227,8 +262,14 @@ void GreedyLB::reduceCollect() {
 void GreedyLB::runBalancer(
   ObjSampleType&& in_objs, LoadProfileType&& in_profile
 ) {
-  using CompRecType = GreedyCompareLoadMax<GreedyRecord>;
-  using CompProcType = GreedyCompareLoadMin<GreedyProc>;
+  return transferObjs(
+    assignCollected(std::move(in_objs), std::move(in_profile))
+  );
+}
+
+std::vector<GreedyProc> GreedyLB::assignCollected(
+  ObjSampleType&& in_objs, LoadProfileType&& in_profile
+) const {
   auto const& num_nodes = theContext()->getNumNodes();
   ObjSampleType objs{std::move(in_objs)};
   LoadProfileType profile{std::move(in_profile)};
@@ -245,7 +286,6 @@ void GreedyLB::runBalancer(
       recs.emplace_back(GreedyRecord{obj,static_cast<LoadType>(bin)});
     }
   }
-  std::make_heap(recs.begin(), recs.end(), CompRecType());
   auto nodes = std::vector<GreedyProc>{};
   for (NodeType n = 0; n < num_nodes; n++) {
     auto iter = profile.find(n);
@@ -257,12 +297,23 @@ void GreedyLB::runBalancer(
       n, iter->second
     );
   }
+  return assignObjs(std::move(recs), std::move(nodes));
+}
+
+std::vector<GreedyProc> GreedyLB::assignObjs(
+  std::vector<GreedyRecord>&& recs, std::vector<GreedyProc>&& nodes
+) const {
+  using CompProcType = GreedyCompareLoadMin<GreedyProc>;
+
+  // Order the records heaviest first; the sort is stable, so the assignment
+  // is the same for any number of LB threads
+  theLBManager()->getThreadPool()->sort(
+    recs.begin(), recs.end(), [](GreedyRecord const& r1, GreedyRecord const& r2) {
+      return r1.getModeledLoad() > r2.getModeledLoad();
+    }
+  );
   std::make_heap(nodes.begin(), nodes.end(), CompProcType());
-  auto lb_size = recs.size();
-  for (size_t i = 0; i < lb_size; i++) {
-    std::pop_heap(recs.begin(), recs.end(), CompRecType());
-    auto max_rec = recs.back();
-    recs.pop_back();
+  for (auto const& max_rec : recs) {
     std::pop_heap(nodes.begin(), nodes.end(), CompProcType());
     auto min_node = nodes.back();
     nodes.pop_back();
@@ -279,7 +330,235 @@ void GreedyLB::runBalancer(
     nodes.push_back(min_node);
     std::push_heap(nodes.begin(), nodes.end(), CompProcType());
   }
-  return transferObjs(std::move(nodes));
+  return std::move(nodes);
+}
+
+NodeType GreedyLB::getGroupRoot(NodeType node) const {
+  return node / group_size_ * group_size_;
+}
+
+LoadType GreedyLB::getGroupLoad() const {
+  LoadType load = 0.0f;
+  for (auto&& elm : group_profile_) {
+    load += elm.second;
+  }
+  for (auto&& elm : group_objs_) {
+    load += static_cast<LoadType>(elm.first) * elm.second.size();
+  }
+  return load;
+}
+
+void GreedyLB::runHierarchical() {
+  auto const this_node = theContext()->getNode();
+  auto const num_nodes = theContext()->getNumNodes();
+  auto const num_groups = (num_nodes + group_size_ - 1) / group_size_;
+  auto const is_root = getGroupRoot(this_node) == this_node;
+
+  // Assign the same input on a single root first, without applying it, so the
+  // two can be compared
+  double root_lb_time = 0.0;
+  if (compare_) {
+    auto const root_start_time = timing::getCurrentTime();
+    runInEpochCollective("GreedyLB::runHierarchical -> compare", [&]{
+      proxy.reduce<&GreedyLB::compareHandler, collective::PlusOp>(
+        proxy[0], GreedyPayload{load_over, this_load}
+      );
+    });
+    if (this_node == 0) {
+      root_lb_time = (timing::getCurrentTime() - root_start_time).seconds();
+    }
+  }
+
+  auto const start_time = timing::getCurrentTime();
+
+  // Gather the candidates and remaining load of each rank to its group root
+  runInEpochCollective("GreedyLB::runHierarchical -> gather", [&]{
+    proxy[getGroupRoot(this_node)].send<&GreedyLB::groupCollectHandler>(
+      GreedyPayload{load_over, this_load}
+    );
+  });
+
+  // Exchange only one aggregate load per group
+  runInEpochCollective("GreedyLB::runHierarchical -> exchange", [&]{
+    std::vector<LoadType> loads(num_groups, 0.0f);
+    if (is_root) {
+      loads[this_node / group_size_] = getGroupLoad();
+    }
+    proxy.allreduce<&GreedyLB::groupLoadsHandler, collective::PlusOp>(
+      std::move(loads)
+    );
+  });
+
+  runInEpochCollective("GreedyLB::runHierarchical -> export", [&]{
+    if (is_root) {
+      exportGroupSurplus();
+    }
+  });
+
+  if (is_root) {
+    runGroupBalancer();
+  }
+
+  runInEpochCollective("GreedyLB::runHierarchical -> stats", [&]{
+    double const lb_time = (timing::getCurrentTime() - start_time).seconds();
+    proxy.allreduce<&GreedyLB::hierStatsHandler, collective::MaxOp>(
+      lb_time, group_max_load_, root_lb_time, root_max_load_
+    );
+  });
+}
+
+void GreedyLB::groupCollectHandler(GreedyPayload payload) {
+  for (auto&& elm : payload.getSample()) {
+    auto& list = group_objs_[elm.first];
+    list.insert(list.end(), elm.second.begin(), elm.second.end());
+  }
+  for (auto&& elm : payload.getLoadProfile()) {
+    group_profile_[elm.first] = elm.second;
+  }
+}
+
+void GreedyLB::groupLoadsHandler(std::vector<LoadType> const& loads) {
+  group_loads_ = loads;
+}
+
+std::vector<std::tuple<int32_t, LoadType>> GreedyLB::getGroupOutflows() const {
+  auto const num_nodes = theContext()->getNumNodes();
+  auto const this_group = theContext()->getNode() / group_size_;
+  auto const num_groups = static_cast<int32_t>(group_loads_.size());
+
+  LoadType total = 0.0f;
+  for (auto&& load : group_loads_) {
+    total += load;
+  }
+  auto const avg = total / num_nodes;
+
+  // Every root computes the same pairing of groups in surplus with groups in
+  // deficit, largest first, and keeps the flows out of its own group
+  std::vector<std::tuple<LoadType, int32_t>> surplus, deficit;
+  for (int32_t g = 0; g < num_groups; g++) {
+    auto const size = std::min<int32_t>(group_size_, num_nodes - g * group_size_);
+    auto const diff = group_loads_[g] - avg * size;
+    if (diff > 0) {
+      surplus.emplace_back(diff, g);
+    } else if (diff < 0) {
+      deficit.emplace_back(-diff, g);
+    }
+  }
+  std::sort(surplus.begin(), surplus.end(), std::greater<>());
+  std::sort(deficit.begin(), deficit.end(), std::greater<>());
+
+  std::vector<std::tuple<int32_t, LoadType>> outflows;
+  std::size_t i = 0, j = 0;
+  while (i < surplus.size() and j < deficit.size()) {
+    auto& [s, s_group] = surplus[i];
+    auto& [d, d_group] = deficit[j];
+    auto const amount = std::min(s, d);
+    if (s_group == this_group) {
+      outflows.emplace_back(d_group, amount);
+    }
+    s -= amount;
+    d -= amount;
+    if (s <= 0) {
+      i++;
+    }
+    if (d <= 0) {
+      j++;
+    }
+  }
+  return outflows;
+}
+
+void GreedyLB::exportGroupSurplus() {
+  for (auto&& [dest_group, amount] : getGroupOutflows()) {
+    // Move the largest candidates that bring the flow closer to its amount
+    ObjSampleType exports;
+    auto remaining = amount;
+    for (auto iter = group_objs_.rbegin(); iter != group_objs_.rend(); ++iter) {
+      auto const load = static_cast<LoadType>(iter->first);
+      auto& list = iter->second;
+      while (not list.empty() and load < 2 * remaining) {
+        exports[iter->first].push_back(list.back());
+        list.pop_back();
+        remaining -= load;
+      }
+    }
+
+    vt_debug_print(
+      normal, lb,
+      "GreedyLB::exportGroupSurplus: dest_group={}, amount={}, "
+      "remaining={}, bins={}\n",
+      dest_group, TimeTypeWrapper(amount / 1000),
+      TimeTypeWrapper(remaining / 1000), exports.size()
+    );
+
+    if (exports.size() > 0) {
+      proxy[dest_group * group_size_].send<&GreedyLB::groupImportHandler>(
+        exports
+      );
+    }
+  }
+}
+
+void GreedyLB::groupImportHandler(ObjSampleType objs) {
+  for (auto&& elm : objs) {
+    auto& list = group_objs_[elm.first];
+    list.insert(list.end(), elm.second.begin(), elm.second.end());
+  }
+}
+
+void GreedyLB::runGroupBalancer() {
+  std::vector<GreedyRecord> recs;
+  for (auto&& elm : group_objs_) {
+    for (auto&& obj : elm.second) {
+      recs.emplace_back(GreedyRecord{obj, static_cast<LoadType>(elm.first)});
+    }
+  }
+
+  auto nodes = std::vector<GreedyProc>{};
+  for (auto&& elm : group_profile_) {
+    nodes.emplace_back(GreedyProc{elm.first, elm.second});
+  }
+
+  vt_debug_print(
+    normal, lb,
+    "GreedyLB::runGroupBalancer: objs={}, nodes={}\n",
+    recs.size(), nodes.size()
+  );
+
+  // The objects may live anywhere, so their migrations are requested here
+  // and delivered to their current hosts by the base LB
+  for (auto&& proc : assignObjs(std::move(recs), std::move(nodes))) {
+    group_max_load_ = std::max(group_max_load_, proc.load_);
+    for (auto&& obj : proc.recs_) {
+      migrateObjectTo(obj, proc.node_);
+    }
+  }
+}
+
+void GreedyLB::compareHandler(GreedyPayload payload) {
+  auto procs = assignCollected(
+    std::move(payload.getSampleMove()), std::move(payload.getLoadProfileMove())
+  );
+  for (auto&& proc : procs) {
+    root_max_load_ = std::max(root_max_load_, proc.load_);
+  }
+}
+
+void GreedyLB::hierStatsHandler(
+  double lb_time, LoadType max_load, double root_lb_time,
+  LoadType root_max_load
+) {
+  auto const avg_load = loadMilli(getAvgLoad());
+  auto const imbalance = [avg_load](LoadType max) {
+    return avg_load > 0 ? max / avg_load - 1.0 : 0.0;
+  };
+
+  recordStrategyStatistic("hierarchical imbalance", imbalance(max_load));
+  recordStrategyStatistic("hierarchical time", lb_time);
+  if (compare_) {
+    recordStrategyStatistic("single-root imbalance", imbalance(root_max_load));
+    recordStrategyStatistic("single-root time", root_lb_time);
+  }
 }
 
 GreedyLB::ObjIDType GreedyLB::objSetNode(
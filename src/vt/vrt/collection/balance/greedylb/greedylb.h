@@ -57,6 +57,7 @@
 #include <vector>
 #include <memory>
 #include <list>
+#include <tuple>
 
 namespace vt { namespace vrt { namespace collection { namespace lb {
 
@@ -96,6 +97,12 @@ private:
   void calcLoadOver();
   void loadOverBin(ObjBinType bin, ObjBinListType& bin_list);
   void runBalancer(ObjSampleType&& objs, LoadProfileType&& profile);
+  std::vector<GreedyProc> assignCollected(
+    ObjSampleType&& objs, LoadProfileType&& profile
+  ) const;
+  std::vector<GreedyProc> assignObjs(
+    std::vector<GreedyRecord>&& recs, std::vector<GreedyProc>&& nodes
+  ) const;
   void transferObjs(std::vector<GreedyProc>&& load);
   ObjIDType objSetNode(NodeType const& node, ObjIDType const& id);
   void recvObjsDirect(std::size_t len, GreedyLBTypes::ObjIDType* objs);
@@ -104,6 +111,27 @@ private:
   void finishedTransferExchange();
   void collectHandler(GreedyPayload payload);
 
+  /**
+   * \brief Run the hierarchical variant: greedy assignment within groups of
+   * \c group_size_ ranks, in parallel at each group root, after the groups
+   * exchange only their aggregate loads and move candidate objects from
+   * groups in surplus to groups in deficit
+   */
+  void runHierarchical();
+  NodeType getGroupRoot(NodeType node) const;
+  LoadType getGroupLoad() const;
+  std::vector<std::tuple<int32_t, LoadType>> getGroupOutflows() const;
+  void exportGroupSurplus();
+  void runGroupBalancer();
+  void groupCollectHandler(GreedyPayload payload);
+  void groupLoadsHandler(std::vector<LoadType> const& loads);
+  void groupImportHandler(ObjSampleType objs);
+  void compareHandler(GreedyPayload payload);
+  void hierStatsHandler(
+    double lb_time, LoadType max_load, double root_lb_time,
+    LoadType root_max_load
+  );
+
   // This must stay static due to limitations in the scatter implementation
   // (does not work with objgroups)
   static void recvObjsHan(GreedyLBTypes::ObjIDType* objs);
@@ -122,6 +150,21 @@ private:
 
   DataDistStrategy strat_ = DataDistStrategy::scatter;
   LoadType this_load = 0.0f;
+
+  /// Ranks per group for the hierarchical variant; 0 for a single root
+  int32_t group_size_ = 0;
+  /// Candidate objects of the group, at its root
+  ObjSampleType group_objs_ = {};
+  /// Loads of the ranks in the group without the candidates, at its root
+  LoadProfileType group_profile_ = {};
+  /// Aggregate load of every group
+  std::vector<LoadType> group_loads_ = {};
+  /// Largest rank load assigned in the group, at its root
+  LoadType group_max_load_ = 0.0f;
+  /// Whether to also compute the single-root assignment for comparison
+  bool compare_ = false;
+  /// Largest rank load of the single-root assignment, at rank 0
+  LoadType root_max_load_ = 0.0f;
 };
 
 inline auto format_as(DataDistStrategy c) {
@@ -117,6 +117,26 @@ ElmUserDataType getObjectUserData(
   return ret;
 }
 
+double getObjectMemory(ElmUserDataType const& user_data) {
+  for (auto key : {footprint_bytes_key, serialized_bytes_key}) {
+    auto iter = user_data.find(key);
+    if (iter != user_data.end()) {
+      if (auto v = std::get_if<double>(&iter->second)) {
+        return *v;
+      } else if (auto i = std::get_if<int>(&iter->second)) {
+        return static_cast<double>(*i);
+      }
+    }
+  }
+  return 0.0;
+}
+
+double getObjectMemory(
+  LoadModel* model, ElementIDStruct object, PhaseOffset when
+) {
+  return getObjectMemory(getObjectUserData(model, object, when));
+}
+
 LoadSummary getNodeLoads(std::shared_ptr<LoadModel> model, PhaseOffset when)
 {
   LoadSummary ret;
@@ -54,6 +54,8 @@
 
 #include <vector>
 #include <unordered_map>
+#include <map>
+#include <string>
 #include <tuple>
 #include <variant>
 
@@ -121,6 +123,11 @@ using SubphaseLoadMapType = std::unordered_map<ElementIDStruct, std::vector<Load
 /// User-defined LB values map
 using DataMapType         = std::unordered_map<ElementIDStruct, ElmUserDataType>;
 
+/// User-defined LB data key for the memory footprint of an object in bytes
+static constexpr char const* const footprint_bytes_key = "task_footprint_bytes";
+/// LB data key under which the serialized size of an object is recorded
+static constexpr char const* const serialized_bytes_key = "serialized_bytes";
+
 struct Reassignment {
   // Include the subject node so that these structures can be formed
   // and passed through collectives
@@ -128,6 +135,12 @@ struct Reassignment {
   // Global sum reduction result to let the system know whether any
   // distributed structures need to be rebuilt
   int32_t global_migration_count;
+  // Global sum of transfers rejected because they exceeded the rank memory
+  // capacity of the destination
+  int32_t global_rejected_count = 0;
+  // Quantities the strategy reports about its own run, such as its predicted
+  // imbalance, written under "strategy" in the post-LB statistics
+  std::map<std::string, double> strategy_stats_;
   std::unordered_map<ElementIDStruct, NodeType> depart_;
   std::unordered_map<
     ElementIDStruct, std::tuple<LoadSummary, LoadSummary, ElmUserDataType>
@@ -185,6 +198,21 @@ ElmUserDataType getObjectUserData(
 
 LoadSummary getNodeLoads(std::shared_ptr<LoadModel> model, PhaseOffset when);
 
+/**
+ * \brief Get the memory footprint of an object in bytes: the user-defined
+ * \c footprint_bytes_key if present, otherwise its serialized size if it was
+ * recorded, otherwise zero
+ *
+ * \param[in] user_data the user-defined LB data of the object
+ *
+ * \return the footprint in bytes
+ */
+double getObjectMemory(ElmUserDataType const& user_data);
+
+double getObjectMemory(
+  LoadModel* model, ElementIDStruct object, PhaseOffset when
+);
+
 } /* end namespace balance */
 
 namespace lb {
@@ -196,6 +224,7 @@ enum struct StatisticQuantity : int8_t {
 enum struct Statistic : int8_t {
   Rank_load_modeled, Rank_load_raw, Rank_comm, Rank_strategy_specific_load_modeled,
   Object_load_modeled, Object_load_raw, Object_comm, Object_strategy_specific_load_modeled,
+  Rank_memory, Rank_memory_utilization, Object_memory,
   // W_l_min, W_l_max, W_l_avg, W_l_std, W_l_var, W_l_skewness, W_l_kurtosis,
   // W_c_min, W_c_max, W_c_avg, W_c_std, W_c_var, W_c_skewness, W_c_kurtosis,
   // W_t_min, W_t_max, W_t_avg, W_t_std, W_t_var, W_t_skewness, W_t_kurtosis,
@@ -61,6 +61,7 @@
 #include "vt/vrt/collection/balance/lb_data_restart_reader.h"
 #include "vt/vrt/collection/balance/zoltanlb/zoltanlb.h"
 #include "vt/vrt/collection/balance/randomlb/randomlb.h"
+#include "vt/vrt/collection/balance/graphpartlb/graphpartlb.h"
 #include "vt/vrt/collection/balance/testserializationlb/testserializationlb.h"
 #include "vt/vrt/collection/messages/system_create.h"
 #include "vt/vrt/collection/manager.fwd.h"
@@ -73,6 +74,8 @@
 #include "vt/vrt/collection/manager.h"
 #include "vt/utils/json/json_appender.h"
 
+#include <algorithm>
+
 #if vt_check_enabled(tv)
 # include <vt-tv/utility/parse_render.h>
 #endif
@@ -181,9 +184,50 @@ void LBManager::setLoadModel(std::shared_ptr<LoadModel> model) {
                    nlb_data->getUserData());
 }
 
+lb::LBThreadPool* LBManager::getThreadPool() {
+  if (thread_pool_ == nullptr) {
+    thread_pool_ = std::make_unique<lb::LBThreadPool>(theConfig()->vt_lb_threads);
+  }
+  return thread_pool_.get();
+}
+
+bool LBManager::imbalanceAboveThreshold() const {
+  auto const threshold = theConfig()->vt_lb_imbalance_threshold;
+  if (threshold <= 0.) {
+    return true;
+  }
+
+  auto iter = stats.find(lb::Statistic::Rank_load_modeled);
+  if (iter == stats.end()) {
+    return true;
+  }
+
+  auto const imb = iter->second.at(lb::StatisticQuantity::imb);
+  if (theContext()->getNode() == 0) {
+    vt_debug_print(
+      terse, lb,
+      "LBManager: modeled imbalance={:.3f}, threshold={:.3f}, {}\n",
+      imb, threshold, imb >= threshold ? "running strategy" : "skipping LB"
+    );
+  }
+  return imb >= threshold;
+}
+
 void LBManager::defaultPostLBWork(ReassignmentMsg* msg) {
   auto reassignment = msg->reassignment;
   auto phase = msg->phase;
+
+  // The strategy did not run: the statistics computed before it stand
+  if (skipped_lb_) {
+    last_phase_info_->migration_count = 0;
+    last_phase_info_->rejected_count = 0;
+    last_phase_info_->strategy_stats.clear();
+    last_phase_info_->ran_lb = false;
+    if (theContext()->getNode() == 0) {
+      commitPhaseStatistics(phase);
+    }
+    return;
+  }
   auto proposed = std::make_shared<ProposedReassignment>(model_, reassignment);
 
   runInEpochCollective("LBManager::runLB -> computeStats", [=] {
@@ -198,9 +242,14 @@ void LBManager::defaultPostLBWork(ReassignmentMsg* msg) {
   }
 
   last_phase_info_->migration_count = reassignment->global_migration_count;
+  last_phase_info_->rejected_count = reassignment->global_rejected_count;
+  last_phase_info_->strategy_stats = reassignment->strategy_stats_;
   last_phase_info_->ran_lb = true;
   if (theContext()->getNode() == 0) {
-    stagePostLBStatistics(stats, last_phase_info_->migration_count);
+    stagePostLBStatistics(
+      stats, last_phase_info_->migration_count,
+      last_phase_info_->rejected_count, last_phase_info_->strategy_stats
+    );
     commitPhaseStatistics(phase);
   }
 
@@ -250,6 +299,18 @@ LBManager::runLB(PhaseType phase, vt::Callback<ReassignmentMsg> cb) {
   if (theContext()->getNode() == 0) {
     stagePreLBStatistics(stats);
   }
+
+  // Every rank received the same reduced statistics, so they all agree on
+  // whether to skip the strategy
+  skipped_lb_ = not imbalanceAboveThreshold();
+  if (skipped_lb_) {
+    auto reassignment = std::make_shared<Reassignment>();
+    reassignment->node_ = theContext()->getNode();
+    reassignment->global_migration_count = 0;
+    cb.send(reassignment, phase);
+    return;
+  }
+
   elm::CommMapType empty_comm;
   elm::CommMapType const* comm = &empty_comm;
 
@@ -325,6 +386,8 @@ void LBManager::startLB(
 
   if (lb == LBType::NoLB) {
     last_phase_info_->migration_count = 0;
+    last_phase_info_->rejected_count = 0;
+    last_phase_info_->strategy_stats.clear();
     last_phase_info_->ran_lb = false;
 
     runInEpochCollective("LBManager::noLB -> updateLoads", [=] {
@@ -358,6 +421,7 @@ void LBManager::startLB(
 #   endif
   case LBType::TestSerializationLB: lb_instances_["chosen"] = makeLB<lb::TestSerializationLB>(lb_name); break;
   case LBType::TemperedWMin:        lb_instances_["chosen"] = makeLB<lb::TemperedWMin>(lb_name);        break;
+  case LBType::GraphPartLB:         lb_instances_["chosen"] = makeLB<lb::GraphPartLB>(lb_name);         break;
   case LBType::NoLB:
     vtAssert(false, "LBType::NoLB is not a valid LB for collectiveImpl");
     break;
@@ -402,6 +466,9 @@ void LBManager::printLBArgsHelp(LBType lb) {
   case LBType::RandomLB:
     help = lb::RandomLB::getInputKeysWithHelp();
     break;
+  case LBType::GraphPartLB:
+    help = lb::GraphPartLB::getInputKeysWithHelp();
+    break;
   case LBType::OfflineLB:
     help = lb::OfflineLB::getInputKeysWithHelp();
     break;
@@ -454,6 +521,13 @@ void LBManager::printLBArgsHelp(std::string lb_name) {
 void LBManager::startup() {
   last_phase_info_ = std::make_unique<lb::PhaseInfo>();
 
+  if (theConfig()->vt_lb_topology) {
+    // Collective: every rank starts the component in the same order
+    topology_ = std::make_shared<RankTopology const>(
+      RankTopology::discover(theContext()->getComm())
+    );
+  }
+
   thePhase()->registerHookUnsynchronized(phase::PhaseHook::Start, []{
     thePhase()->setStartTime();
   });
@@ -641,7 +715,8 @@ void LBManager::stagePreLBStatistics(const StatisticMapType &statistics) {
 }
 
 void LBManager::stagePostLBStatistics(
-  const StatisticMapType &statistics, int32_t migration_count
+  const StatisticMapType &statistics, int32_t migration_count,
+  int32_t rejected_count, std::map<std::string, double> const& strategy_stats
 ) {
   // Statistics output when LB is enabled and appropriate flag is enabled
   if (theContext()->getNode() != 0 or !theConfig()->vt_lb_statistics) {
@@ -651,6 +726,12 @@ void LBManager::stagePostLBStatistics(
   nlohmann::json j;
   j["post-LB"] = lb::jsonifyPhaseStatistics(statistics);
   j["migration count"] = migration_count;
+  if (theConfig()->vt_lb_memory_capacity > 0) {
+    j["rejected transfer count"] = rejected_count;
+  }
+  if (not strategy_stats.empty()) {
+    j["strategy"] = strategy_stats;
+  }
 
   if (!statistics_writer_) {
     createStatisticsFile();
@@ -813,6 +894,35 @@ void LBManager::computeStatistics(
     lb::Statistic::Object_comm, std::move(obj_comm)
   ));
 
+  if (theConfig()->vt_lb_memory_capacity > 0) {
+    double obj_memory_total = 0.;
+    std::vector<balance::LoadData> obj_memory;
+    for (auto elm : *model) {
+      auto mem = balance::getObjectMemory(model.get(), elm, when);
+      obj_memory.emplace_back(LoadData{lb::Statistic::Object_memory, mem});
+      obj_memory_total += mem;
+    }
+
+    // The baseline is measured before LB and carried over to the proposed
+    // reassignment, whose memory is not resident yet
+    if (before_lb_stats_) {
+      auto const usage = static_cast<double>(theMemUsage()->getFirstUsage());
+      memory_baseline_ = std::max(0., usage - obj_memory_total);
+    }
+
+    // The memory term of the rank's cost: the share of the capacity it holds
+    auto const rank_memory = memory_baseline_ + obj_memory_total;
+    auto const capacity =
+      static_cast<double>(theConfig()->vt_lb_memory_capacity);
+    lstats.emplace_back(LoadData{lb::Statistic::Rank_memory, rank_memory});
+    lstats.emplace_back(
+      LoadData{lb::Statistic::Rank_memory_utilization, rank_memory / capacity}
+    );
+    lstats.emplace_back(reduceVec(
+      lb::Statistic::Object_memory, std::move(obj_memory)
+    ));
+  }
+
   proxy_.reduce<collective::PlusOp>(cb, std::move(lstats));
 }
 
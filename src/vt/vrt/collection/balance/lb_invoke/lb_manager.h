@@ -52,6 +52,8 @@
 #include "vt/runtime/component/component_pack.h"
 #include "vt/objgroup/proxy/proxy_objgroup.h"
 #include "vt/vrt/collection/balance/baselb/baselb.h"
+#include "vt/vrt/collection/balance/baselb/lb_thread_pool.h"
+#include "vt/vrt/collection/balance/rank_topology.h"
 #include "vt/vrt/collection/balance/lb_invoke/phase_info.h"
 #include "vt/utils/json/base_appender.h"
 
@@ -225,7 +227,9 @@ public:
 
   void stagePreLBStatistics(const StatisticMapType &statistics);
   void stagePostLBStatistics(
-    const StatisticMapType &statistics, int32_t migration_count
+    const StatisticMapType &statistics, int32_t migration_count,
+    int32_t rejected_count = 0,
+    std::map<std::string, double> const& strategy_stats = {}
   );
   void commitPhaseStatistics(PhaseType phase);
 
@@ -281,6 +285,30 @@ public:
 
   void setComputingBeforeLBStats(bool before_lb) { before_lb_stats_ = before_lb; }
 
+  /**
+   * \brief Get the memory of this rank not attributed to any object, as
+   * measured when the pre-LB statistics were last computed
+   *
+   * \return the baseline in bytes
+   */
+  double getMemoryBaseline() const { return memory_baseline_; }
+
+  /**
+   * \brief Get the thread pool for LB strategies, started on first use with
+   * \c --vt_lb_threads threads
+   *
+   * \return the thread pool
+   */
+  lb::LBThreadPool* getThreadPool();
+
+  /**
+   * \brief Get the physical node and NUMA domain of every rank, discovered at
+   * startup with \c --vt_lb_topology
+   *
+   * \return the topology or \c nullptr if it was not discovered
+   */
+  std::shared_ptr<RankTopology const> getTopology() const { return topology_; }
+
 private:
   bool isCollectiveComm(elm::CommCategory cat) const;
 
@@ -294,6 +322,14 @@ private:
    */
   void closeStatisticsFile();
 
+  /**
+   * \internal \brief Whether the modeled rank imbalance from the last
+   * computed statistics reaches \c --vt_lb_imbalance_threshold
+   *
+   * \return whether the strategy should run
+   */
+  bool imbalanceAboveThreshold() const;
+
   void setStrategySpecificModel(std::shared_ptr<LoadModel> model) {
     strategy_specific_model_ = model;
   }
@@ -310,6 +346,14 @@ private:
   LoadType total_load_from_model = 0.;
   std::unique_ptr<lb::PhaseInfo> last_phase_info_ = nullptr;
   bool before_lb_stats_ = true;
+  /// Rank memory not attributed to objects, when a capacity is set
+  double memory_baseline_ = 0.;
+  /// Threads that strategies may use while computing a new distribution
+  std::unique_ptr<lb::LBThreadPool> thread_pool_ = nullptr;
+  /// The rank topology, when \c --vt_lb_topology is set
+  std::shared_ptr<RankTopology const> topology_ = nullptr;
+  /// Whether the strategy was skipped because the imbalance was low
+  bool skipped_lb_ = false;
   /// The appender for outputting statistics in JSON format
   std::unique_ptr<util::json::BaseAppender> statistics_writer_ = nullptr;
   /// Event ID for writing out the LB stats
@@ -47,6 +47,9 @@
 #include "vt/config.h"
 #include "vt/vrt/collection/balance/lb_type.h"
 
+#include <map>
+#include <string>
+
 namespace vt { namespace vrt { namespace collection { namespace lb {
 
 struct PhaseInfo {
@@ -57,6 +60,8 @@ struct PhaseInfo {
   double max_load_post_lb = 0, avg_load_post_lb = 0, imb_load_post_lb = 0;
   bool ran_lb = false;
   int32_t migration_count = 0;
+  int32_t rejected_count = 0;
+  std::map<std::string, double> strategy_stats;
 };
 
 }}}} /* end namespace vt::vrt::collection::lb */
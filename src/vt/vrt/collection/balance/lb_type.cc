@@ -61,6 +61,7 @@ static std::unordered_map<LBType,std::string> lb_names_ = {
   {LBType::RandomLB,            std::string{"RandomLB"           }},
   {LBType::TestSerializationLB, std::string{"TestSerializationLB"}},
   {LBType::TemperedWMin,        std::string{"TemperedWMin"       }},
+  {LBType::GraphPartLB,         std::string{"GraphPartLB"        }},
 };
 
 std::unordered_map<LBType, std::string>& get_lb_names() {
@@ -82,6 +83,10 @@ static std::unordered_map<Statistic,std::string> lb_stat_names_ = {
   {Statistic::Object_comm,         std::string{"Object_comm"}},
   {Statistic::Object_strategy_specific_load_modeled,
       std::string{"Object_strategy_specific_load_modeled"}},
+  {Statistic::Rank_memory,         std::string{"Rank_memory"}},
+  {Statistic::Rank_memory_utilization,
+      std::string{"Rank_memory_utilization"}},
+  {Statistic::Object_memory,       std::string{"Object_memory"}},
   {Statistic::ObjectRatio,         std::string{"ObjectRatio"}},
   {Statistic::EdgeRatio,           std::string{"EdgeRatio"}}
 };
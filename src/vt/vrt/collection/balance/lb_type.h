@@ -65,6 +65,7 @@ enum struct LBType : int8_t {
   , RandomLB            = 7
   , TestSerializationLB = 8
   , TemperedWMin        = 9
+  , GraphPartLB         = 10
 };
 
 std::unordered_map<LBType, std::string>& get_lb_names();
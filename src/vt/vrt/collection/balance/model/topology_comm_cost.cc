@@ -0,0 +1,109 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                            topology_comm_cost.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include "vt/vrt/collection/balance/model/topology_comm_cost.h"
+
+namespace vt { namespace vrt { namespace collection { namespace balance {
+
+TopologyCommCost::TopologyCommCost(
+  std::shared_ptr<balance::LoadModel> base,
+  std::shared_ptr<RankTopology const> in_topology,
+  std::array<LoadType, 4> in_per_msg_weight,
+  std::array<LoadType, 4> in_per_byte_weight
+) : ComposedModel(base),
+    topology_(in_topology),
+    per_msg_weight_(in_per_msg_weight),
+    per_byte_weight_(in_per_byte_weight)
+{
+  vtAssert(topology_ != nullptr, "TopologyCommCost needs a rank topology");
+}
+
+void TopologyCommCost::setLoads(std::unordered_map<PhaseType, LoadMapType> const* proc_load,
+                                std::unordered_map<PhaseType, CommMapType> const* proc_comm,
+                                std::unordered_map<PhaseType, DataMapType> const* user_data) {
+  proc_comm_ = proc_comm;
+  ComposedModel::setLoads(proc_load, proc_comm, user_data);
+}
+
+LoadType
+TopologyCommCost::getModeledLoad(ElementIDStruct object, PhaseOffset offset) const {
+  auto work = ComposedModel::getModeledLoad(object, offset);
+
+  auto phase = getNumCompletedPhases() + offset.phases;
+  auto& comm = proc_comm_->at(phase);
+
+  LoadType overhead = 0.;
+  for (auto&& c : comm) {
+    if (c.first.toObj() != object or c.first.selfEdge()) {
+      continue;
+    }
+
+    // Find where the messages sent to this object came from; broadcasts and
+    // shared blocks are priced as remote, like off-node comm elsewhere
+    auto const to = elm::objGetNode(c.first.toObj());
+    auto from = uninitialized_destination;
+    if (c.first.commCategory() == elm::CommCategory::SendRecv) {
+      from = elm::objGetNode(c.first.fromObj());
+    } else if (c.first.commCategory() == elm::CommCategory::NodeToCollection) {
+      from = static_cast<NodeType>(c.first.fromNode());
+    }
+
+    auto const level = static_cast<std::size_t>(
+      topology_->getLocality(from, to)
+    );
+    overhead += per_msg_weight_[level] * c.second.messages;
+    overhead += per_byte_weight_[level] * c.second.bytes;
+  }
+
+  if (offset.subphase == PhaseOffset::WHOLE_PHASE) {
+    return work + overhead;
+  } else {
+    // @todo: we don't record comm costs for each subphase---split it proportionally
+    auto whole_phase_work = ComposedModel::getModeledLoad(
+      object, PhaseOffset{offset.phases, PhaseOffset::WHOLE_PHASE}
+    );
+    return work + overhead * ( work/whole_phase_work );
+  }
+}
+
+}}}}
@@ -0,0 +1,100 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                             topology_comm_cost.h
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_VRT_COLLECTION_BALANCE_MODEL_TOPOLOGY_COMM_COST_H
+#define INCLUDED_VT_VRT_COLLECTION_BALANCE_MODEL_TOPOLOGY_COMM_COST_H
+
+#include "vt/vrt/collection/balance/model/composed_model.h"
+#include "vt/vrt/collection/balance/rank_topology.h"
+
+#include <array>
+#include <memory>
+#include <unordered_map>
+
+namespace vt { namespace vrt { namespace collection { namespace balance {
+
+/**
+ * \brief Add implied work time for received communication, priced by how far
+ * it traveled: within a NUMA domain, within a physical node, or across the
+ * network
+ *
+ * Unlike \c CommOverhead, which charges every off-rank message the same, this
+ * makes objects that talk heavily across the network look more expensive than
+ * ones whose partners share their node. Zero \c SameRank weights leave
+ * messages within a rank free.
+ */
+struct TopologyCommCost : public ComposedModel {
+  /**
+   * \brief Constructor
+   *
+   * \param[in] base: the underlying source of object work loads
+   * \param[in] in_topology the rank topology, e.g. from
+   * \c LBManager::getTopology
+   * \param[in] in_per_msg_weight weight to add per message received, indexed
+   * by \c RankLocality
+   * \param[in] in_per_byte_weight weight to add per byte received, indexed by
+   * \c RankLocality
+   */
+  TopologyCommCost(
+    std::shared_ptr<balance::LoadModel> base,
+    std::shared_ptr<RankTopology const> in_topology,
+    std::array<LoadType, 4> in_per_msg_weight,
+    std::array<LoadType, 4> in_per_byte_weight
+  );
+
+  void setLoads(std::unordered_map<PhaseType, LoadMapType> const* proc_load,
+                std::unordered_map<PhaseType, CommMapType> const* proc_comm,
+                std::unordered_map<PhaseType, DataMapType> const* user_data) override;
+
+  LoadType getModeledLoad(ElementIDStruct object, PhaseOffset when) const override;
+
+private:
+  std::unordered_map<PhaseType, CommMapType> const* proc_comm_; /**< Underlying comm data */
+  std::shared_ptr<RankTopology const> topology_;  /**< Rank placement */
+  std::array<LoadType, 4> per_msg_weight_ = {};   /**< Cost per message */
+  std::array<LoadType, 4> per_byte_weight_ = {};  /**< Cost per byte */
+}; // class TopologyCommCost
+
+}}}} // end namespace
+
+#endif /*INCLUDED_VT_VRT_COLLECTION_BALANCE_MODEL_TOPOLOGY_COMM_COST_H*/
@@ -51,6 +51,7 @@
 #include "vt/utils/json/json_appender.h"
 #include "vt/vrt/collection/balance/lb_data_holder.h"
 #include "vt/elm/elm_lb_data.h"
+#include "vt/utils/memory/alloc_tracker.h"
 
 #include <vector>
 #include <unordered_map>
@@ -319,6 +320,13 @@ void NodeLBData::registerObjGroupInfo(
   node_objgroup_lookup_[id] = proxy;
 }
 
+void NodeLBData::addSerializedSize(
+  ElementIDStruct id, PhaseType phase, std::size_t bytes
+) {
+  lb_data_->user_defined_lb_info_[phase][id][serialized_bytes_key] =
+    static_cast<double>(bytes);
+}
+
 void NodeLBData::addNodeLBData(
   ElementIDStruct id, elm::ElementLBData* in, StorableType *storable,
   SubphaseType focused_subphase
@@ -373,6 +381,18 @@ void NodeLBData::addNodeLBData(
     );
   }
 
+  if (
+    theConfig()->vt_alloc_tracking_lb and
+    util::memory::AllocTracker::isEnabled()
+  ) {
+    // Live heap bytes allocated by the element's tasks, which outlive them
+    auto const live = util::memory::AllocTracker::getLiveBytes(
+      {util::memory::AllocContextKind::Collection, id.id}
+    );
+    lb_data_->user_defined_lb_info_[phase][id]["alloc_live_bytes"] =
+      static_cast<double>(live);
+  }
+
   in->updatePhase(1);
 
   auto model = theLBManager()->getLoadModel();
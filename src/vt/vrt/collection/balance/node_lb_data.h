@@ -138,6 +138,16 @@ public:
     SubphaseType focused_subphase = elm::ElementLBData::no_subphase
   );
 
+  /**
+   * \internal \brief Record the serialized size of an element in its LB data,
+   * standing in for its memory footprint when the user provides none
+   *
+   * \param[in] id the element ID
+   * \param[in] phase the phase
+   * \param[in] bytes the serialized size in bytes
+   */
+  void addSerializedSize(ElementIDStruct id, PhaseType phase, std::size_t bytes);
+
   /**
    * \internal \brief Clear/reset all LB data and IDs on this node
    */
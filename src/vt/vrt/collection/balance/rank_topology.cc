@@ -0,0 +1,165 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                               rank_topology.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include "vt/config.h"
+#include "vt/vrt/collection/balance/rank_topology.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <map>
+
+#if defined(__linux__)
+# include <dirent.h>
+# include <sched.h>
+#endif
+
+namespace vt { namespace vrt { namespace collection { namespace balance {
+
+RankTopology::RankTopology(
+  std::vector<int> in_node_of, std::vector<int> in_numa_of
+) : node_of_(std::move(in_node_of)),
+    numa_of_(std::move(in_numa_of))
+{
+  vtAssert(node_of_.size() == numa_of_.size(), "One NUMA domain per rank");
+  for (auto&& node : node_of_) {
+    num_physical_nodes_ = std::max(num_physical_nodes_, node + 1);
+  }
+}
+
+/*static*/ int RankTopology::readNumaDomain(
+  [[maybe_unused]] std::string const& sys_cpu_dir, [[maybe_unused]] int cpu
+) {
+#if defined(__linux__)
+  // The CPU directory links to its NUMA node as "node<N>"
+  auto const path = sys_cpu_dir + "/cpu" + std::to_string(cpu);
+  DIR* dir = opendir(path.c_str());
+  if (dir == nullptr) {
+    return 0;
+  }
+
+  int domain = 0;
+  while (auto entry = readdir(dir)) {
+    std::string const name = entry->d_name;
+    if (
+      name.size() > 4 and name.compare(0, 4, "node") == 0 and
+      std::all_of(
+        name.begin() + 4, name.end(),
+        [](unsigned char c) { return std::isdigit(c) != 0; }
+      )
+    ) {
+      domain = std::atoi(name.c_str() + 4);
+      break;
+    }
+  }
+  closedir(dir);
+  return domain;
+#else
+  return 0;
+#endif
+}
+
+/*static*/ RankTopology RankTopology::discover(MPI_Comm comm) {
+  int rank = 0;
+  int num_ranks = 0;
+  MPI_Comm_rank(comm, &rank);
+  MPI_Comm_size(comm, &num_ranks);
+
+  // The lowest rank sharing memory with this one names the physical node
+  MPI_Comm shm_comm;
+  MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL, &shm_comm);
+  int leader = rank;
+  MPI_Allreduce(&rank, &leader, 1, MPI_INT, MPI_MIN, shm_comm);
+  MPI_Comm_free(&shm_comm);
+
+  int numa = 0;
+#if defined(__linux__)
+  if (auto const cpu = sched_getcpu(); cpu >= 0) {
+    numa = readNumaDomain("/sys/devices/system/cpu", cpu);
+  }
+#endif
+
+  int const mine[2] = {leader, numa};
+  std::vector<int> all(2 * static_cast<std::size_t>(num_ranks));
+  MPI_Allgather(mine, 2, MPI_INT, all.data(), 2, MPI_INT, comm);
+
+  std::map<int, int> node_of_leader;
+  for (int r = 0; r < num_ranks; r++) {
+    node_of_leader.emplace(all[2 * r], 0);
+  }
+  int next = 0;
+  for (auto&& [l, node] : node_of_leader) {
+    node = next++;
+  }
+
+  std::vector<int> node_of(num_ranks), numa_of(num_ranks);
+  for (int r = 0; r < num_ranks; r++) {
+    node_of[r] = node_of_leader[all[2 * r]];
+    numa_of[r] = all[2 * r + 1];
+  }
+
+  vt_debug_print(
+    normal, lb,
+    "RankTopology::discover: ranks={}, physical nodes={}, node={}, numa={}\n",
+    num_ranks, next, node_of[rank], numa
+  );
+
+  return RankTopology{std::move(node_of), std::move(numa_of)};
+}
+
+RankLocality RankTopology::getLocality(NodeType a, NodeType b) const {
+  auto const n = getNumRanks();
+  if (a < 0 or b < 0 or a >= n or b >= n) {
+    return RankLocality::Remote;
+  } else if (a == b) {
+    return RankLocality::SameRank;
+  } else if (node_of_[a] != node_of_[b]) {
+    return RankLocality::Remote;
+  } else if (numa_of_[a] != numa_of_[b]) {
+    return RankLocality::SameNode;
+  } else {
+    return RankLocality::SameNuma;
+  }
+}
+
+}}}} /* end namespace vt::vrt::collection::balance */
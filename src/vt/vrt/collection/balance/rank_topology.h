@@ -0,0 +1,132 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                               rank_topology.h
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_VRT_COLLECTION_BALANCE_RANK_TOPOLOGY_H
+#define INCLUDED_VT_VRT_COLLECTION_BALANCE_RANK_TOPOLOGY_H
+
+#include "vt/config.h"
+
+#include <string>
+#include <vector>
+
+namespace vt { namespace vrt { namespace collection { namespace balance {
+
+/**
+ * \brief How close two ranks are in the machine, from the same rank to
+ * different physical nodes
+ */
+enum struct RankLocality : int8_t {
+  SameRank = 0,
+  SameNuma = 1,
+  SameNode = 2,
+  Remote   = 3
+};
+
+/**
+ * \struct RankTopology
+ *
+ * \brief The physical node and NUMA domain of every rank, so that LB models
+ * and strategies can tell a transfer within a node from one across the
+ * network.
+ *
+ * Physical nodes are numbered densely in the order of their lowest rank. NUMA
+ * domains are the Linux node numbers of the CPU each rank ran on when the
+ * topology was discovered; they are all 0 when that can't be read (e.g. off
+ * Linux), which makes every pair of ranks on a node \c SameNuma.
+ */
+struct RankTopology {
+  RankTopology() = default;
+
+  /**
+   * \brief Build a topology from known placements
+   *
+   * \param[in] in_node_of the physical node of each rank
+   * \param[in] in_numa_of the NUMA domain of each rank
+   */
+  RankTopology(std::vector<int> in_node_of, std::vector<int> in_numa_of);
+
+  /**
+   * \brief Discover the topology of the ranks of a communicator; collective
+   * over all ranks
+   *
+   * \param[in] comm the communicator
+   *
+   * \return the topology
+   */
+  static RankTopology discover(MPI_Comm comm);
+
+  /**
+   * \brief Read the NUMA domain of a CPU from sysfs
+   *
+   * \param[in] sys_cpu_dir the sysfs CPU directory, usually
+   * \c /sys/devices/system/cpu
+   * \param[in] cpu the CPU
+   *
+   * \return the NUMA domain or 0 if it can't be read
+   */
+  static int readNumaDomain(std::string const& sys_cpu_dir, int cpu);
+
+  /**
+   * \brief Get the locality of two ranks
+   *
+   * \param[in] a the first rank
+   * \param[in] b the second rank
+   *
+   * \return the locality
+   */
+  RankLocality getLocality(NodeType a, NodeType b) const;
+
+  int getNumRanks() const { return static_cast<int>(node_of_.size()); }
+  int getNumPhysicalNodes() const { return num_physical_nodes_; }
+  int getPhysicalNode(NodeType rank) const { return node_of_[rank]; }
+  int getNumaDomain(NodeType rank) const { return numa_of_[rank]; }
+
+private:
+  std::vector<int> node_of_;
+  std::vector<int> numa_of_;
+  int num_physical_nodes_ = 0;
+};
+
+}}}} /* end namespace vt::vrt::collection::balance */
+
+#endif /*INCLUDED_VT_VRT_COLLECTION_BALANCE_RANK_TOPOLOGY_H*/
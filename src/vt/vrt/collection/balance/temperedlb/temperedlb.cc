@@ -50,6 +50,7 @@
 #include "vt/vrt/collection/balance/temperedlb/tempered_constants.h"
 #include "vt/vrt/collection/balance/temperedlb/criterion.h"
 #include "vt/vrt/collection/balance/lb_args_enum_converter.h"
+#include "vt/vrt/collection/balance/lb_invoke/lb_manager.h"
 #include "vt/context/context.h"
 
 #include <cstdint>
@@ -318,6 +319,24 @@ Description: δ in the work model (shared-memory-edges in work model)
 Values: <double>
 Defaut: infinity
 Description: ε in the work model (memory term in work model)
+)"
+    },
+    {
+    "numa_factor",
+      R"(
+Values: <double>
+Defaut: 1.0
+Description: Fraction of β charged for bytes to a rank in the same NUMA domain;
+requires --vt_lb_topology when not 1
+)"
+    },
+    {
+    "node_factor",
+      R"(
+Values: <double>
+Defaut: 1.0
+Description: Fraction of β charged for bytes to a rank on the same physical
+node in another NUMA domain; requires --vt_lb_topology when not 1
 )"
     }
   };
@@ -418,12 +437,28 @@ void TemperedLB::inputParams(balance::ConfigEntry* config) {
     vtAbort(s);
   }
 
-  alpha = config->getOrDefault<double>("alpha", alpha);
-  beta = config->getOrDefault<double>("beta", beta);
-  gamma = config->getOrDefault<double>("gamma", gamma);
-  delta = config->getOrDefault<double>("delta", delta);
+  setWorkCoefficients(
+    config->getOrDefault<double>("alpha", alpha),
+    config->getOrDefault<double>("beta", beta),
+    config->getOrDefault<double>("gamma", gamma),
+    config->getOrDefault<double>("delta", delta)
+  );
   epsilon = config->getOrDefault<double>("epsilon", epsilon);
 
+  auto const numa_factor =
+    config->getOrDefault<double>("numa_factor", numa_factor_);
+  auto const node_factor =
+    config->getOrDefault<double>("node_factor", node_factor_);
+  std::shared_ptr<balance::RankTopology const> topology = nullptr;
+  if (numa_factor != 1.0 or node_factor != 1.0) {
+    topology = theLBManager()->getTopology();
+    vtAbortIf(
+      topology == nullptr,
+      "TemperedLB: numa_factor and node_factor need --vt_lb_topology"
+    );
+  }
+  setTopology(topology, numa_factor, node_factor);
+
   num_iters_     = config->getOrDefault<int32_t>("iters", num_iters_);
   num_trials_    = config->getOrDefault<int32_t>("trials", num_trials_);
 
@@ -882,6 +917,11 @@ WorkBreakdown TemperedLB::computeWorkBreakdown(
   // Communication bytes sent/recv'ed off rank
   double inter_rank_bytes_sent = 0, inter_rank_bytes_recv = 0;
 
+  // Non-migratable objects on the node stay where they are
+  auto is_on_node = [node](ObjIDType const& target) {
+    return target.getCurrNode() == node and not target.isMigratable();
+  };
+
   auto computeEdgeVolumesAndLoad = [&](ObjIDType obj, LoadType obj_load) {
     if (exclude.find(obj) == exclude.end()) {
       if (auto it = send_edges_.find(obj); it != send_edges_.end()) {
@@ -892,12 +932,12 @@ WorkBreakdown TemperedLB::computeWorkBreakdown(
             obj, target
           );
           if (
-            cur_objs_.find(target) != cur_objs_.end() or
-            target.isLocatedOnThisNode()
+            cur_objs_.find(target) != cur_objs_.end() or is_on_node(target)
           ) {
             intra_rank_bytes_sent += volume;
           } else {
-            inter_rank_bytes_sent += volume;
+            inter_rank_bytes_sent +=
+              volume * interRankFactor(node, target.getCurrNode());
           }
         }
       }
@@ -909,12 +949,12 @@ WorkBreakdown TemperedLB::computeWorkBreakdown(
             obj, target
           );
           if (
-            cur_objs_.find(target) != cur_objs_.end() or
-            target.isLocatedOnThisNode()
+            cur_objs_.find(target) != cur_objs_.end() or is_on_node(target)
           ) {
             intra_rank_bytes_recv += volume;
           } else {
-            inter_rank_bytes_recv += volume;
+            inter_rank_bytes_recv +=
+              volume * interRankFactor(node, target.getCurrNode());
           }
         }
       }
@@ -1016,12 +1056,12 @@ double TemperedLB::computeWorkAfterClusterSwap(
   // be removed from the inter-node volumes
   for (auto const& [target, volume] : to_remove.inter_send_vol) {
     if (target != node) {
-      node_inter_send -= volume;
+      node_inter_send -= volume * interRankFactor(node, target);
     }
   }
   for (auto const& [target, volume] : to_remove.inter_recv_vol) {
     if (target != node) {
-      node_inter_recv -= volume;
+      node_inter_recv -= volume * interRankFactor(node, target);
     }
   }
 
@@ -1029,12 +1069,12 @@ double TemperedLB::computeWorkAfterClusterSwap(
   // be added from the inter-node volumes
   for (auto const& [target, volume] : to_add.inter_send_vol) {
     if (target != node) {
-      node_inter_send += volume;
+      node_inter_send += volume * interRankFactor(node, target);
     }
   }
   for (auto const& [target, volume] : to_add.inter_recv_vol) {
     if (target != node) {
-      node_inter_recv += volume;
+      node_inter_recv += volume * interRankFactor(node, target);
     }
   }
 
@@ -1043,6 +1083,41 @@ double TemperedLB::computeWorkAfterClusterSwap(
   return node_work;
 }
 
+double TemperedLB::interRankFactor(NodeType node, NodeType other) const {
+  if (topology_ == nullptr) {
+    return 1.0;
+  }
+
+  switch (topology_->getLocality(node, other)) {
+  case balance::RankLocality::SameNuma: return numa_factor_;
+  case balance::RankLocality::SameNode: return node_factor_;
+  default:                              return 1.0;
+  }
+}
+
+void TemperedLB::setWorkCoefficients(
+  double in_alpha, double in_beta, double in_gamma, double in_delta
+) {
+  alpha = in_alpha;
+  beta = in_beta;
+  gamma = in_gamma;
+  delta = in_delta;
+}
+
+void TemperedLB::setTopology(
+  std::shared_ptr<balance::RankTopology const> topology, double numa_factor,
+  double node_factor
+) {
+  topology_ = std::move(topology);
+  numa_factor_ = numa_factor;
+  node_factor_ = node_factor;
+}
+
+void TemperedLB::addCommEdge(ObjIDType from, ObjIDType to, double bytes) {
+  send_edges_[from].emplace_back(to, bytes);
+  recv_edges_[to].emplace_back(from, bytes);
+}
+
 void TemperedLB::doLBStages(LoadType start_imb) {
   decltype(this->cur_objs_) best_objs;
   LoadType best_load = 0;
@@ -1113,8 +1188,7 @@ void TemperedLB::doLBStages(LoadType start_imb) {
             auto const to_obj = key.toObj();
             auto const bytes = volume.bytes;
 
-            send_edges_[from_obj].emplace_back(to_obj, bytes);
-            recv_edges_[to_obj].emplace_back(from_obj, bytes);
+            addCommEdge(from_obj, to_obj, bytes);
             has_comm = true;
           } else if (key.commCategory() == elm::CommCategory::WriteShared) {
             auto const to_node = key.toNode();
@@ -1375,8 +1449,7 @@ void TemperedLB::doLBStages(LoadType start_imb) {
 void TemperedLB::giveEdges(EdgeMapType const& edge_map) {
   for (auto const& [from_obj, to_edges] : edge_map) {
     for (auto const& [to_obj, volume] : to_edges) {
-      send_edges_[from_obj].emplace_back(to_obj, volume);
-      recv_edges_[to_obj].emplace_back(from_obj, volume);
+      addCommEdge(from_obj, to_obj, volume);
     }
   }
 }
@@ -2347,40 +2420,50 @@ void TemperedLB::considerSwapsAfterLock(MsgSharedPtr<LockedInfoMsg> msg) {
   auto const& try_max_osm = msg->locked_max_object_serialized_bytes;
   auto const& try_info = msg->locked_info;
 
-  double best_c_try = -1.0;
-  std::tuple<SharedIDType, SharedIDType> best_swap =
-    {no_shared_id, no_shared_id};
+  // List the candidate swaps in the order they are considered: for each of
+  // our clusters, the empty cluster first and then each locked cluster
+  using SwapType = std::tuple<SharedIDType, SharedIDType>;
+  ClusterInfo const empty_cluster;
+  std::vector<SwapType> swaps;
+  std::vector<ClusterInfo const*> src_ptrs, try_ptrs;
   for (auto const& [src_shared_id, src_cluster] : cur_clusters_) {
-    // try swapping with empty cluster first
-    {
-      ClusterInfo empty_cluster;
-      double c_try = criterion(
-        try_rank, try_info, try_total_bytes, try_max_owm, try_max_osm,
-        src_cluster, empty_cluster
-      );
-      if (c_try >= 0.0) {
-        if (c_try > best_c_try) {
-          best_c_try = c_try;
-          best_swap = std::make_tuple(src_shared_id, no_shared_id);
-        }
+    swaps.emplace_back(src_shared_id, no_shared_id);
+    src_ptrs.push_back(&src_cluster);
+    try_ptrs.push_back(&empty_cluster);
+    for (auto const& [try_shared_id, try_cluster] : try_clusters) {
+      swaps.emplace_back(src_shared_id, try_shared_id);
+      src_ptrs.push_back(&src_cluster);
+      try_ptrs.push_back(&try_cluster);
+    }
+  }
+
+  // Evaluating the candidates only reads state, so it is split over the LB
+  // threads; the best one is then picked serially in the order above
+  std::vector<double> c_tries(swaps.size(), -1.0);
+  theLBManager()->getThreadPool()->parallelFor(
+    swaps.size(), [&](std::size_t begin, std::size_t end) {
+      for (std::size_t i = begin; i < end; i++) {
+        c_tries[i] = criterion(
+          try_rank, try_info, try_total_bytes, try_max_owm, try_max_osm,
+          *src_ptrs[i], *try_ptrs[i]
+        );
       }
     }
+  );
 
-    for (auto const& [try_shared_id, try_cluster] : try_clusters) {
-      double c_try = criterion(
-        try_rank, try_info, try_total_bytes, try_max_owm, try_max_osm,
-        src_cluster, try_cluster
-      );
-      vt_debug_print(
-        verbose, temperedlb,
-        "testing a possible swap (rank {}): {} {} c_try={}\n",
-        try_rank, src_shared_id, try_shared_id, c_try
-      );
-      if (c_try >= 0.0) {
-        if (c_try > best_c_try) {
-          best_c_try = c_try;
-          best_swap = std::make_tuple(src_shared_id, try_shared_id);
-        }
+  double best_c_try = -1.0;
+  SwapType best_swap = {no_shared_id, no_shared_id};
+  for (std::size_t i = 0; i < swaps.size(); i++) {
+    double const c_try = c_tries[i];
+    vt_debug_print(
+      verbose, temperedlb,
+      "testing a possible swap (rank {}): {} {} c_try={}\n",
+      try_rank, std::get<0>(swaps[i]), std::get<1>(swaps[i]), c_try
+    );
+    if (c_try >= 0.0) {
+      if (c_try > best_c_try) {
+        best_c_try = c_try;
+        best_swap = swaps[i];
       }
     }
   }
@@ -47,6 +47,7 @@
 #include "vt/config.h"
 #include "vt/vrt/collection/balance/stats_msg.h"
 #include "vt/vrt/collection/balance/baselb/baselb.h"
+#include "vt/vrt/collection/balance/rank_topology.h"
 #include "vt/vrt/collection/balance/temperedlb/tempered_msgs.h"
 #include "vt/vrt/collection/balance/temperedlb/criterion.h"
 #include "vt/vrt/collection/balance/temperedlb/tempered_enums.h"
@@ -314,6 +315,53 @@ protected:
     ClusterInfo const& to_add
   );
 
+  /**
+   * \brief Get the fraction of β charged for bytes between two ranks, from
+   * \c numa_factor and \c node_factor when they share a NUMA domain or a
+   * physical node
+   *
+   * \param[in] node the rank the work is computed for
+   * \param[in] other the rank on the other end
+   *
+   * \return the fraction
+   */
+  double interRankFactor(NodeType node, NodeType other) const;
+
+  /**
+   * \brief Set the coefficients of the work model
+   *
+   * \param[in] in_alpha α, per unit of load
+   * \param[in] in_beta β, per inter-rank byte
+   * \param[in] in_gamma γ, per intra-rank byte
+   * \param[in] in_delta δ, per byte of shared blocks homed on other ranks
+   */
+  void setWorkCoefficients(
+    double in_alpha, double in_beta, double in_gamma, double in_delta
+  );
+
+  /**
+   * \brief Set the topology that scales β for bytes between ranks sharing a
+   * NUMA domain or a physical node
+   *
+   * \param[in] topology the rank topology; \c nullptr charges every
+   * inter-rank byte in full
+   * \param[in] numa_factor the fraction of β within a NUMA domain
+   * \param[in] node_factor the fraction of β within a physical node
+   */
+  void setTopology(
+    std::shared_ptr<balance::RankTopology const> topology, double numa_factor,
+    double node_factor
+  );
+
+  /**
+   * \brief Add an edge of the communication graph seen by the work model
+   *
+   * \param[in] from the sending object
+   * \param[in] to the receiving object
+   * \param[in] bytes the bytes sent
+   */
+  void addCommEdge(ObjIDType from, ObjIDType to, double bytes);
+
   /**
    * \brief Consider possible swaps with all the up-to-date info from a rank
    *
@@ -428,6 +476,12 @@ private:
   double gamma = 0.0;
   double delta = 0.0;
   double epsilon = std::numeric_limits<double>::infinity();
+  /// Fraction of β for bytes staying within a NUMA domain
+  double numa_factor_ = 1.0;
+  /// Fraction of β for bytes staying within a physical node
+  double node_factor_ = 1.0;
+  /// The rank topology, when either factor is set
+  std::shared_ptr<balance::RankTopology const> topology_ = nullptr;
   std::vector<bool> propagated_k_;
   std::mt19937 gen_propagate_;
   std::mt19937 gen_sample_;
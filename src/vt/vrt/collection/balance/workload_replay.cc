@@ -212,6 +212,7 @@ void replayWorkloads(
           }
           auto last_phase_info = theLBManager()->getPhaseInfo();
           last_phase_info->migration_count = lb_reassignment->global_migration_count;
+          last_phase_info->strategy_stats = lb_reassignment->strategy_stats_;
           last_phase_info->ran_lb = true;
           last_phase_info->phase = phase;
         }
@@ -190,14 +190,28 @@ void CollectionManager::makeCollectionImpl(param::ConstructParams<ColT>& po) {
     auto cons_fn = po.template getConsFn<ColT>();
 
     // Do all bulk insertions
+    std::vector<IndexType> local_idxs;
     for (auto&& range : po.bulk_inserts_) {
       range.foreach([&](IndexType idx) {
         if (elementMappedHere(map_han, map_object, idx, bounds)) {
-          makeCollectionElement<ColT>(proxy, idx, this_node, cons_fn);
+          local_idxs.push_back(idx);
         }
       });
     }
 
+    // Fixed-membership bounded collections can store their local elements in
+    // a dense array instead of the hash map
+    if (
+      has_bounds and not has_dynamic_membership and
+      not theConfig()->vt_no_dense_elm_holder
+    ) {
+      findElmHolder<IndexType>(proxy)->setDenseRange(bounds, local_idxs);
+    }
+
+    for (auto&& idx : local_idxs) {
+      makeCollectionElement<ColT>(proxy, idx, this_node, cons_fn);
+    }
+
     // Do all list insertions
     for (auto&& list_fn : po.list_inserts_) {
       list_fn([&](IndexType idx) {
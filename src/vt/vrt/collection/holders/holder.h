@@ -59,9 +59,51 @@
 #include <memory>
 #include <functional>
 #include <cstdlib>
+#include <type_traits>
+#include <vector>
 
 namespace vt { namespace vrt { namespace collection {
 
+namespace detail {
+
+/**
+ * \internal \struct DenseLinearizer
+ *
+ * \brief Linearize an index within the collection bounds for dense element
+ * storage; only dense index types (with \c DenseIndexType) can be linearized
+ */
+template <typename IndexT, typename = void>
+struct DenseLinearizer {
+  static constexpr bool const linearizable = false;
+
+  static std::size_t apply(IndexT const&, IndexT const&) { return 0; }
+};
+
+template <typename IndexT>
+struct DenseLinearizer<
+  IndexT, std::void_t<typename IndexT::DenseIndexType>
+> {
+  static constexpr bool const linearizable = true;
+
+  /// Returned for an index outside the bounds
+  static constexpr std::size_t const out_of_bounds = ~std::size_t{0};
+
+  static std::size_t apply(IndexT const& idx, IndexT const& bounds) {
+    std::size_t val = 0;
+    for (int d = 0; d < static_cast<int>(IndexT::ndims()); d++) {
+      auto const i = static_cast<int64_t>(idx[d]);
+      auto const b = static_cast<int64_t>(bounds[d]);
+      if (i < 0 or i >= b) {
+        return out_of_bounds;
+      }
+      val = val * static_cast<std::size_t>(b) + static_cast<std::size_t>(i);
+    }
+    return val;
+  }
+};
+
+} /* end namespace detail */
+
 /**
  * \struct Holder
  *
@@ -122,6 +164,29 @@ struct Holder {
    */
   VirtualPtrType remove(IndexT const& idx);
 
+  /**
+   * \brief Store elements in a dense array indexed by their linearized index
+   * relative to the first local element, instead of the hash map. Indices that
+   * fall outside the range (e.g., migrated in later) still go in the hash map.
+   *
+   * Only takes effect for dense index types, on an empty holder, and when the
+   * local indices fill at least half of the range they span (e.g., a block
+   * mapping).
+   *
+   * \param[in] bounds the collection bounds
+   * \param[in] local_idxs the indices about to be inserted on this node
+   *
+   * \return whether dense storage is used
+   */
+  bool setDenseRange(IndexT const& bounds, std::vector<IndexT> const& local_idxs);
+
+  /**
+   * \brief Whether elements are stored in a dense array
+   *
+   * \return whether dense storage is used
+   */
+  bool hasDenseRange() const { return not dense_.empty(); }
+
   /**
    * \brief Destroy all elements
    */
@@ -149,6 +214,9 @@ struct Holder {
   /**
    * \brief Perform apply action over all collection elements
    *
+   * \c fn may insert or remove elements; elements it inserts outside the dense
+   * range are not visited by this walk.
+   *
    * \param[in] fn apply function for each element
    */
   void foreach(FuncApplyType fn);
@@ -254,6 +322,28 @@ struct Holder {
 
   friend struct CollectionManager;
 
+private:
+  /**
+   * \internal \brief Get the dense slot for an index
+   *
+   * \param[in] idx the index
+   *
+   * \return the slot; \c nullptr if the index is outside the dense range
+   */
+  InnerHolder* findDense(IndexT const& idx);
+
+  /**
+   * \internal \brief Whether a dense slot holds an element (possibly erased
+   * but not yet removed)
+   *
+   * \param[in] slot the slot
+   *
+   * \return whether it is occupied
+   */
+  static bool occupied(InnerHolder const& slot) {
+    return slot.vc_ptr_ != nullptr or slot.erased_;
+  }
+
 private:
   bool erased                                                     = false;
   typename TypedIndexContainer::iterator foreach_iter             = {};
@@ -265,6 +355,10 @@ private:
   NodeType group_root_                                            = 0;
   CountType num_erased_not_removed_                               = 0;
   std::vector<listener::ListenFnType<IndexT>> event_listeners_    = {};
+  IndexT dense_bounds_                                            = {};
+  std::size_t dense_lo_                                           = 0;
+  std::size_t num_dense_                                          = 0;
+  std::vector<InnerHolder> dense_                                 = {};
 };
 
 }}} /* end namespace vt::vrt::collection */
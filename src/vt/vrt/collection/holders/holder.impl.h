@@ -51,11 +51,68 @@
 #include <unordered_map>
 #include <tuple>
 #include <cassert>
+#include <algorithm>
 
 namespace vt { namespace vrt { namespace collection {
 
+template <typename IndexT>
+bool Holder<IndexT>::setDenseRange(
+  IndexT const& bounds, std::vector<IndexT> const& local_idxs
+) {
+  using LinearizerType = detail::DenseLinearizer<IndexT>;
+
+  if (
+    not LinearizerType::linearizable or
+    local_idxs.empty() or not vc_container_.empty() or not dense_.empty()
+  ) {
+    return false;
+  }
+
+  auto lo = ~std::size_t{0};
+  auto hi = std::size_t{0};
+  for (auto&& idx : local_idxs) {
+    auto const offset = LinearizerType::apply(idx, bounds);
+    if (offset == ~std::size_t{0}) {
+      return false;
+    }
+    lo = std::min(lo, offset);
+    hi = std::max(hi, offset);
+  }
+
+  // Only worth it if the local elements are mostly contiguous in the range
+  auto const span = hi - lo + 1;
+  if (span > 2 * local_idxs.size()) {
+    return false;
+  }
+
+  dense_bounds_ = bounds;
+  dense_lo_ = lo;
+  dense_.reserve(span);
+  for (std::size_t i = 0; i < span; i++) {
+    dense_.emplace_back(nullptr);
+  }
+  return true;
+}
+
+template <typename IndexT>
+typename Holder<IndexT>::InnerHolder* Holder<IndexT>::findDense(
+  IndexT const& idx
+) {
+  if (dense_.empty()) {
+    return nullptr;
+  }
+  auto const offset = detail::DenseLinearizer<IndexT>::apply(idx, dense_bounds_);
+  if (offset < dense_lo_ or offset - dense_lo_ >= dense_.size()) {
+    return nullptr;
+  }
+  return &dense_[offset - dense_lo_];
+}
+
 template <typename IndexT>
 bool Holder<IndexT>::exists(IndexT const& idx ) {
+  if (auto slot = findDense(idx); slot != nullptr) {
+    return slot->vc_ptr_ != nullptr and not slot->erased_;
+  }
   auto& container = vc_container_;
   auto iter = container.find(idx);
   return iter != container.end() and not iter->second.erased_;
@@ -66,6 +123,17 @@ void Holder<IndexT>::insert(IndexT const& idx, InnerHolder&& inner) {
   vtAssert(!is_destroyed_, "Must not be destroyed to insert a new element");
   vtAssert(!exists(idx), "Should not exist to insert element");
 
+  if (auto slot = findDense(idx); slot != nullptr) {
+    if (slot->erased_) {
+      num_erased_not_removed_--;
+      num_dense_--;
+    }
+    slot->vc_ptr_ = std::move(inner.vc_ptr_);
+    slot->erased_ = false;
+    num_dense_++;
+    return;
+  }
+
   auto const& lookup = idx;
   auto& container = vc_container_;
 
@@ -98,6 +166,11 @@ template <typename IndexT>
 typename Holder<IndexT>::InnerHolder& Holder<IndexT>::lookup(
   IndexT const& idx
 ) {
+  if (auto slot = findDense(idx); slot != nullptr) {
+    vtAssert(occupied(*slot), "Entry must exist in holder when searching");
+    return *slot;
+  }
+
   auto const& lookup = idx;
   auto& container = vc_container_;
   auto iter = container.find(lookup);
@@ -111,6 +184,17 @@ template <typename IndexT>
 typename Holder<IndexT>::VirtualPtrType Holder<IndexT>::remove(
   IndexT const& idx
 ) {
+  if (auto slot = findDense(idx); slot != nullptr) {
+    vtAssert(
+      occupied(*slot), "Entry must exist in holder when removing entry"
+    );
+    vtAssert(slot->erased_ == false, "Must not be erased already");
+    auto owned_ptr = std::move(slot->vc_ptr_);
+    slot->erased_ = true;
+    num_erased_not_removed_++;
+    return owned_ptr;
+  }
+
   auto const& lookup = idx;
   auto& container = vc_container_;
   auto iter = container.find(lookup);
@@ -128,6 +212,9 @@ template <typename IndexT>
 void Holder<IndexT>::destroyAll() {
   if (!is_destroyed_) {
     vc_container_.clear();
+    dense_.clear();
+    num_dense_ = 0;
+    num_erased_not_removed_ = 0;
     is_destroyed_ = true;
   }
 }
@@ -139,6 +226,16 @@ bool Holder<IndexT>::isDestroyed() const {
 
 template <typename IndexT>
 void Holder<IndexT>::cleanupExists() {
+  if (num_erased_not_removed_ == 0) {
+    return;
+  }
+  for (auto&& slot : dense_) {
+    if (slot.erased_) {
+      num_erased_not_removed_--;
+      num_dense_--;
+      slot.erased_ = false;
+    }
+  }
   auto& container = vc_container_;
   for (auto iter = container.begin(); iter != container.end(); ) {
     if (iter->second.erased_) {
@@ -155,12 +252,27 @@ void Holder<IndexT>::foreach(FuncApplyType fn) {
   static uint64_t num_reentrant = 0;
 
   num_reentrant++;
+  // Index-based since elements may be inserted during the traversal
+  for (std::size_t i = 0; i < dense_.size(); i++) {
+    auto const col_ptr = dense_[i].getRawPtr();
+    if (col_ptr != nullptr and not dense_[i].erased_) {
+      fn(col_ptr->getIndex(), col_ptr);
+    }
+  }
+  // A handler run by fn may insert an element, which can rehash the map and
+  // invalidate its iterators; walk a snapshot of the keys instead
   auto& container = vc_container_;
-  for (auto& elm : container) {
+  std::vector<IndexT> keys;
+  keys.reserve(container.size());
+  for (auto const& elm : container) {
     if (!elm.second.erased_) {
-      auto const& idx = elm.first;
-      auto const& holder = elm.second;
-      auto const col_ptr = holder.getRawPtr();
+      keys.push_back(elm.first);
+    }
+  }
+  for (auto const& idx : keys) {
+    auto iter = container.find(idx);
+    if (iter != container.end() and not iter->second.erased_) {
+      auto const col_ptr = iter->second.getRawPtr();
       fn(idx, col_ptr);
     }
   }
@@ -174,15 +286,22 @@ void Holder<IndexT>::foreach(FuncApplyType fn) {
 template <typename IndexT>
 typename Holder<IndexT>::TypedIndexContainer::size_type
 Holder<IndexT>::numElements() const {
-  return vc_container_.size() - num_erased_not_removed_;
+  return vc_container_.size() + num_dense_ - num_erased_not_removed_;
 }
 
 template <typename IndexT>
 typename Holder<IndexT>::TypedIndexContainer::size_type
 Holder<IndexT>::numElementsExpr(FuncExprType fn) const {
   typename Holder<IndexT>::TypedIndexContainer::size_type num_in = 0;
+  for (auto&& slot : dense_) {
+    if (slot.vc_ptr_ != nullptr and not slot.erased_) {
+      num_in += fn(slot.vc_ptr_->getIndex());
+    }
+  }
   for (auto&& elm : vc_container_) {
-    num_in += fn(elm.first);
+    if (not elm.second.erased_) {
+      num_in += fn(elm.first);
+    }
   }
   return num_in;
 }
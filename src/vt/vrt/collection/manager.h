@@ -1133,6 +1133,21 @@ public:
   template <typename ColT, typename IndexT, typename MsgT>
   static void collectionBcastHandler(MsgT* msg);
 
+  /**
+   * \internal \brief Deliver a broadcast to all local elements in a single
+   * scheduler unit that walks the holder once and shares the message and one
+   * runnable. Each element's handler still runs with its own collection and LB
+   * context so timing is attributed per element. Elements present when the
+   * unit runs receive the broadcast.
+   *
+   * \param[in] msg collection message
+   * \param[in] elm_holder the element holder for the collection
+   */
+  template <typename ColT, typename IndexT, typename MsgT>
+  static void collectionBcastBulkDeliver(
+    MsgT* msg, Holder<IndexT>* elm_holder
+  );
+
   /**
    * \internal \brief Receive a broadcast at the root for stamping
    *
@@ -1782,6 +1797,7 @@ private:
 #include "vt/vrt/collection/manager.impl.h"
 #include "vt/vrt/collection/migrate/manager_migrate_attorney.impl.h"
 #include "vt/vrt/collection/send/sendable.impl.h"
+#include "vt/vrt/collection/send/send_batch.impl.h"
 #include "vt/vrt/collection/gettable/gettable.impl.h"
 #include "vt/vrt/collection/reducable/reducable.impl.h"
 #include "vt/vrt/collection/invoke/invokable.impl.h"
@@ -85,6 +85,7 @@
 #include <functional>
 #include <cassert>
 #include <memory>
+#include <vector>
 #include <sys/stat.h>
 #include <unistd.h>
 
@@ -251,6 +252,11 @@ template <typename ColT, typename IndexT, typename MsgT>
       normal, vrt_coll,
       "broadcast apply: size={}\n", elm_holder->numElements()
     );
+    if (theConfig()->vt_bcast_bulk_local) {
+      collectionBcastBulkDeliver<ColT,IndexT,MsgT>(msg, elm_holder);
+      theMsg()->popEpoch(cur_epoch);
+      return;
+    }
     elm_holder->foreach([col_msg, msg, handler](
       [[maybe_unused]] IndexT const& idx, Indexable<IndexT>* base
     ) {
@@ -283,6 +289,69 @@ template <typename ColT, typename IndexT, typename MsgT>
   theMsg()->popEpoch(cur_epoch);
 }
 
+template <typename ColT, typename IndexT, typename MsgT>
+/*static*/ void CollectionManager::collectionBcastBulkDeliver(
+  MsgT* msg, Holder<IndexT>* elm_holder
+) {
+  auto const col_msg = static_cast<CollectionMessage<ColT>*>(msg);
+  auto const bcast_proxy = col_msg->getBcastProxy();
+  auto const handler = col_msg->getVrtHandler();
+  auto const from = col_msg->getFromNode();
+  auto const epoch = theMsg()->getEpochContextMsg(msg);
+
+  [[maybe_unused]] trace::TraceEventIDType trace_event = trace::no_trace_event;
+  #if vt_check_enabled(trace_enabled)
+    trace_event = col_msg->getFromTraceEvent();
+  #endif
+
+  if (elm_holder->numElements() == 0) {
+    return;
+  }
+
+  // Keep the epoch alive until the whole batch runs
+  theTerm()->produce(epoch);
+
+  auto m = promoteMsg(msg);
+  theSched()->enqueue(m, [=]{
+    auto holder = theCollection()->findElmHolder<IndexT>(bcast_proxy);
+    if (holder != nullptr) {
+#if !vt_check_enabled(fcontext)
+      // One runnable carries the message, epoch and sender for the whole
+      // batch; only the element-specific contexts change between elements
+      runnable::RunnableNew shared{m, false};
+      shared.addContextSetContext(&shared, from);
+      shared.addContextTD(epoch);
+#endif
+
+      // A single walk of the holder; it skips elements that a previous handler
+      // in the batch caused to migrate out or be destroyed
+      holder->foreach([&](
+        [[maybe_unused]] IndexT const& idx, Indexable<IndexT>* base
+      ) {
+#if vt_check_enabled(fcontext)
+        // A threaded handler may suspend, so each needs its own runnable
+        collectionAutoMsgDeliver<ColT,IndexT,MsgT>(
+          m.get(), base, handler, from, trace_event, true
+        );
+#else
+        shared.resetElement(base, handler, m.get());
+# if vt_check_enabled(trace_enabled)
+        uint64_t const idx1 = idx.ndims() > 0 ? idx[0] : 0;
+        uint64_t const idx2 = idx.ndims() > 1 ? idx[1] : 0;
+        uint64_t const idx3 = idx.ndims() > 2 ? idx[2] : 0;
+        uint64_t const idx4 = idx.ndims() > 3 ? idx[3] : 0;
+        shared.addContextTrace(
+          m, trace_event, handler, from, idx1, idx2, idx3, idx4
+        );
+# endif
+        shared.run();
+#endif
+      });
+    }
+    theTerm()->consume(epoch);
+  });
+}
+
 template <typename ColT, typename IndexT, typename MsgT>
 /*static*/ void CollectionManager::collectionMsgTypedHandler(MsgT* msg) {
   auto const col_msg = static_cast<CollectionMessage<ColT>*>(msg);
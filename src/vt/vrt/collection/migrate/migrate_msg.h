@@ -48,6 +48,10 @@
 #include "vt/messaging/message.h"
 #include "vt/vrt/proxy/collection_elm_proxy.h"
 #include "vt/vrt/collection/collection_info.h"
+#include "vt/vrt/collection/types/element_arena.h"
+
+#include <new>
+#include <type_traits>
 
 namespace vt { namespace vrt { namespace collection {
 
@@ -71,7 +75,16 @@ struct MigrateMsg final : ::vt::Message {
   void serialize(Serializer& s) {
     MessageParentType::serialize(s);
 
-    checkpoint::reconstructPointedToObjectIfNeeded(s, elm_);
+    if constexpr (
+      UseElementArena<ColT>::value and std::is_default_constructible_v<ColT>
+    ) {
+      // Place an element migrating in with the ones constructed on this rank
+      if (s.isUnpacking()) {
+        elm_ = new (ElementArena::get<ColT>().allocate()) ColT{};
+      }
+    } else {
+      checkpoint::reconstructPointedToObjectIfNeeded(s, elm_);
+    }
 
     s | *elm_ | elm_proxy_ | from_ | to_;
   }
@@ -79,6 +79,27 @@ struct RDMAable : BaseProxyT {
   template <typename T, vt::rdma::HandleEnum E, typename IndexU>
   void destroyHandleRDMA(vt::rdma::Handle<T,E,IndexU> handle) const;
 
+  /**
+   * \brief Make a new halo for this collection over an RDMA handle sized for
+   * the layout---a collective invocation across all elements
+   *
+   * \param[in] idx the index of the calling element
+   * \param[in] layout the ghost region layout, identical on all elements
+   *
+   * \return the new halo
+   */
+  template <typename T>
+  vt::rdma::Halo<T, IndexT>
+  makeHaloRDMA(IndexT idx, vt::rdma::HaloLayout layout) const;
+
+  /**
+   * \brief Destroy a halo created for this collection
+   *
+   * \param[in] halo the halo to destroy
+   */
+  template <typename T>
+  void destroyHaloRDMA(vt::rdma::Halo<T, IndexT> const& halo) const;
+
 };
 
 }}} /* end namespace vt::vrt::collection */
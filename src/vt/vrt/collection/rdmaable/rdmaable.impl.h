@@ -46,6 +46,7 @@
 
 #include "vt/config.h"
 #include "vt/rdmahandle/manager.h"
+#include "vt/rdmahandle/halo.h"
 
 namespace vt { namespace vrt { namespace collection {
 
@@ -76,6 +77,24 @@ void RDMAable<ColT,IndexT,BaseProxyT>::destroyHandleRDMA(
   return vt::theHandleRDMA()->deleteHandleCollection(handle);
 }
 
+template <typename ColT, typename IndexT, typename BaseProxyT>
+template <typename T>
+vt::rdma::Halo<T, IndexT>
+RDMAable<ColT,IndexT,BaseProxyT>::makeHaloRDMA(
+  IndexT idx, vt::rdma::HaloLayout layout
+) const {
+  auto handle = makeHandleRDMA<T>(idx, layout.getTotal(), true);
+  return vt::rdma::Halo<T, IndexT>{handle, std::move(layout)};
+}
+
+template <typename ColT, typename IndexT, typename BaseProxyT>
+template <typename T>
+void RDMAable<ColT,IndexT,BaseProxyT>::destroyHaloRDMA(
+  vt::rdma::Halo<T, IndexT> const& halo
+) const {
+  destroyHandleRDMA(halo.getHandle());
+}
+
 }}} /* end namespace vt::vrt::collection */
 
 #endif /*INCLUDED_VT_VRT_COLLECTION_RDMAABLE_RDMAABLE_IMPL_H*/
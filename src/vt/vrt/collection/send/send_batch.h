@@ -0,0 +1,190 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                 send_batch.h
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_VRT_COLLECTION_SEND_SEND_BATCH_H
+#define INCLUDED_VT_VRT_COLLECTION_SEND_SEND_BATCH_H
+
+#include "vt/config.h"
+#include "vt/messaging/message.h"
+#include "vt/messaging/param_msg.h"
+#include "vt/elm/elm_id.h"
+#include "vt/utils/fntraits/fntraits.h"
+
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+namespace vt { namespace vrt { namespace collection {
+
+/**
+ * \struct SendBatchMsg
+ *
+ * \brief Carries all the (index, parameters) pairs of a \c SendBatch destined
+ * for one rank
+ */
+template <typename IndexT, typename TupleT>
+struct SendBatchMsg : vt::Message {
+  using MessageParentType = vt::Message;
+  vt_msg_serialize_required(); // by items_
+
+  using ItemType = std::tuple<IndexT, TupleT>;
+
+  SendBatchMsg() = default;
+  SendBatchMsg(
+    VirtualProxyType in_proxy, elm::ElementIDStruct in_sender_elm,
+    std::vector<ItemType>&& in_items
+  ) : proxy_(in_proxy),
+      sender_elm_(in_sender_elm),
+      items_(std::move(in_items))
+  { }
+
+  template <typename SerializerT>
+  void serialize(SerializerT& s) {
+    MessageParentType::serialize(s);
+    s | proxy_ | sender_elm_ | items_;
+  }
+
+  VirtualProxyType proxy_ = no_vrt_proxy;
+  elm::ElementIDStruct sender_elm_ = {};
+  std::vector<ItemType> items_;
+};
+
+/**
+ * \struct SendBatch
+ *
+ * \brief Coalesces sends of the same member handler \c f to many collection
+ * elements into one message per destination rank.
+ *
+ * Each index is resolved to a rank when it is added, using the local
+ * registration and location cache (falling back to the home node), so no
+ * messages are sent to resolve locations. The receiver fans out to each
+ * element with the same per-element message the normal send path would
+ * deliver, recording the communication as coming from the sending element;
+ * an element that is no longer on the receiving rank is forwarded through the
+ * location manager.
+ *
+ * \code{.cpp}
+ * auto batch = proxy.makeSendBatch<&MyCol::update>();
+ * for (auto&& n : neighbors) {
+ *   batch.add(n, value);
+ * }
+ * batch.send();
+ * \endcode
+ */
+template <typename ColT, auto f>
+struct SendBatch {
+  using IndexType  = typename ColT::IndexType;
+  using FnTrait    = ObjFuncTraits<decltype(f)>;
+  using Tuple      = typename FnTrait::TupleType;
+  using TupleType  = typename messaging::detail::GetTraitsTuple<Tuple>::TupleType;
+  using MsgType    = SendBatchMsg<IndexType, TupleType>;
+  using ItemType   = typename MsgType::ItemType;
+
+  static_assert(
+    std::is_same_v<typename FnTrait::MsgT, NoMsg>,
+    "SendBatch requires a member handler that takes parameters (not a message)"
+  );
+
+  /**
+   * \brief Construct an empty batch
+   *
+   * \param[in] in_proxy the collection proxy
+   */
+  explicit SendBatch(VirtualProxyType in_proxy);
+
+  SendBatch(SendBatch&&) = default;
+  SendBatch& operator=(SendBatch&&) = default;
+
+  /**
+   * \brief Add a send to an element
+   *
+   * \param[in] idx the element index
+   * \param[in] params the parameters for the handler
+   */
+  template <typename... Params>
+  void add(IndexType const& idx, Params&&... params);
+
+  /**
+   * \brief Number of sends in the batch
+   */
+  std::size_t size() const { return size_; }
+
+  /**
+   * \brief Number of ranks the batch will send to
+   */
+  std::size_t numRanks() const { return items_.size(); }
+
+  /**
+   * \brief Send all the added items, one message per destination rank, and
+   * clear the batch
+   */
+  void send();
+
+  /**
+   * \internal \brief Fan out a batch to the elements on the receiving rank
+   *
+   * \param[in] msg the batch message
+   */
+  static void batchHandler(MsgType* msg);
+
+private:
+  /**
+   * \internal \brief Send one item through the normal element send path
+   *
+   * \param[in] proxy the collection proxy
+   * \param[in] item the (index, params) to send
+   * \param[in] sender_elm the element the batch was sent from
+   */
+  static void sendItem(
+    VirtualProxyType proxy, ItemType&& item, elm::ElementIDStruct sender_elm
+  );
+
+private:
+  VirtualProxyType proxy_ = no_vrt_proxy;
+  std::unordered_map<NodeType, std::vector<ItemType>> items_;
+  std::size_t size_ = 0;
+};
+
+}}} /* end namespace vt::vrt::collection */
+
+#endif /*INCLUDED_VT_VRT_COLLECTION_SEND_SEND_BATCH_H*/
@@ -0,0 +1,165 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                              send_batch.impl.h
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_VRT_COLLECTION_SEND_SEND_BATCH_IMPL_H
+#define INCLUDED_VT_VRT_COLLECTION_SEND_SEND_BATCH_IMPL_H
+
+#include "vt/config.h"
+#include "vt/vrt/collection/send/send_batch.h"
+#include "vt/vrt/collection/manager.h"
+#include "vt/vrt/collection/messages/param_col_msg.h"
+#include "vt/topos/location/manager.h"
+
+namespace vt { namespace vrt { namespace collection {
+
+template <typename ColT, auto f>
+SendBatch<ColT, f>::SendBatch(VirtualProxyType in_proxy)
+  : proxy_(in_proxy)
+{ }
+
+template <typename ColT, auto f>
+template <typename... Params>
+void SendBatch<ColT, f>::add(IndexType const& idx, Params&&... params) {
+  auto lm = theLocMan()->getCollectionLM<IndexType>(proxy_);
+  vtAssert(lm != nullptr, "LM must exist");
+
+  auto dest = lm->getCachedLocation(idx);
+  if (dest == uninitialized_destination) {
+    dest = theCollection()->getMappedNode<ColT>(proxy_, idx);
+  }
+
+  items_[dest].emplace_back(idx, TupleType{std::forward<Params>(params)...});
+  size_++;
+}
+
+template <typename ColT, auto f>
+void SendBatch<ColT, f>::send() {
+  auto const this_node = theContext()->getNode();
+
+  elm::ElementIDStruct sender_elm = {};
+# if vt_check_enabled(lblite)
+  sender_elm = theCollection()->getCurrentContext();
+# endif
+
+  for (auto&& elm : items_) {
+    auto const dest = elm.first;
+    auto& items = elm.second;
+
+    vt_debug_print(
+      normal, vrt_coll,
+      "SendBatch::send: proxy={:x}, dest={}, items={}\n",
+      proxy_, dest, items.size()
+    );
+
+    // Nothing to coalesce: use the normal send path
+    if (dest == this_node or items.size() == 1) {
+      for (auto&& item : items) {
+        sendItem(proxy_, std::move(item), sender_elm);
+      }
+      continue;
+    }
+
+    auto msg = makeMessage<MsgType>(proxy_, sender_elm, std::move(items));
+
+    // The communication is recorded per element on the receiver as coming from
+    // the sending element; do not also record it against the bare handler
+    envelopeSetCommLBDataRecordedAboveBareHandler(msg->env, true);
+
+    theMsg()->sendMsg<&SendBatch<ColT, f>::batchHandler>(dest, msg);
+  }
+
+  items_.clear();
+  size_ = 0;
+}
+
+template <typename ColT, auto f>
+/*static*/ void SendBatch<ColT, f>::batchHandler(MsgType* msg) {
+  vt_debug_print(
+    normal, vrt_coll,
+    "SendBatch::batchHandler: proxy={:x}, items={}\n",
+    msg->proxy_, msg->items_.size()
+  );
+
+  for (auto&& item : msg->items_) {
+    sendItem(msg->proxy_, std::move(item), msg->sender_elm_);
+  }
+}
+
+template <typename ColT, auto f>
+/*static*/ void SendBatch<ColT, f>::sendItem(
+  VirtualProxyType proxy, ItemType&& item,
+  [[maybe_unused]] elm::ElementIDStruct sender_elm
+) {
+  using SendMsgT = ParamColMsg<Tuple, ColT>;
+
+  auto msg = makeMessage<SendMsgT>();
+  std::apply(
+    [&](auto&&... params) {
+      msg->setParams(std::forward<decltype(params)>(params)...);
+    },
+    std::move(std::get<1>(item))
+  );
+
+# if vt_check_enabled(lblite)
+  // Attribute the communication to the element that made the batch (on the
+  // receiver, no element is running so the send path will not override this)
+  if (sender_elm.id != elm::no_element_id) {
+    msg->setSenderElm(sender_elm);
+    msg->setCat(elm::CommCategory::SendRecv);
+  }
+# endif
+
+  auto han = auto_registry::makeAutoHandlerCollectionMemParam<
+    ColT, decltype(f), f, SendMsgT
+  >();
+  auto elm_proxy = VrtElmProxy<ColT, IndexType>(
+    proxy, BaseElmProxy<IndexType>{std::get<0>(item)}
+  );
+  theCollection()->sendMsgUntypedHandler<SendMsgT, ColT, IndexType>(
+    elm_proxy, msg.get(), han
+  );
+}
+
+}}} /* end namespace vt::vrt::collection */
+
+#endif /*INCLUDED_VT_VRT_COLLECTION_SEND_SEND_BATCH_IMPL_H*/
@@ -50,6 +50,7 @@
 #include "vt/vrt/collection/types/base.fwd.h"
 #include "vt/vrt/collection/types/indexable.h"
 #include "vt/vrt/collection/types/untyped.h"
+#include "vt/vrt/collection/types/element_arena.h"
 #include "vt/vrt/collection/manager.fwd.h"
 #include "vt/vrt/proxy/collection_proxy.h"
 #include "vt/collective/reduce/scoping/strong_types.h"
@@ -73,6 +74,30 @@ struct CollectionBase : Indexable<IndexT> {
 
   template <typename Serializer>
   void serialize(Serializer& s);
+
+  /**
+   * \brief Allocate an element; if \c ColT opts in with \c vt_arena_allocate,
+   * elements are placed contiguously in a per-type \c ElementArena
+   *
+   * \param[in] size the size of the allocation
+   *
+   * \return the storage
+   */
+  static void* operator new(std::size_t size);
+
+  /**
+   * \brief Free an element allocated by \c operator \c new
+   *
+   * \param[in] ptr the storage
+   * \param[in] size the size of the allocation
+   */
+  static void operator delete(void* ptr, std::size_t size);
+
+  static void* operator new(std::size_t, void* place) noexcept {
+    return place;
+  }
+
+  static void operator delete(void*, void*) noexcept { }
 };
 
 }}} /* end namespace vt::vrt::collection */
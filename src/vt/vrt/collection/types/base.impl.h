@@ -91,6 +91,30 @@ void CollectionBase<ColT, IndexT>::serialize(Serializer& s) {
 template <typename ColT, typename IndexT>
 /*virtual*/ CollectionBase<ColT, IndexT>::~CollectionBase() {}
 
+template <typename ColT, typename IndexT>
+/*static*/ void* CollectionBase<ColT, IndexT>::operator new(std::size_t size) {
+  // Types derived from ColT have a different size and use the global heap
+  if constexpr (UseElementArena<ColT>::value) {
+    if (size == sizeof(ColT)) {
+      return ElementArena::get<ColT>().allocate();
+    }
+  }
+  return ::operator new(size);
+}
+
+template <typename ColT, typename IndexT>
+/*static*/ void CollectionBase<ColT, IndexT>::operator delete(
+  void* ptr, std::size_t size
+) {
+  if constexpr (UseElementArena<ColT>::value) {
+    if (size == sizeof(ColT)) {
+      ElementArena::get<ColT>().deallocate(ptr);
+      return;
+    }
+  }
+  ::operator delete(ptr);
+}
+
 }}} /* end namespace vt::vrt::collection */
 
 #endif /*INCLUDED_VT_VRT_COLLECTION_TYPES_BASE_IMPL_H*/
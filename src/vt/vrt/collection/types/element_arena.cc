@@ -0,0 +1,131 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                               element_arena.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include "vt/config.h"
+#include "vt/vrt/collection/types/element_arena.h"
+
+#include <algorithm>
+#include <new>
+
+namespace vt { namespace vrt { namespace collection {
+
+ElementArena::ElementArena(std::size_t in_elm_size, std::size_t in_elm_align)
+  : elm_size_(in_elm_size),
+    elm_align_(std::max(in_elm_align, alignof(void*)))
+{
+  // Each slot must hold the free list link and keep the elements aligned
+  auto const size = std::max(elm_size_, sizeof(void*));
+  slot_size_ = (size + elm_align_ - 1) / elm_align_ * elm_align_;
+  slab_elms_ = std::max(min_slab_elms, slab_bytes / slot_size_);
+}
+
+ElementArena::~ElementArena() {
+  releaseSlabs();
+}
+
+void* ElementArena::allocate() {
+  num_live_++;
+
+  if (free_ != nullptr) {
+    auto const ptr = free_;
+    free_ = *static_cast<void**>(ptr);
+    return ptr;
+  }
+
+  if (bump_ == bump_end_) {
+    auto const bytes = slot_size_ * slab_elms_;
+    auto const slab = static_cast<char*>(
+      ::operator new(bytes, std::align_val_t{elm_align_})
+    );
+    slabs_.emplace(reinterpret_cast<uintptr_t>(slab), slab);
+    bump_ = slab;
+    bump_end_ = slab + bytes;
+  }
+
+  auto const ptr = bump_;
+  bump_ += slot_size_;
+  return ptr;
+}
+
+void ElementArena::deallocate(void* ptr) {
+  if (ptr == nullptr) {
+    return;
+  }
+
+  if (not owns(ptr)) {
+    ::operator delete(ptr);
+    return;
+  }
+
+  *static_cast<void**>(ptr) = free_;
+  free_ = ptr;
+  num_live_--;
+
+  if (num_live_ == 0) {
+    releaseSlabs();
+  }
+}
+
+bool ElementArena::owns(void const* ptr) const {
+  if (slabs_.empty()) {
+    return false;
+  }
+  auto const addr = reinterpret_cast<uintptr_t>(ptr);
+  auto iter = slabs_.upper_bound(addr);
+  if (iter == slabs_.begin()) {
+    return false;
+  }
+  --iter;
+  return addr < iter->first + slot_size_ * slab_elms_;
+}
+
+void ElementArena::releaseSlabs() {
+  for (auto&& slab : slabs_) {
+    ::operator delete(slab.second, std::align_val_t{elm_align_});
+  }
+  slabs_.clear();
+  free_ = nullptr;
+  bump_ = bump_end_ = nullptr;
+}
+
+}}} /* end namespace vt::vrt::collection */
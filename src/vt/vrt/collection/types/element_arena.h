@@ -0,0 +1,174 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                               element_arena.h
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_VRT_COLLECTION_TYPES_ELEMENT_ARENA_H
+#define INCLUDED_VT_VRT_COLLECTION_TYPES_ELEMENT_ARENA_H
+
+#include "vt/config.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <map>
+#include <type_traits>
+
+namespace vt { namespace vrt { namespace collection {
+
+/**
+ * \struct UseElementArena
+ *
+ * \brief Whether a collection type opts in to arena allocation of its
+ * elements by declaring \c "static constexpr bool vt_arena_allocate = true;"
+ */
+template <typename ColT, typename = void>
+struct UseElementArena : std::false_type { };
+
+template <typename ColT>
+struct UseElementArena<
+  ColT, std::enable_if_t<ColT::vt_arena_allocate>
+> : std::true_type { };
+
+/**
+ * \struct ElementArena
+ *
+ * \brief Allocates fixed-size elements out of large contiguous slabs.
+ *
+ * Elements constructed in order (e.g., a bulk insertion) are laid out next to
+ * each other, so iterating over them walks contiguous memory, and the slot of
+ * a freed element (e.g., one that migrated out) is reused by the next
+ * allocation, including the storage of an element that migrates in (for
+ * default-constructible types). Slabs are released once no element is live.
+ */
+struct ElementArena {
+  /// Target size of each slab in bytes
+  static constexpr std::size_t const slab_bytes = 1 << 20;
+
+  /// Minimum number of elements in each slab
+  static constexpr std::size_t const min_slab_elms = 64;
+
+  /**
+   * \brief Construct an arena
+   *
+   * \param[in] in_elm_size size of each element
+   * \param[in] in_elm_align alignment of each element
+   */
+  ElementArena(std::size_t in_elm_size, std::size_t in_elm_align);
+
+  ElementArena(ElementArena const&) = delete;
+  ElementArena& operator=(ElementArena const&) = delete;
+
+  ~ElementArena();
+
+  /**
+   * \brief Allocate storage for one element
+   *
+   * \return pointer to uninitialized storage
+   */
+  void* allocate();
+
+  /**
+   * \brief Free storage for one element
+   *
+   * \param[in] ptr the pointer, which if not allocated by this arena is
+   * released to the global \c operator \c delete
+   */
+  void deallocate(void* ptr);
+
+  /**
+   * \brief Whether a pointer was allocated by this arena
+   *
+   * \param[in] ptr the pointer
+   *
+   * \return whether it is owned
+   */
+  bool owns(void const* ptr) const;
+
+  /**
+   * \brief Number of live elements
+   */
+  std::size_t getNumLive() const { return num_live_; }
+
+  /**
+   * \brief Number of slabs currently allocated
+   */
+  std::size_t getNumSlabs() const { return slabs_.size(); }
+
+  /**
+   * \brief Number of element slots in each slab
+   */
+  std::size_t getSlabElms() const { return slab_elms_; }
+
+  /**
+   * \brief Get the arena for a collection type
+   *
+   * \return the arena
+   */
+  template <typename ColT>
+  static ElementArena& get() {
+    static ElementArena arena{sizeof(ColT), alignof(ColT)};
+    return arena;
+  }
+
+private:
+  /**
+   * \internal \brief Release all slabs
+   */
+  void releaseSlabs();
+
+private:
+  std::size_t elm_size_                = 0;
+  std::size_t elm_align_               = 0;
+  std::size_t slot_size_               = 0;
+  std::size_t slab_elms_               = 0;
+  /// Slabs keyed by their base address to find the owner of a pointer
+  std::map<uintptr_t, char*> slabs_    = {};
+  /// Intrusive list of freed slots
+  void* free_                          = nullptr;
+  /// Next never-used slot in the last slab
+  char* bump_                          = nullptr;
+  char* bump_end_                      = nullptr;
+  std::size_t num_live_                = 0;
+};
+
+}}} /* end namespace vt::vrt::collection */
+
+#endif /*INCLUDED_VT_VRT_COLLECTION_TYPES_ELEMENT_ARENA_H*/
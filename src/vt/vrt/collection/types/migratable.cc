@@ -47,6 +47,7 @@
 #include "vt/vrt/collection/manager.h"
 #include "vt/vrt/proxy/proxy_bits.h"
 #include "vt/elm/elm_id_bits.h"
+#include "vt/utils/memory/alloc_tracker.h"
 
 namespace vt { namespace vrt { namespace collection {
 
@@ -58,6 +59,12 @@ Migratable::Migratable()
   )
 { }
 
+/*virtual*/ Migratable::~Migratable() {
+  util::memory::AllocTracker::releaseContext(
+    {util::memory::AllocContextKind::Collection, elm_id_.id}
+  );
+}
+
 /*virtual*/ void Migratable::destroy() {
   vt_debug_print(
     verbose, vrt_coll,
@@ -64,6 +64,12 @@ struct Migratable : MigrateHookBase, storage::Storable {
 
   Migratable();
 
+  /*
+   * Releases the element's allocation tracking slot: an element that migrates
+   * in later charges a new one on that node
+   */
+  virtual ~Migratable();
+
   /*
    * The user or runtime system can invoke this method at any time (when a valid
    * pointer to it exists) to migrate this VCC element to another memory domain
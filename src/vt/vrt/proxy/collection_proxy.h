@@ -49,6 +49,7 @@
 #include "vt/vrt/proxy/base_elm_proxy.h"
 #include "vt/vrt/proxy/collection_elm_proxy.h"
 #include "vt/vrt/proxy/base_collection_proxy.h"
+#include "vt/vrt/collection/send/send_batch.h"
 
 namespace vt { namespace vrt { namespace collection {
 
@@ -114,6 +115,15 @@ struct CollectionProxy : ProxyCollectionTraits<ColT, IndexT> {
    * This must be called on every process
    */
   void setFocusedSubPhase(SubphaseType subphase);
+
+  /**
+   * \brief Make a batch that coalesces sends of a member handler to many
+   * elements into one message per destination rank
+   *
+   * \return the empty batch
+   */
+  template <auto f>
+  SendBatch<ColT, f> makeSendBatch() const;
 };
 
 }}} /* end namespace vt::vrt::collection */
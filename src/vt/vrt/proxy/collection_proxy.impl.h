@@ -106,6 +106,12 @@ CollectionProxy<ColT, IndexT>::setFocusedSubPhase(SubphaseType subphase) {
   balance::CollectionLBData::setFocusedSubPhase(this->getProxy(), subphase);
 }
 
+template <typename ColT, typename IndexT>
+template <auto f>
+SendBatch<ColT, f> CollectionProxy<ColT, IndexT>::makeSendBatch() const {
+  return SendBatch<ColT, f>{this->getProxy()};
+}
+
 }}} /* end namespace vt::vrt::collection */
 
 #endif /*INCLUDED_VT_VRT_PROXY_COLLECTION_PROXY_IMPL_H*/
@@ -65,6 +65,20 @@ struct TestCol : vt::Collection<TestCol, vt::Index1D> {
   void han(ColMsg* msg) {}
 };
 
+struct TestCol3D : vt::Collection<TestCol3D, vt::Index3D> {
+  using ColMsg = vt::CollectionMessage<TestCol3D>;
+
+  TestCol3D();
+
+  void han(ColMsg* msg) {}
+};
+
+static std::vector<vt::Index3D> local_idxs_3d;
+
+TestCol3D::TestCol3D() {
+  local_idxs_3d.push_back(getIndex());
+}
+
 struct NodeObj {
   struct ReduceMsg : vt::collective::ReduceNoneMsg { };
 
@@ -81,6 +95,22 @@ struct NodeObj {
     // fmt::print("ptr={}\n", print_ptr(col_proxy.lm));
   }
 
+  void initialize3D(bool dense) {
+    proxy_ = global_proxy = vt::theObjGroup()->getProxy<NodeObj>(this);
+
+    // Disable the dense element holder to compare against the hash map
+    theConfig()->vt_no_dense_elm_holder = not dense;
+
+    local_idxs_3d.clear();
+    auto range = vt::Index3D(32, 32, 32);
+    col_proxy_3d = vt::makeCollection<TestCol3D>("test_3d")
+      .bounds(range)
+      .bulkInsert()
+      .wait();
+
+    theConfig()->vt_no_dense_elm_holder = false;
+  }
+
   void complete() {
   }
 
@@ -102,6 +132,23 @@ struct NodeObj {
     theTerm()->enableTD();
   }
 
+  void perfLocalSend3D(MyMsg* in_msg) {
+    theTerm()->disableTD();
+
+    auto const num_local = local_idxs_3d.size();
+    auto const name = fmt::format("colSend3D {}", num_iters);
+    test_obj_->StartTimer(name);
+    for (int i = 0; i < num_iters; i++) {
+      auto m = makeMessage<TestCol3D::ColMsg>();
+      auto const& idx = local_idxs_3d[i % num_local];
+      col_proxy_3d[idx].template sendMsg<&TestCol3D::han>(m);
+      vt::theSched()->runSchedulerOnceImpl();
+    }
+    test_obj_->StopTimer(name);
+
+    theTerm()->enableTD();
+  }
+
   void perfRunBenchmark() {
     for (int i = 0; i < num_iters; i++) {
       auto m = preallocate_ ? msgs[i] : makeMessage<TestCol::ColMsg>();
@@ -115,6 +162,7 @@ private:
   MyTest* test_obj_ = nullptr;
   vt::objgroup::proxy::Proxy<NodeObj> proxy_ = {};
   vt::CollectionProxy<TestCol> col_proxy;
+  vt::CollectionProxy<TestCol3D> col_proxy_3d;
   bool preallocate_ = false;
 };
 
@@ -142,4 +190,28 @@ VT_PERF_TEST(MyTest, test_collection_local_send_preallocate) {
   }
 }
 
+VT_PERF_TEST(MyTest, test_collection_local_send_3d_dense) {
+  auto grp_proxy = vt::theObjGroup()->makeCollective<NodeObj>(
+    "test_collection_local_send_3d_dense", this
+  );
+
+  grp_proxy[my_node_].invoke<&NodeObj::initialize3D>(true);
+
+  if (theContext()->getNode() == 0) {
+    grp_proxy[my_node_].send<MyMsg, &NodeObj::perfLocalSend3D>();
+  }
+}
+
+VT_PERF_TEST(MyTest, test_collection_local_send_3d_hash) {
+  auto grp_proxy = vt::theObjGroup()->makeCollective<NodeObj>(
+    "test_collection_local_send_3d_hash", this
+  );
+
+  grp_proxy[my_node_].invoke<&NodeObj::initialize3D>(false);
+
+  if (theContext()->getNode() == 0) {
+    grp_proxy[my_node_].send<MyMsg, &NodeObj::perfLocalSend3D>();
+  }
+}
+
 VT_PERF_TEST_MAIN()
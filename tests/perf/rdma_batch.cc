@@ -0,0 +1,145 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                rdma_batch.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+#include "common/test_harness.h"
+#include <vt/transport.h>
+
+#include INCLUDE_FMT_CORE
+
+#include <vector>
+
+using namespace vt;
+using namespace vt::tests::perf::common;
+
+static constexpr std::size_t const handle_size = 1024;
+static constexpr int const num_ops = 100000;
+
+struct MyTest : PerfTestHarness {
+  MyTest() { DisableGlobalTimer(); }
+};
+
+struct NodeObj { };
+
+struct RDMAState {
+  explicit RDMAState(std::string const& name)
+    : proxy_(vt::theObjGroup()->makeCollective<NodeObj>(name)),
+      handle_(proxy_.makeHandleRDMA<int>(handle_size, true))
+  {
+    vt::theSched()->runSchedulerWhile([this]{ return not handle_.ready(); });
+    vt::theCollective()->barrier();
+
+    auto const this_node = theContext()->getNode();
+    auto const num_nodes = theContext()->getNumNodes();
+    next_ = this_node + 1 < num_nodes ? this_node + 1 : 0;
+    buf_.resize(handle_size);
+  }
+
+  ~RDMAState() {
+    vt::theCollective()->barrier();
+    proxy_.destroyHandleRDMA(handle_);
+  }
+
+  vt::objgroup::proxy::Proxy<NodeObj> proxy_;
+  vt::HandleRDMA<int> handle_;
+  vt::NodeType next_ = uninitialized_destination;
+  std::vector<int> buf_;
+};
+
+VT_PERF_TEST(MyTest, test_rdma_get_per_op) {
+  RDMAState state{"test_rdma_get_per_op"};
+
+  // Every get opens and closes its own lock on the target
+  StartTimer(fmt::format("{} gets per-op", num_ops));
+  for (int i = 0; i < num_ops; i++) {
+    auto const off = static_cast<int>(i % handle_size);
+    state.handle_.get(
+      state.next_, &state.buf_[off], 1, off, vt::Lock::Shared
+    );
+  }
+  StopTimer(fmt::format("{} gets per-op", num_ops));
+}
+
+VT_PERF_TEST(MyTest, test_rdma_get_batched) {
+  RDMAState state{"test_rdma_get_batched"};
+
+  // One lock_all epoch and one flush for all the gets
+  StartTimer(fmt::format("{} gets batched", num_ops));
+  {
+    auto batch = state.handle_.makeBatch();
+    for (int i = 0; i < num_ops; i++) {
+      auto const off = static_cast<int>(i % handle_size);
+      batch.get(state.next_, &state.buf_[off], 1, off);
+    }
+    batch.end();
+  }
+  StopTimer(fmt::format("{} gets batched", num_ops));
+}
+
+VT_PERF_TEST(MyTest, test_rdma_put_per_op) {
+  RDMAState state{"test_rdma_put_per_op"};
+
+  StartTimer(fmt::format("{} puts per-op", num_ops));
+  for (int i = 0; i < num_ops; i++) {
+    auto const off = static_cast<int>(i % handle_size);
+    state.handle_.put(
+      state.next_, &state.buf_[off], 1, off, vt::Lock::Shared
+    );
+  }
+  StopTimer(fmt::format("{} puts per-op", num_ops));
+}
+
+VT_PERF_TEST(MyTest, test_rdma_put_batched) {
+  RDMAState state{"test_rdma_put_batched"};
+
+  StartTimer(fmt::format("{} puts batched", num_ops));
+  {
+    auto batch = state.handle_.makeBatch();
+    for (int i = 0; i < num_ops; i++) {
+      auto const off = static_cast<int>(i % handle_size);
+      batch.put(state.next_, &state.buf_[off], 1, off);
+    }
+    batch.end();
+  }
+  StopTimer(fmt::format("{} puts batched", num_ops));
+}
+
+VT_PERF_TEST_MAIN()
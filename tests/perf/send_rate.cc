@@ -0,0 +1,112 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                 send_rate.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include "common/test_harness.h"
+#include <vt/collective/collective_ops.h>
+#include <vt/messaging/active.h>
+#include <vt/event/event.h>
+
+#include INCLUDE_FMT_CORE
+
+#include <vector>
+
+using namespace vt;
+using namespace vt::tests::perf::common;
+
+static constexpr int num_sends = 100000;
+static constexpr int num_events = 100000;
+
+static int num_recv = 0;
+
+struct SendRateTest : PerfTestHarness {
+  SendRateTest() { DisableGlobalTimer(); }
+};
+
+void recvHandler(int) {
+  num_recv++;
+}
+
+// Per-send cost of small active messages: each send creates, and later
+// retires, an MPI event in the event table
+VT_PERF_TEST(SendRateTest, test_send_rate) {
+  auto const this_node = theContext()->getNode();
+  auto const next_node = (this_node + 1) % num_nodes_;
+
+  num_recv = 0;
+  theCollective()->barrier();
+
+  StartTimer(fmt::format("send {}", num_sends));
+  for (int i = 0; i < num_sends; i++) {
+    theMsg()->send<recvHandler>(vt::Node{next_node}, i);
+  }
+  StopTimer(fmt::format("send {}", num_sends));
+
+  theSched()->runSchedulerWhile([]{ return num_recv < num_sends; });
+  theCollective()->barrier();
+}
+
+// The event table by itself: create, look up and remove events
+VT_PERF_TEST(SendRateTest, test_event_table) {
+  auto const this_node = theContext()->getNode();
+  std::vector<EventType> events(num_events);
+
+  StartTimer(fmt::format("create {}", num_events));
+  for (int i = 0; i < num_events; i++) {
+    events[i] = theEvent()->createNormalEvent(this_node);
+  }
+  StopTimer(fmt::format("create {}", num_events));
+
+  StartTimer(fmt::format("lookup {}", num_events));
+  for (int i = 0; i < num_events; i++) {
+    theEvent()->getEventHolder(events[i]).attachAction([]{});
+  }
+  StopTimer(fmt::format("lookup {}", num_events));
+
+  StartTimer(fmt::format("remove {}", num_events));
+  for (int i = 0; i < num_events; i++) {
+    theEvent()->getEventHolder(events[i]).makeReadyTrigger();
+  }
+  StopTimer(fmt::format("remove {}", num_events));
+}
+
+VT_PERF_TEST_MAIN()
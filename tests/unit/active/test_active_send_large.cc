@@ -102,16 +102,40 @@ void myHandler(MsgT* m) {
   m->cb_.send(msg.get());
 }
 
+// Above --vt_max_mpi_send_size (16 KiB): rendezvous, pipelined in chunks
+// capped at the maximum send size
+struct PipelinedPath {
+  static constexpr char const* max_send = "--vt_max_mpi_send_size=16384";
+  static constexpr char const* rndv = "--vt_rndv_threshold=65536";
+};
+
+// Above --vt_rndv_threshold but below the maximum send size: rendezvous, in
+// chunks of --vt_rndv_chunk_size
+struct ThresholdPath {
+  static constexpr char const* max_send = "--vt_max_mpi_send_size=1073741824";
+  static constexpr char const* rndv = "--vt_rndv_chunk_size=65536";
+};
+
+// A chunk size of zero: no rendezvous, sent unpipelined in pieces of the
+// maximum send size right behind the control message
+struct UnpipelinedPath {
+  static constexpr char const* max_send = "--vt_max_mpi_send_size=16384";
+  static constexpr char const* rndv = "--vt_rndv_chunk_size=0";
+};
+
 template <typename T>
 struct TestActiveSendLarge : TestParallelHarness {
-  // Set max size to 16 KiB for testing
+  using PathType = typename std::tuple_element<2,T>::type;
+
   void addAdditionalArgs() override {
-    new_arg = fmt::format("--vt_max_mpi_send_size=16384");
-    addArgs(new_arg);
+    max_send_arg = PathType::max_send;
+    rndv_arg = PathType::rndv;
+    addArgs(max_send_arg, rndv_arg);
   }
 
 private:
-  std::string new_arg;
+  std::string max_send_arg;
+  std::string rndv_arg;
 };
 
 TYPED_TEST_SUITE_P(TestActiveSendLarge);
@@ -149,15 +173,21 @@ TYPED_TEST_P(TestActiveSendLarge, test_large_bytes_msg) {
 REGISTER_TYPED_TEST_SUITE_P(TestActiveSendLarge, test_large_bytes_msg);
 
 using NonSerTestTypes = testing::Types<
-  std::tuple<std::integral_constant<NumBytesType, 20>, NonSerializedTag>,
-  std::tuple<std::integral_constant<NumBytesType, 21>, NonSerializedTag>
-  // std::tuple<std::integral_constant<NumBytesType, 32>, NonSerializedTag>
+  std::tuple<std::integral_constant<NumBytesType, 20>, NonSerializedTag, PipelinedPath>,
+  std::tuple<std::integral_constant<NumBytesType, 21>, NonSerializedTag, PipelinedPath>,
+  std::tuple<std::integral_constant<NumBytesType, 20>, NonSerializedTag, ThresholdPath>,
+  std::tuple<std::integral_constant<NumBytesType, 20>, NonSerializedTag, UnpipelinedPath>,
+  std::tuple<std::integral_constant<NumBytesType, 21>, NonSerializedTag, UnpipelinedPath>
+  // std::tuple<std::integral_constant<NumBytesType, 32>, NonSerializedTag, PipelinedPath>
 >;
 
 using SerTestTypes = testing::Types<
-  std::tuple<std::integral_constant<NumBytesType, 20>, SerializedTag>,
-  std::tuple<std::integral_constant<NumBytesType, 21>, SerializedTag>
-  // std::tuple<std::integral_constant<NumBytesType, 32>, SerializedTag>
+  std::tuple<std::integral_constant<NumBytesType, 20>, SerializedTag, PipelinedPath>,
+  std::tuple<std::integral_constant<NumBytesType, 21>, SerializedTag, PipelinedPath>,
+  std::tuple<std::integral_constant<NumBytesType, 20>, SerializedTag, ThresholdPath>,
+  std::tuple<std::integral_constant<NumBytesType, 20>, SerializedTag, UnpipelinedPath>,
+  std::tuple<std::integral_constant<NumBytesType, 21>, SerializedTag, UnpipelinedPath>
+  // std::tuple<std::integral_constant<NumBytesType, 32>, SerializedTag, PipelinedPath>
 >;
 
 INSTANTIATE_TYPED_TEST_SUITE_P(
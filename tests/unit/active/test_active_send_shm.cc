@@ -0,0 +1,114 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                           test_active_send_shm.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <gtest/gtest.h>
+
+#include "vt/messaging/active.h"
+#include "test_parallel_harness.h"
+#include "test_helpers.h"
+
+#include <numeric>
+#include <vector>
+
+namespace vt { namespace tests { namespace unit { namespace send_shm {
+
+static int num_recv = 0;
+static int64_t recv_sum = 0;
+static int last_small = -1;
+
+struct TestActiveSendShm : TestParallelHarness {
+  void SetUp() override {
+    TestParallelHarness::SetUp();
+    num_recv = 0;
+    recv_sum = 0;
+    last_small = -1;
+  }
+
+  void addAdditionalArgs() override {
+    // A small ring so sends wrap around it and are held while it is full
+    static char vt_shm_am[]{"--vt_shm_am"};
+    static char vt_shm_am_ring_size[]{"--vt_shm_am_ring_size=256"};
+    addArgs(vt_shm_am, vt_shm_am_ring_size);
+  }
+};
+
+void shmSmallHandler(int value) {
+  // All come from the same sender, so they must arrive in send order even
+  // when some had to wait for room in the ring
+  EXPECT_EQ(value, last_small + 1);
+  last_small = value;
+  num_recv++;
+  recv_sum += value;
+}
+
+void shmLargeHandler(std::vector<int> values) {
+  num_recv++;
+  recv_sum += std::accumulate(values.begin(), values.end(), int64_t{0});
+}
+
+TEST_F(TestActiveSendShm, test_active_send_shm_small_and_large) {
+  SET_MIN_NUM_NODES_CONSTRAINT(2);
+
+  auto const this_node = theContext()->getNode();
+  auto const num_nodes = theContext()->getNumNodes();
+  NodeType const next_node = (this_node + 1) % num_nodes;
+
+  int const num_small = 500;
+  std::vector<int> large(1000, 1);
+
+  vt::runInEpochCollective([&]{
+    for (int i = 0; i < num_small; i++) {
+      theMsg()->send<shmSmallHandler>(vt::Node{next_node}, i);
+    }
+    // Larger than the ring, so it always goes through MPI
+    theMsg()->send<shmLargeHandler>(vt::Node{next_node}, large);
+  });
+
+  EXPECT_EQ(num_recv, num_small + 1);
+  EXPECT_EQ(last_small, num_small - 1);
+  EXPECT_EQ(
+    recv_sum, int64_t{num_small} * (num_small - 1) / 2 + int64_t{1000}
+  );
+}
+
+}}}} // end namespace vt::tests::unit::send_shm
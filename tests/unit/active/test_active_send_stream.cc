@@ -0,0 +1,124 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                          test_active_send_stream.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <gtest/gtest.h>
+
+#include "vt/messaging/active.h"
+#include "test_parallel_harness.h"
+#include "test_helpers.h"
+
+#include <vector>
+
+namespace vt { namespace tests { namespace unit { namespace send_stream {
+
+static std::size_t bytes_consumed = 0;
+static int num_bad = 0;
+static bool stream_done = false;
+
+static constexpr std::size_t const stream_bytes = 10 * 1024 + 17;
+
+struct TestActiveSendStream : TestParallelHarness {
+  void SetUp() override {
+    TestParallelHarness::SetUp();
+    bytes_consumed = 0;
+    num_bad = 0;
+    stream_done = false;
+  }
+
+  void addAdditionalArgs() override {
+    // Small chunks so the stream has many of them and the slots are reused
+    static char vt_rndv_chunk_size[]{"--vt_rndv_chunk_size=1024"};
+    static char vt_rndv_max_inflight[]{"--vt_rndv_max_inflight=2"};
+    addArgs(vt_rndv_chunk_size, vt_rndv_max_inflight);
+  }
+};
+
+std::byte valueAt(std::size_t offset) {
+  return static_cast<std::byte>(offset % 251);
+}
+
+void streamHandler(TagType tag, NodeType from, std::size_t total) {
+  theMsg()->recvDataStream(
+    tag, from, total,
+    [](std::size_t offset, std::byte const* data, std::size_t len) {
+      for (std::size_t i = 0; i < len; i++) {
+        if (data[i] != valueAt(offset + i)) {
+          num_bad++;
+        }
+      }
+      bytes_consumed += len;
+    },
+    []{ stream_done = true; }
+  );
+}
+
+TEST_F(TestActiveSendStream, test_active_send_stream_chunks) {
+  SET_MIN_NUM_NODES_CONSTRAINT(2);
+
+  auto const this_node = theContext()->getNode();
+  auto const num_nodes = theContext()->getNumNodes();
+  NodeType const next_node = (this_node + 1) % num_nodes;
+
+  vt::runInEpochCollective([&]{
+    auto info = theMsg()->sendDataStream(
+      next_node, stream_bytes,
+      [](std::size_t offset, std::byte* buf, std::size_t len) {
+        for (std::size_t i = 0; i < len; i++) {
+          buf[i] = valueAt(offset + i);
+        }
+      }
+    );
+    EXPECT_EQ(
+      info.getNumChunks(), static_cast<int>((stream_bytes + 1023) / 1024)
+    );
+    theMsg()->send<streamHandler>(
+      vt::Node{next_node}, info.getTag(), this_node, stream_bytes
+    );
+  });
+
+  EXPECT_TRUE(stream_done);
+  EXPECT_EQ(bytes_consumed, stream_bytes);
+  EXPECT_EQ(num_bad, 0);
+}
+
+}}}} // end namespace vt::tests::unit::send_stream
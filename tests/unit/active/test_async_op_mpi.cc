@@ -50,6 +50,8 @@
 
 #include <gtest/gtest.h>
 
+#include <vector>
+
 
 namespace vt { namespace tests { namespace unit {
 
@@ -118,4 +120,66 @@ TEST_F(TestAsyncOp, test_async_op_1) {
   p[this_node].get()->check();
 }
 
+struct CountdownOp : messaging::AsyncOp {
+  CountdownOp(int in_polls, int* in_done)
+    : polls_(in_polls),
+      done_(in_done)
+  { }
+
+  bool poll() override { return --polls_ <= 0; }
+  void done() override { (*done_)++; }
+
+private:
+  int polls_ = 0;
+  int* done_ = nullptr;
+};
+
+struct TestAsyncOpBudget : TestParallelHarness {
+  void addAdditionalArgs() override {
+    // Deliver one completion and poll one non-MPI op per progress call
+    static char completion_budget[]{"--vt_poll_completion_budget=1"};
+    static char async_budget[]{"--vt_async_op_poll_budget=1"};
+    addArgs(completion_budget, async_budget);
+  }
+};
+
+TEST_F(TestAsyncOpBudget, test_async_op_budget_mixed) {
+  auto const this_node = theContext()->getNode();
+  auto const num_nodes = theContext()->getNumNodes();
+  auto const to_node = (this_node + 1) % num_nodes;
+  auto const from_node = (this_node + num_nodes - 1) % num_nodes;
+  auto comm = theContext()->getComm();
+  int const tag = 299998;
+  int const num_ops = 20;
+
+  std::vector<int> send_vals(num_ops), recv_vals(num_ops, -1);
+  int mpi_done = 0;
+  int polled_done = 0;
+
+  runInEpochCollective([&]{
+    for (int i = 0; i < num_ops; i++) {
+      send_vals[i] = this_node * num_ops + i;
+      MPI_Request sreq, rreq;
+      {
+        VT_ALLOW_MPI_CALLS; // MPI_Isend, MPI_Irecv
+        MPI_Irecv(&recv_vals[i], 1, MPI_INT, from_node, tag, comm, &rreq);
+        MPI_Isend(&send_vals[i], 1, MPI_INT, to_node, tag, comm, &sreq);
+      }
+      theMsg()->registerAsyncOp(std::make_unique<messaging::AsyncOpMPI>(sreq));
+      theMsg()->registerAsyncOp(
+        std::make_unique<messaging::AsyncOpMPI>(rreq, [&]{ mpi_done++; })
+      );
+      theMsg()->registerAsyncOp(
+        std::make_unique<CountdownOp>(i % 3 + 1, &polled_done)
+      );
+    }
+  });
+
+  EXPECT_EQ(mpi_done, num_ops);
+  EXPECT_EQ(polled_done, num_ops);
+  for (int i = 0; i < num_ops; i++) {
+    EXPECT_EQ(recv_vals[i], from_node * num_ops + i);
+  }
+}
+
 }}} // end namespace vt::tests::unit
@@ -0,0 +1,209 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                            test_broadcast_bulk.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <gtest/gtest.h>
+
+#include "test_parallel_harness.h"
+
+#include "vt/vrt/collection/manager.h"
+
+#include <vector>
+
+namespace vt { namespace tests { namespace unit { namespace bcast_bulk {
+
+using namespace vt;
+using namespace vt::tests::unit;
+
+static int num_local = 0;
+static int num_recv = 0;
+
+struct BulkCol : Collection<BulkCol, Index2D> {
+  BulkCol() {
+    num_local++;
+  }
+
+  void payload(std::vector<double> const& data) {
+    // The element context is set for each element in the batch
+    auto ctx_idx = theCollection()->queryIndexContext<Index2D>();
+    ASSERT_NE(ctx_idx, nullptr);
+    EXPECT_EQ(*ctx_idx, getIndex());
+    EXPECT_EQ(data.size(), std::size_t{1024});
+    num_recv++;
+    recv_++;
+  }
+
+  void check(int expected) {
+    EXPECT_EQ(recv_, expected);
+  }
+
+  template <typename SerializerT>
+  void serialize(SerializerT& s) {
+    Collection<BulkCol, Index2D>::serialize(s);
+    s | recv_;
+  }
+
+private:
+  int recv_ = 0;
+};
+
+struct TestBroadcastBulk : TestParallelHarness {
+  virtual void SetUp() override {
+    TestParallelHarness::SetUp();
+    theConfig()->vt_bcast_bulk_local = true;
+    num_local = num_recv = 0;
+  }
+
+  virtual void TearDown() override {
+    theConfig()->vt_bcast_bulk_local = false;
+    TestParallelHarness::TearDown();
+  }
+};
+
+TEST_F(TestBroadcastBulk, test_broadcast_bulk_local_delivery) {
+  auto const this_node = theContext()->getNode();
+  auto const num_nodes = theContext()->getNumNodes();
+
+  int const num_bcasts = 4;
+
+  auto const range = Index2D(static_cast<int>(num_nodes) * 8, 16);
+  auto proxy = makeCollection<BulkCol>("test_broadcast_bulk_local_delivery")
+    .bounds(range)
+    .bulkInsert()
+    .wait();
+
+  std::vector<double> data(1024, 1.0);
+
+  runInEpochCollective([&]{
+    if (this_node == 0) {
+      for (int i = 0; i < num_bcasts; i++) {
+        proxy.broadcast<&BulkCol::payload>(data);
+      }
+    }
+  });
+
+  EXPECT_EQ(num_recv, num_local * num_bcasts);
+
+  runInEpochCollective([&]{
+    if (this_node == 0) {
+      proxy.broadcast<&BulkCol::check>(num_bcasts);
+    }
+  });
+}
+
+static ModifierToken* grow_token = nullptr;
+
+struct GrowCol : Collection<GrowCol, Index1D> {
+  void grow() {
+    // Inserting locally from a handler in the batch changes the holder that
+    // is being walked
+    auto const idx = getIndex().x();
+    if (idx % 2 == 0) {
+      grown_++;
+      getCollectionProxy()[idx + 1].insertAt(
+        *grow_token, theContext()->getNode()
+      );
+    }
+  }
+
+  void check() {
+    if (getIndex().x() % 2 == 0) {
+      EXPECT_EQ(grown_, 1);
+    }
+  }
+
+  template <typename SerializerT>
+  void serialize(SerializerT& s) {
+    Collection<GrowCol, Index1D>::serialize(s);
+    s | grown_;
+  }
+
+private:
+  int grown_ = 0;
+};
+
+TEST_F(TestBroadcastBulk, test_broadcast_bulk_handler_inserts) {
+  auto const this_node = theContext()->getNode();
+  auto const num_nodes = theContext()->getNumNodes();
+
+  auto const range = Index1D(static_cast<int>(num_nodes) * 128);
+  auto proxy = makeCollection<GrowCol>("test_broadcast_bulk_handler_inserts")
+    .collective(true)
+    .dynamicMembership(true)
+    .bounds(range)
+    .wait();
+
+  {
+    auto token = proxy.beginModification();
+    if (this_node == 0) {
+      for (int i = 0; i < range.x(); i += 2) {
+        proxy[i].insert(token);
+      }
+    }
+    proxy.finishModification(std::move(token));
+  }
+
+  auto const num_before = theCollection()->getLocalIndices(proxy).size();
+
+  {
+    auto token = proxy.beginModification();
+    grow_token = &token;
+    runInEpochCollective([&]{
+      if (this_node == 0) {
+        proxy.broadcast<&GrowCol::grow>();
+      }
+    });
+    grow_token = nullptr;
+    proxy.finishModification(std::move(token));
+  }
+
+  // Every element inserted its odd neighbor on this node
+  EXPECT_EQ(theCollection()->getLocalIndices(proxy).size(), num_before * 2);
+
+  runInEpochCollective([&]{
+    if (this_node == 0) {
+      proxy.broadcast<&GrowCol::check>();
+    }
+  });
+}
+
+}}}} // end namespace vt::tests::unit::bcast_bulk
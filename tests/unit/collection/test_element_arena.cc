@@ -0,0 +1,199 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                            test_element_arena.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <gtest/gtest.h>
+
+#include "test_parallel_harness.h"
+
+#include "vt/vrt/collection/manager.h"
+
+#include <vector>
+
+namespace vt { namespace tests { namespace unit { namespace arena {
+
+using namespace vt;
+using namespace vt::tests::unit;
+
+static std::vector<void*> constructed;
+
+struct ArenaCol : Collection<ArenaCol, Index1D> {
+  static constexpr bool vt_arena_allocate = true;
+
+  ArenaCol() {
+    constructed.push_back(this);
+  }
+
+  void work() {
+    EXPECT_TRUE(vrt::collection::ElementArena::get<ArenaCol>().owns(this));
+  }
+};
+
+struct HeapCol : Collection<HeapCol, Index1D> { };
+
+struct MigrateArenaCol : Collection<MigrateArenaCol, Index1D> {
+  static constexpr bool vt_arena_allocate = true;
+
+  void migrateNext() {
+    auto const num_nodes = theContext()->getNumNodes();
+    from_ = theContext()->getNode();
+    migrate((from_ + 1) % num_nodes);
+  }
+
+  void checkOwned() {
+    using vrt::collection::ElementArena;
+    EXPECT_NE(from_, theContext()->getNode());
+    EXPECT_TRUE(ElementArena::get<MigrateArenaCol>().owns(this));
+  }
+
+  template <typename SerializerT>
+  void serialize(SerializerT& s) {
+    Collection<MigrateArenaCol, Index1D>::serialize(s);
+    s | from_;
+  }
+
+private:
+  NodeType from_ = uninitialized_destination;
+};
+
+struct TestElementArena : TestParallelHarness {
+  virtual void SetUp() override {
+    TestParallelHarness::SetUp();
+    constructed.clear();
+  }
+};
+
+static constexpr int32_t const num_elms_per_node = 100;
+
+TEST_F(TestElementArena, test_element_arena_contiguous) {
+  using vrt::collection::ElementArena;
+
+  auto const this_node = theContext()->getNode();
+  auto const num_nodes = theContext()->getNumNodes();
+
+  auto const range = Index1D(num_nodes * num_elms_per_node);
+  auto proxy = makeCollection<ArenaCol>("test_element_arena_contiguous")
+    .bounds(range)
+    .bulkInsert()
+    .wait();
+
+  auto& arena = ElementArena::get<ArenaCol>();
+  EXPECT_EQ(arena.getNumLive(), constructed.size());
+
+  // Elements constructed in order are adjacent in the slab
+  auto const slot_size = sizeof(ArenaCol);
+  for (std::size_t i = 1; i < constructed.size(); i++) {
+    EXPECT_TRUE(arena.owns(constructed[i]));
+    if (i % arena.getSlabElms() != 0) {
+      EXPECT_EQ(
+        static_cast<char*>(constructed[i]) -
+        static_cast<char*>(constructed[i - 1]),
+        static_cast<std::ptrdiff_t>(slot_size)
+      );
+    }
+  }
+
+  runInEpochCollective([&]{
+    if (this_node == 0) {
+      proxy.broadcast<&ArenaCol::work>();
+    }
+  });
+
+  runInEpochCollective([&]{
+    if (this_node == 0) {
+      proxy.destroy();
+    }
+  });
+
+  EXPECT_EQ(arena.getNumLive(), std::size_t{0});
+  EXPECT_EQ(arena.getNumSlabs(), std::size_t{0});
+}
+
+TEST_F(TestElementArena, test_element_arena_migrate_in) {
+  using vrt::collection::ElementArena;
+
+  SET_MIN_NUM_NODES_CONSTRAINT(2);
+
+  auto const this_node = theContext()->getNode();
+  auto const num_nodes = theContext()->getNumNodes();
+
+  auto const range = Index1D(num_nodes * num_elms_per_node);
+  auto proxy = makeCollection<MigrateArenaCol>("test_element_arena_migrate_in")
+    .bounds(range)
+    .bulkInsert()
+    .wait();
+
+  runInEpochCollective([&]{
+    if (this_node == 0) {
+      proxy.broadcast<&MigrateArenaCol::migrateNext>();
+    }
+  });
+
+  // Every local element migrated in, and its storage came from the arena
+  auto& arena = ElementArena::get<MigrateArenaCol>();
+  EXPECT_EQ(
+    arena.getNumLive(), theCollection()->getLocalIndices(proxy).size()
+  );
+
+  runInEpochCollective([&]{
+    if (this_node == 0) {
+      proxy.broadcast<&MigrateArenaCol::checkOwned>();
+    }
+  });
+
+  runInEpochCollective([&]{
+    if (this_node == 0) {
+      proxy.destroy();
+    }
+  });
+
+  EXPECT_EQ(arena.getNumLive(), std::size_t{0});
+}
+
+TEST_F(TestElementArena, test_element_arena_not_opted_in) {
+  using vrt::collection::UseElementArena;
+
+  EXPECT_TRUE(UseElementArena<ArenaCol>::value);
+  EXPECT_FALSE(UseElementArena<HeapCol>::value);
+}
+
+}}}} // end namespace vt::tests::unit::arena
@@ -58,6 +58,7 @@
 #include "vt/vrt/collection/balance/temperedwmin/temperedwmin.h"
 #include "vt/utils/json/json_reader.h"
 #include "vt/utils/json/json_appender.h"
+#include "vt/timing/timing.h"
 #include "vt/utils/file_spec/spec.h"
 
 #include <nlohmann/json.hpp>
@@ -264,7 +265,8 @@ auto balancers_other = ::testing::Values(
   "RotateLB",
   "HierarchicalLB",
   "TemperedLB",
-  "TemperedWMin"
+  "TemperedWMin",
+  "GraphPartLB"
 #   if vt_check_enabled(zoltan)
   , "ZoltanLB"
 #   endif
@@ -273,7 +275,8 @@ auto balancers_other = ::testing::Values(
 auto balancers_greedy = ::testing::Values(
     "GreedyLB:strategy=scatter",
     "GreedyLB:strategy=pt2pt",
-    "GreedyLB:strategy=bcast"
+    "GreedyLB:strategy=bcast",
+    "GreedyLB:group_size=2"
 );
 
 INSTANTIATE_TEST_SUITE_P(
@@ -284,6 +287,407 @@ INSTANTIATE_TEST_SUITE_P(
   LoadBalancerExplodeGreedy, TestLoadBalancerGreedy, balancers_greedy
 );
 
+struct TestLoadBalancerMemoryCapacity : TestParallelHarnessParam<std::string> { };
+
+TEST_P(TestLoadBalancerMemoryCapacity, test_load_balancer_memory_capacity) {
+  vt::theConfig()->vt_lb = true;
+  vt::theConfig()->vt_lb_name = GetParam();
+  // No rank can take on any object, so every transfer must be rejected
+  vt::theConfig()->vt_lb_memory_capacity = 1;
+
+  vt::theCollective()->barrier();
+
+  auto range = vt::Index1D(num_elms);
+
+  vt::vrt::collection::CollectionProxy<MyCol> proxy;
+
+  runInEpochCollective([&]{
+    proxy = vt::theCollection()->constructCollective<MyCol>(
+      range, "test_load_balancer_memory_capacity"
+    );
+  });
+
+  for (int phase = 0; phase < num_phases; phase++) {
+    runInEpochCollective([&]{
+      proxy.broadcastCollective<colHandler>();
+    });
+
+    vt::thePhase()->nextPhaseCollective();
+
+    auto phase_info = vt::theLBManager()->getPhaseInfo();
+    EXPECT_EQ(phase_info->migration_count, 0);
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  LoadBalancerExplodeMemoryCapacity, TestLoadBalancerMemoryCapacity,
+  ::testing::Values("RandomLB", "RotateLB", "HierarchicalLB", "GreedyLB")
+);
+
+/// Footprint of every element: large enough that the rank baseline is noise
+static constexpr double const footprint_bytes = 1e12;
+
+void footprintHandler(MyCol* col) {
+  col->valInsert(
+    vt::vrt::collection::balance::footprint_bytes_key, footprint_bytes,
+    false, true, false
+  );
+  colHandler(col);
+}
+
+struct TestLoadBalancerMemoryCapacityPartial : TestParallelHarness { };
+
+TEST_F(
+  TestLoadBalancerMemoryCapacityPartial,
+  test_load_balancer_memory_capacity_admits_some
+) {
+  SET_MIN_NUM_NODES_CONSTRAINT(2);
+
+  auto const num_nodes = vt::theContext()->getNumNodes();
+  int const per_rank = 4;
+
+  // RotateLB moves every element one rank over. With room for one more
+  // element than it holds, each rank admits exactly one arrival and rejects
+  // the rest, even as the elements it holds move away
+  vt::theConfig()->vt_lb = true;
+  vt::theConfig()->vt_lb_name = "RotateLB";
+  vt::theConfig()->vt_lb_memory_capacity = static_cast<std::size_t>(
+    (per_rank + 1.5) * footprint_bytes
+  );
+
+  vt::theCollective()->barrier();
+
+  auto range = vt::Index1D(static_cast<int>(num_nodes * per_rank));
+
+  vt::vrt::collection::CollectionProxy<MyCol> proxy;
+
+  runInEpochCollective([&]{
+    proxy = vt::theCollection()->constructCollective<MyCol>(
+      range, "test_load_balancer_memory_capacity_admits_some"
+    );
+  });
+
+  int lb_phases = 0;
+  for (int phase = 0; phase < num_phases; phase++) {
+    runInEpochCollective([&]{
+      proxy.broadcastCollective<footprintHandler>();
+    });
+
+    vt::thePhase()->nextPhaseCollective();
+
+    auto phase_info = vt::theLBManager()->getPhaseInfo();
+    if (phase_info->ran_lb) {
+      lb_phases++;
+      EXPECT_EQ(phase_info->migration_count, num_nodes);
+      EXPECT_EQ(phase_info->rejected_count, num_nodes * (per_rank - 1));
+    }
+
+    auto const local = vt::theCollection()->getLocalIndices(proxy).size();
+    EXPECT_EQ(local, static_cast<std::size_t>(per_rank));
+  }
+  EXPECT_GT(lb_phases, 0);
+}
+
+struct TestLoadBalancerGreedyHierarchical : TestParallelHarness { };
+
+TEST_F(
+  TestLoadBalancerGreedyHierarchical,
+  test_load_balancer_greedy_hierarchical_near_single_root
+) {
+  SET_MIN_NUM_NODES_CONSTRAINT(2);
+
+  vt::theConfig()->vt_lb = true;
+  vt::theConfig()->vt_lb_name = "GreedyLB";
+  vt::theConfig()->vt_lb_args = "group_size=2 compare=true";
+
+  vt::theCollective()->barrier();
+
+  auto range = vt::Index1D(num_elms);
+
+  vt::vrt::collection::CollectionProxy<MyCol> proxy;
+
+  runInEpochCollective([&]{
+    proxy = vt::theCollection()->constructCollective<MyCol>(
+      range, "test_load_balancer_greedy_hierarchical_near_single_root"
+    );
+  });
+
+  int compared = 0;
+  for (int phase = 0; phase < num_phases; phase++) {
+    runInEpochCollective([&]{
+      proxy.broadcastCollective<colHandler>();
+    });
+
+    vt::thePhase()->nextPhaseCollective();
+
+    // GreedyLB reports nothing when it skips rebalancing
+    auto const& stats = vt::theLBManager()->getPhaseInfo()->strategy_stats;
+    if (stats.find("hierarchical imbalance") == stats.end()) {
+      continue;
+    }
+    compared++;
+
+    ASSERT_EQ(stats.count("single-root imbalance"), 1u);
+    auto const hier = stats.at("hierarchical imbalance");
+    auto const root = stats.at("single-root imbalance");
+    if (vt::theContext()->getNode() == 0) {
+      fmt::print(
+        "phase={}: hierarchical I={:.3f} in {:.6f}s, "
+        "single-root I={:.3f} in {:.6f}s\n",
+        phase, hier, stats.at("hierarchical time"), root,
+        stats.at("single-root time")
+      );
+    }
+
+    // The groups only exchange aggregate loads, so their predicted max load
+    // may be worse than the single root's, but not by half again
+    EXPECT_LE(1.0 + hier, 1.5 * (1.0 + root));
+  }
+  EXPECT_GT(compared, 0);
+}
+
+static constexpr int const pair_elms_per_rank = 8;
+static constexpr std::size_t const pair_msg_len = 1 << 14;
+
+// Bytes this rank received from elements on other ranks
+static double cross_rank_bytes = 0.0;
+
+struct PairCol : vt::Collection<PairCol,vt::Index1D> {
+  // Every element does the same work and sends a large message to the element
+  // half the range away, which starts out on another rank. One way, only the
+  // lower half of the range sends
+  void exchange(int num, bool one_way) {
+    auto const partner = (getIndex().x() + num / 2) % num;
+    if (not one_way or getIndex().x() < num / 2) {
+      getCollectionProxy()[partner].send<&PairCol::recv>(
+        theContext()->getNode(), std::vector<double>(pair_msg_len, 1.0)
+      );
+    }
+    for (int i = 0; i < 10000; i++) {
+      val += i * 0.5;
+    }
+  }
+
+  void recv(NodeType from, std::vector<double> const& data) {
+    if (from != theContext()->getNode()) {
+      cross_rank_bytes += data.size() * sizeof(double);
+    }
+  }
+
+  template <typename SerializerT>
+  void serialize(SerializerT& s) {
+    vt::Collection<PairCol,vt::Index1D>::serialize(s);
+    s | val;
+  }
+
+  double val = 0.0;
+};
+
+double runPairExchange(
+  std::string const& lb_name, std::string const& lb_args,
+  std::string const& label, bool one_way, double& lb_time
+) {
+  vt::theConfig()->vt_lb = true;
+  vt::theConfig()->vt_lb_name = lb_name;
+  vt::theConfig()->vt_lb_args = lb_args;
+
+  vt::theCollective()->barrier();
+
+  auto const num = static_cast<int>(vt::theContext()->getNumNodes()) *
+    pair_elms_per_rank;
+
+  vt::vrt::collection::CollectionProxy<PairCol> proxy;
+
+  runInEpochCollective([&]{
+    proxy = vt::theCollection()->constructCollective<PairCol>(
+      vt::Index1D(num), label
+    );
+  });
+
+  lb_time = 0.0;
+  for (int phase = 0; phase < num_phases; phase++) {
+    runInEpochCollective([&]{
+      proxy.broadcastCollective<&PairCol::exchange>(num, one_way);
+    });
+
+    auto const start_time = vt::timing::getCurrentTime();
+    vt::thePhase()->nextPhaseCollective();
+    if (vt::theLBManager()->getPhaseInfo()->ran_lb) {
+      lb_time += (vt::timing::getCurrentTime() - start_time).seconds();
+    }
+  }
+
+  // Measure the edge cut of the final placement
+  cross_rank_bytes = 0.0;
+  runInEpochCollective([&]{
+    proxy.broadcastCollective<&PairCol::exchange>(num, one_way);
+  });
+
+  double cut = 0.0;
+  runInEpochCollective([&]{
+    theCollective()->makeCollectiveScope().mpiCollectiveAsync([&cut]{
+      MPI_Allreduce(
+        &cross_rank_bytes, &cut, 1, MPI_DOUBLE, MPI_SUM,
+        theContext()->getComm()
+      );
+    });
+  });
+
+  runInEpochCollective([&]{
+    if (vt::theContext()->getNode() == 0) {
+      proxy.destroy();
+    }
+  });
+
+  return cut;
+}
+
+struct TestLoadBalancerCommPlacement : TestParallelHarness { };
+
+TEST_F(
+  TestLoadBalancerCommPlacement,
+  test_load_balancer_graphpart_cut_vs_temperedwmin
+) {
+  SET_MIN_NUM_NODES_CONSTRAINT(2);
+
+  double graph_time = 0.0, tempered_time = 0.0;
+  auto const graph_cut = runPairExchange(
+    "GraphPartLB", "clusters_per_rank=2",
+    "test_load_balancer_graphpart_cut_vs_temperedwmin_graphpart", false,
+    graph_time
+  );
+  auto const tempered_cut = runPairExchange(
+    "TemperedWMin", "ordering=Arbitrary rollback=false",
+    "test_load_balancer_graphpart_cut_vs_temperedwmin_tempered", false,
+    tempered_time
+  );
+
+  if (vt::theContext()->getNode() == 0) {
+    fmt::print(
+      "GraphPartLB: cut={} bytes, LB time={:.6f}s; "
+      "TemperedWMin: cut={} bytes, LB time={:.6f}s\n",
+      graph_cut, graph_time, tempered_cut, tempered_time
+    );
+  }
+
+  EXPECT_LE(graph_cut, tempered_cut);
+}
+
+TEST_F(
+  TestLoadBalancerCommPlacement,
+  test_load_balancer_graphpart_cut_one_way
+) {
+  SET_MIN_NUM_NODES_CONSTRAINT(2);
+
+  // Only the receiving rank records a message, so the sending rank must
+  // still see the edge to place the pair together
+  double graph_time = 0.0;
+  auto const graph_cut = runPairExchange(
+    "GraphPartLB", "clusters_per_rank=2",
+    "test_load_balancer_graphpart_cut_one_way", true, graph_time
+  );
+
+  auto const num = static_cast<int>(vt::theContext()->getNumNodes()) *
+    pair_elms_per_rank;
+  auto const initial_cut = static_cast<double>(num / 2) *
+    pair_msg_len * sizeof(double);
+
+  if (vt::theContext()->getNode() == 0) {
+    fmt::print(
+      "GraphPartLB one way: cut={} bytes (initially {}), LB time={:.6f}s\n",
+      graph_cut, initial_cut, graph_time
+    );
+  }
+
+  EXPECT_LT(graph_cut, initial_cut);
+}
+
+struct TestLoadBalancerImbalanceThreshold : TestParallelHarnessParam<std::string> { };
+
+TEST_P(TestLoadBalancerImbalanceThreshold, test_load_balancer_imbalance_threshold) {
+  vt::theConfig()->vt_lb = true;
+  vt::theConfig()->vt_lb_name = GetParam();
+  // No imbalance reaches this, so the strategy must never run
+  vt::theConfig()->vt_lb_imbalance_threshold = 1e9;
+  vt::theConfig()->vt_lb_incremental = true;
+
+  vt::theCollective()->barrier();
+
+  auto range = vt::Index1D(num_elms);
+
+  vt::vrt::collection::CollectionProxy<MyCol> proxy;
+
+  runInEpochCollective([&]{
+    proxy = vt::theCollection()->constructCollective<MyCol>(
+      range, "test_load_balancer_imbalance_threshold"
+    );
+  });
+
+  for (int phase = 0; phase < num_phases; phase++) {
+    runInEpochCollective([&]{
+      proxy.broadcastCollective<colHandler>();
+    });
+
+    vt::thePhase()->nextPhaseCollective();
+
+    auto phase_info = vt::theLBManager()->getPhaseInfo();
+    EXPECT_FALSE(phase_info->ran_lb);
+    EXPECT_EQ(phase_info->migration_count, 0);
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  LoadBalancerExplodeImbalanceThreshold, TestLoadBalancerImbalanceThreshold,
+  ::testing::Values("RandomLB", "RotateLB", "GreedyLB")
+);
+
+struct TestLoadBalancerIncremental : TestParallelHarness { };
+
+TEST_F(TestLoadBalancerIncremental, test_load_balancer_incremental) {
+  SET_MIN_NUM_NODES_CONSTRAINT(2);
+
+  // The strategy is replaced by the local rebalancing, so even RotateLB must
+  // not move every object
+  vt::theConfig()->vt_lb = true;
+  vt::theConfig()->vt_lb_name = "RotateLB";
+  vt::theConfig()->vt_lb_imbalance_threshold = 0.1;
+  vt::theConfig()->vt_lb_incremental = true;
+
+  vt::theCollective()->barrier();
+
+  auto range = vt::Index1D(num_elms);
+
+  vt::vrt::collection::CollectionProxy<MyCol> proxy;
+
+  runInEpochCollective([&]{
+    proxy = vt::theCollection()->constructCollective<MyCol>(
+      range, "test_load_balancer_incremental"
+    );
+  });
+
+  int32_t total_migrations = 0;
+  for (int phase = 0; phase < num_phases; phase++) {
+    runInEpochCollective([&]{
+      proxy.broadcastCollective<colHandler>();
+    });
+
+    vt::thePhase()->nextPhaseCollective();
+
+    auto phase_info = vt::theLBManager()->getPhaseInfo();
+    if (phase_info->ran_lb) {
+      // Objects only go to ranks below the average, up to the average
+      EXPECT_LE(
+        phase_info->max_load_post_lb, phase_info->max_load * (1.0 + 1e-9)
+      );
+      EXPECT_LT(phase_info->migration_count, num_elms);
+      total_migrations += phase_info->migration_count;
+    }
+  }
+
+  // The work grows with the index, so the last rank starts overloaded
+  EXPECT_GT(total_migrations, 0);
+}
+
 struct TestParallelHarnessWithLBDataDumping : TestParallelHarnessParam<int> {
   virtual void addAdditionalArgs() override {
     static char vt_lb_data[]{"--vt_lb_data"};
@@ -0,0 +1,170 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                    test_model_topology_comm_cost.nompi.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <vt/vrt/collection/balance/model/load_model.h>
+#include <vt/vrt/collection/balance/model/topology_comm_cost.h>
+#include <vt/vrt/collection/balance/rank_topology.h>
+#include <vt/elm/elm_comm.h>
+
+#include <gtest/gtest.h>
+
+#include "test_harness.h"
+
+#include <memory>
+
+namespace vt { namespace tests { namespace unit { namespace topo {
+
+using TestModelTopologyCommCost = TestHarness;
+
+using vt::elm::CommKeyType;
+using vt::elm::CommMapType;
+using vt::elm::CommVolume;
+using vt::elm::ElementIDStruct;
+using vt::vrt::collection::balance::TopologyCommCost;
+using vt::vrt::collection::balance::RankTopology;
+using vt::vrt::collection::balance::RankLocality;
+using vt::vrt::collection::balance::LoadMapType;
+using vt::vrt::collection::balance::LoadModel;
+using vt::vrt::collection::balance::ObjectIterator;
+using vt::vrt::collection::balance::PhaseOffset;
+using vt::vrt::collection::balance::LoadMapObjectIterator;
+using vt::vrt::collection::balance::DataMapType;
+
+using ProcLoadMap = std::unordered_map<PhaseType, LoadMapType>;
+using ProcCommMap = std::unordered_map<PhaseType, CommMapType>;
+using UserDataMap = std::unordered_map<PhaseType, DataMapType>;
+
+struct StubModel : LoadModel {
+
+  StubModel() = default;
+  virtual ~StubModel() = default;
+
+  void setLoads(
+    ProcLoadMap const* proc_load,
+    ProcCommMap const*,
+    UserDataMap const*) override {
+    proc_load_ = proc_load;
+  }
+
+  void updateLoads(PhaseType) override {}
+
+  LoadType getModeledLoad(ElementIDStruct id, PhaseOffset) const override {
+    return proc_load_->at(0).at(id).whole_phase_load;
+  }
+
+  ObjectIterator begin() const override {
+    return {std::make_unique<LoadMapObjectIterator>(proc_load_->at(0).begin(), proc_load_->at(0).end())};
+  }
+
+  unsigned int getNumCompletedPhases() const override { return 0; }
+
+  // Not used in this test
+  int getNumSubphases() const override { return 0; }
+  unsigned int getNumPastPhasesNeeded(unsigned int look_back = 0) const override { return look_back; }
+
+private:
+  ProcLoadMap const* proc_load_ = nullptr;
+};
+
+// Ranks 0 and 1 share a NUMA domain, rank 2 is on the same physical node in
+// another domain, and rank 3 is on another physical node
+std::shared_ptr<RankTopology const> makeTopology() {
+  return std::make_shared<RankTopology const>(
+    std::vector<int>{0, 0, 0, 1}, std::vector<int>{0, 0, 1, 0}
+  );
+}
+
+TEST_F(TestModelTopologyCommCost, test_rank_topology_locality) {
+  auto topology = makeTopology();
+
+  EXPECT_EQ(topology->getNumRanks(), 4);
+  EXPECT_EQ(topology->getNumPhysicalNodes(), 2);
+  EXPECT_EQ(topology->getLocality(1, 1), RankLocality::SameRank);
+  EXPECT_EQ(topology->getLocality(0, 1), RankLocality::SameNuma);
+  EXPECT_EQ(topology->getLocality(2, 0), RankLocality::SameNode);
+  EXPECT_EQ(topology->getLocality(0, 3), RankLocality::Remote);
+  EXPECT_EQ(
+    topology->getLocality(uninitialized_destination, 0), RankLocality::Remote
+  );
+}
+
+TEST_F(TestModelTopologyCommCost, test_model_topology_comm_cost_1) {
+  // The modeled object lives on rank 0 and hears from every level
+  ElementIDStruct const elem  = {1, 0};
+  ElementIDStruct const local = {2, 0};
+  ElementIDStruct const numa  = {3, 1};
+  ElementIDStruct const node  = {4, 2};
+  ElementIDStruct const far   = {5, 3};
+
+  ProcLoadMap proc_load = {{0, LoadMapType{{elem, {LoadType{100}, {}}}}}};
+
+  ProcCommMap proc_comm = {
+    {0,
+     CommMapType{
+       {{CommKeyType::CollectionTag{}, local, elem, false}, CommVolume{8.0, 1}},
+       {{CommKeyType::CollectionTag{}, numa, elem, false}, CommVolume{4.0, 1}},
+       {{CommKeyType::CollectionTag{}, node, elem, false}, CommVolume{2.0, 1}},
+       {{CommKeyType::CollectionTag{}, far, elem, false}, CommVolume{1.0, 2}},
+
+       // Sent by the object, so not charged to it
+       {{CommKeyType::CollectionTag{}, elem, far, false}, CommVolume{64.0, 1}}
+     }
+    }
+  };
+
+  auto test_model = std::make_shared<TopologyCommCost>(
+    std::make_shared<StubModel>(), makeTopology(),
+    std::array<LoadType, 4>{0., 0., 0., 3.},
+    std::array<LoadType, 4>{0., 1., 2., 10.}
+  );
+  test_model->setLoads(&proc_load, &proc_comm, nullptr);
+  test_model->updateLoads(0);
+
+  // 100 + 4*1 + 2*2 + 1*10 + 2*3
+  auto work = test_model->getModeledLoad(
+    elem, PhaseOffset{0, PhaseOffset::WHOLE_PHASE}
+  );
+  EXPECT_EQ(work, LoadType{124});
+}
+
+}}}} // end namespace vt::tests::unit::topo
@@ -0,0 +1,115 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                              test_send_batch.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <gtest/gtest.h>
+
+#include "test_parallel_harness.h"
+
+#include "vt/vrt/collection/manager.h"
+
+namespace vt { namespace tests { namespace unit { namespace send_batch {
+
+using namespace vt;
+using namespace vt::tests::unit;
+
+static constexpr int32_t const num_elms_per_node = 16;
+
+struct BatchCol : Collection<BatchCol, Index1D> {
+  void sendToAll(int num_elms) {
+    auto batch = getCollectionProxy().makeSendBatch<&BatchCol::recv>();
+    for (int i = 0; i < num_elms; i++) {
+      batch.add(Index1D(i), getIndex().x(), 2.0 * getIndex().x());
+    }
+    EXPECT_EQ(batch.size(), static_cast<std::size_t>(num_elms));
+    EXPECT_LE(
+      batch.numRanks(), static_cast<std::size_t>(theContext()->getNumNodes())
+    );
+    batch.send();
+    EXPECT_EQ(batch.size(), std::size_t{0});
+  }
+
+  void recv(int from, double value) {
+    EXPECT_DOUBLE_EQ(value, 2.0 * from);
+    num_recv_++;
+  }
+
+  void check(int expected) {
+    EXPECT_EQ(num_recv_, expected);
+  }
+
+  template <typename SerializerT>
+  void serialize(SerializerT& s) {
+    Collection<BatchCol, Index1D>::serialize(s);
+    s | num_recv_;
+  }
+
+private:
+  int num_recv_ = 0;
+};
+
+struct TestSendBatch : TestParallelHarness { };
+
+TEST_F(TestSendBatch, test_send_batch_all_to_all) {
+  auto const this_node = theContext()->getNode();
+  auto const num_nodes = theContext()->getNumNodes();
+  int const num_elms = static_cast<int>(num_nodes) * num_elms_per_node;
+
+  auto proxy = makeCollection<BatchCol>("test_send_batch_all_to_all")
+    .bounds(Index1D(num_elms))
+    .bulkInsert()
+    .wait();
+
+  runInEpochCollective([&]{
+    if (this_node == 0) {
+      proxy.broadcast<&BatchCol::sendToAll>(num_elms);
+    }
+  });
+
+  runInEpochCollective([&]{
+    if (this_node == 0) {
+      proxy.broadcast<&BatchCol::check>(num_elms);
+    }
+  });
+}
+
+}}}} // end namespace vt::tests::unit::send_batch
@@ -111,4 +111,70 @@ TEST_F(TestReduce, test_reduce_with_no_elements_on_root_rank) {
   }
 }
 
+struct CountReduceMsg : ReduceMsg {
+  CountReduceMsg(int in_num, int in_contribs)
+    : num(in_num), contribs(in_contribs)
+  {
+    live++;
+  }
+  ~CountReduceMsg() { live--; }
+
+  int num = 0;
+  int contribs = 0;
+
+  static int live;
+};
+
+/*static*/ int CountReduceMsg::live = 0;
+
+static constexpr int const local_contribs = 5;
+static bool count_reduce_done = false;
+
+static void reduceCountPlus(CountReduceMsg* msg) {
+  if (msg->isRoot()) {
+    auto const n = theContext()->getNumNodes();
+    // Each rank contributes 1..local_contribs
+    EXPECT_EQ(msg->num, n * local_contribs * (local_contribs + 1) / 2);
+    EXPECT_EQ(msg->contribs, n * local_contribs);
+    count_reduce_done = true;
+  } else {
+    auto cur_msg = msg->getNext<CountReduceMsg>();
+    while (cur_msg not_eq nullptr) {
+      msg->num += cur_msg->num;
+      msg->contribs += cur_msg->contribs;
+      cur_msg = cur_msg->getNext<CountReduceMsg>();
+    }
+  }
+}
+
+TEST_F(TestReduce, test_reduce_local_precombine) {
+  auto const root = 0;
+  auto reducer = theCollective()->global();
+  count_reduce_done = false;
+
+  runInEpochCollective([&]{
+    auto const stamp = reducer->generateNextID();
+    auto const live_before = CountReduceMsg::live;
+
+    for (int i = 1; i <= local_contribs; i++) {
+      {
+        auto msg = makeMessage<CountReduceMsg>(i, 1);
+        reducer->reduceImmediate<reduceCountPlus>(
+          root, msg.get(), stamp, local_contribs
+        );
+      }
+
+      // Local contributions are folded as they arrive: at most the
+      // accumulator is held until the last one is in
+      if (i < local_contribs) {
+        EXPECT_LE(CountReduceMsg::live - live_before, 1);
+      }
+    }
+  });
+
+  if (theContext()->getNode() == root) {
+    EXPECT_TRUE(count_reduce_done);
+  }
+}
+
 }}} // end namespace vt::tests::unit
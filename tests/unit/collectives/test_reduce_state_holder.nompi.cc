@@ -0,0 +1,123 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                      test_reduce_state_holder.nompi.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <gtest/gtest.h>
+
+#include "test_harness.h"
+
+#include "vt/collective/reduce/reduce_state_holder.h"
+
+namespace vt { namespace tests { namespace unit {
+
+using TestReduceStateHolder = TestHarness;
+
+using vt::collective::reduce::ReduceStateHolder;
+using vt::collective::reduce::ReduceState;
+using vt::collective::reduce::makeStamp;
+using vt::collective::reduce::detail::StrongSeq;
+using vt::collective::reduce::detail::StrongTag;
+
+TEST_F(TestReduceStateHolder, test_seq_stamps_dense) {
+  ReduceStateHolder holder;
+
+  for (SequentialIDType seq = 10; seq < 20; seq++) {
+    auto stamp = makeStamp<StrongSeq>(seq);
+    EXPECT_FALSE(holder.exists(stamp));
+    holder.insert(stamp, ReduceState{static_cast<int32_t>(seq)});
+    EXPECT_TRUE(holder.exists(stamp));
+  }
+
+  EXPECT_EQ(holder.size(), 10U);
+
+  // Out-of-order arrival in front of the current window
+  auto early = makeStamp<StrongSeq>(SequentialIDType{5});
+  holder.insert(early, ReduceState{5});
+  EXPECT_TRUE(holder.exists(early));
+  EXPECT_EQ(holder.find(early).num_contrib_, 5);
+
+  for (SequentialIDType seq = 10; seq < 20; seq++) {
+    auto stamp = makeStamp<StrongSeq>(seq);
+    EXPECT_EQ(holder.find(stamp).num_contrib_, static_cast<int32_t>(seq));
+  }
+
+  // Erase from the middle and then the ends
+  holder.erase(makeStamp<StrongSeq>(SequentialIDType{15}));
+  EXPECT_FALSE(holder.exists(makeStamp<StrongSeq>(SequentialIDType{15})));
+  holder.erase(early);
+  EXPECT_FALSE(holder.exists(early));
+  EXPECT_EQ(holder.size(), 9U);
+
+  for (SequentialIDType seq = 10; seq < 20; seq++) {
+    holder.erase(makeStamp<StrongSeq>(seq));
+  }
+  EXPECT_EQ(holder.size(), 0U);
+}
+
+TEST_F(TestReduceStateHolder, test_seq_stamps_fallback) {
+  ReduceStateHolder holder;
+
+  auto first = makeStamp<StrongSeq>(SequentialIDType{1});
+  auto far = makeStamp<StrongSeq>(
+    SequentialIDType{1} + ReduceStateHolder::max_dense_window * 2
+  );
+  auto tag = makeStamp<StrongTag>(TagType{7});
+
+  holder.insert(first, ReduceState{1});
+  holder.insert(far, ReduceState{2});
+  holder.insert(tag, ReduceState{3});
+
+  EXPECT_EQ(holder.size(), 3U);
+  EXPECT_EQ(holder.find(first).num_contrib_, 1);
+  EXPECT_EQ(holder.find(far).num_contrib_, 2);
+  EXPECT_EQ(holder.find(tag).num_contrib_, 3);
+
+  holder.erase(far);
+  holder.erase(tag);
+  holder.erase(first);
+  EXPECT_FALSE(holder.exists(first));
+  EXPECT_FALSE(holder.exists(far));
+  EXPECT_FALSE(holder.exists(tag));
+  EXPECT_EQ(holder.size(), 0U);
+}
+
+}}} // end namespace vt::tests::unit
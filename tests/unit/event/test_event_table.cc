@@ -0,0 +1,135 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                             test_event_table.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <gtest/gtest.h>
+
+#include "test_parallel_harness.h"
+
+#include <vt/event/event.h>
+
+#include <memory>
+#include <vector>
+
+namespace vt { namespace tests { namespace unit {
+
+using TestEventTable = TestParallelHarness;
+
+TEST_F(TestEventTable, test_event_table_reuse_generation) {
+  using EventIDManager = event::EventIDManager;
+
+  auto const this_node = theContext()->getNode();
+
+  auto const e1 = theEvent()->createNormalEvent(this_node);
+  EXPECT_TRUE(theEvent()->holderExists(e1));
+  EXPECT_EQ(theEvent()->getOwningNode(e1), this_node);
+
+  theEvent()->removeEventID(e1);
+  EXPECT_FALSE(theEvent()->holderExists(e1));
+
+  // The freed slot is reused with a new generation, so the old identifier
+  // does not alias the new event
+  auto const e2 = theEvent()->createNormalEvent(this_node);
+  EXPECT_EQ(EventIDManager::getEventSlot(e1), EventIDManager::getEventSlot(e2));
+  EXPECT_NE(e1, e2);
+  EXPECT_TRUE(theEvent()->holderExists(e2));
+  EXPECT_FALSE(theEvent()->holderExists(e1));
+  EXPECT_EQ(
+    theEvent()->testEventComplete(e1),
+    event::AsyncEvent::EventStateType::EventReady
+  );
+  EXPECT_EQ(
+    theEvent()->testEventComplete(e2),
+    event::AsyncEvent::EventStateType::EventWaiting
+  );
+
+  int triggered = 0;
+  theEvent()->attachAction(e2, [&]{ triggered++; });
+  theEvent()->getEventHolder(e2).makeReadyTrigger();
+  EXPECT_EQ(triggered, 1);
+  EXPECT_FALSE(theEvent()->holderExists(e2));
+}
+
+TEST_F(TestEventTable, test_event_table_free_releases_slot) {
+  auto const this_node = theContext()->getNode();
+
+  // A removed event must not keep its actions' captures or its managed
+  // message alive until the slot is reused
+  auto const e = theEvent()->createNormalEvent(this_node);
+  auto msg = makeMessage<vt::Message>();
+  auto captured = std::make_shared<int>(0);
+  auto& holder = theEvent()->getEventHolder(e);
+  holder.get_event()->setManagedMessage(msg.to<ShortMessage>());
+  holder.attachAction([captured]{ (*captured)++; });
+  EXPECT_EQ(envelopeGetRef(msg->env), 2);
+  EXPECT_EQ(captured.use_count(), 2);
+
+  theEvent()->removeEventID(e);
+  EXPECT_FALSE(theEvent()->holderExists(e));
+  EXPECT_EQ(envelopeGetRef(msg->env), 1);
+  EXPECT_EQ(captured.use_count(), 1);
+  EXPECT_EQ(*captured, 0);
+}
+
+TEST_F(TestEventTable, test_event_table_polling_events) {
+  auto const this_node = theContext()->getNode();
+  int const num = 3000;
+
+  // Spans several pages of slots; MPI events with a null request are ready at
+  // the first poll
+  int triggered = 0;
+  std::vector<EventType> events;
+  for (int i = 0; i < num; i++) {
+    auto const e = theEvent()->createMPIEvent(this_node);
+    theEvent()->getEventHolder(e).attachAction([&]{ triggered++; });
+    events.push_back(e);
+  }
+
+  theEvent()->testEventsTrigger();
+
+  EXPECT_EQ(triggered, num);
+  for (auto&& e : events) {
+    EXPECT_FALSE(theEvent()->holderExists(e));
+  }
+}
+
+}}} // end namespace vt::tests::unit
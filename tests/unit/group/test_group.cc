@@ -48,8 +48,11 @@
 #include "test_helpers.h"
 
 #include "vt/group/group_manager.h"
+#include "vt/group/region/group_bitmap.h"
+#include "vt/group/region/group_list.h"
 
 #include <algorithm>
+#include <stdexcept>
 
 namespace vt { namespace tests { namespace unit {
 
@@ -72,6 +75,21 @@ struct TestGroup : TestParallelHarness {
     num_recv++;
     fmt::print("{}: groupHandler: num_recv={}\n", this_node, num_recv);
   }
+
+  static std::unique_ptr<region::Bitmap> makeOddBitmap() {
+    auto const& num_nodes = theContext()->getNumNodes();
+    auto bitmap = std::make_unique<region::Bitmap>(num_nodes);
+    for (NodeType node = 1; node < num_nodes; node += 2) {
+      bitmap->add(node);
+    }
+    return bitmap;
+  }
+
+  static void sparseCreateHandler([[maybe_unused]] TestMsg* msg) {
+    num_recv++;
+    // Create the group after receiving, so forwarding waits for creation
+    theGroup()->newGroupSparse(makeOddBitmap());
+  }
 };
 
 TEST_F(TestGroup, test_group_range_construct_1) {
@@ -159,4 +177,135 @@ TEST_F(TestGroup, test_group_collective_construct_1) {
   num_recv = 0;
 }
 
+TEST_F(TestGroup, test_group_sparse_range) {
+  auto const& this_node = theContext()->getNode();
+  auto const& num_nodes = theContext()->getNumNodes();
+  bool const node_filter = this_node % 2 == 0;
+
+  runInEpochCollective([&]{
+    auto group = theGroup()->newGroupSparse(
+      std::make_unique<region::Range>(0, num_nodes, 2)
+    );
+    EXPECT_EQ(theGroup()->inGroup(group), node_filter);
+    EXPECT_EQ(theGroup()->groupRoot(group), 0);
+    auto msg = makeMessage<TestMsg>();
+    envelopeSetGroup(msg->env, group);
+    theMsg()->broadcastMsg<groupHandler>(msg);
+  });
+
+  if (node_filter) {
+    EXPECT_EQ(num_recv, num_nodes);
+  } else {
+    EXPECT_EQ(num_recv, 0);
+  }
+  num_recv = 0;
+}
+
+TEST_F(TestGroup, test_group_sparse_bitmap_late_create) {
+  auto const& this_node = theContext()->getNode();
+  bool const node_filter = this_node % 2 == 1;
+
+  runInEpochCollective([&]{
+    if (this_node == 0) {
+      auto group = theGroup()->newGroupSparse(makeOddBitmap());
+      EXPECT_FALSE(theGroup()->inGroup(group));
+      auto msg = makeMessage<TestMsg>();
+      envelopeSetGroup(msg->env, group);
+      theMsg()->broadcastMsg<sparseCreateHandler>(msg);
+    }
+  });
+
+  if (node_filter) {
+    EXPECT_EQ(num_recv, 1);
+  } else {
+    EXPECT_EQ(num_recv, 0);
+  }
+  num_recv = 0;
+}
+
+TEST_F(TestGroup, test_group_sparse_tree_cache) {
+  auto const& num_nodes = theContext()->getNumNodes();
+  auto const& cache = theGroup()->getSparseTreeCache();
+
+  auto const hits = cache.getHits();
+  auto g1 = theGroup()->newGroupSparse(
+    std::make_unique<region::Range>(0, num_nodes)
+  );
+  auto g2 = theGroup()->newGroupSparse(
+    std::make_unique<region::Range>(0, num_nodes)
+  );
+  EXPECT_EQ(g1, g2);
+  EXPECT_EQ(cache.getHits(), hits + 1);
+
+  // The same members in another encoding is another group
+  region::Region::ListType list;
+  for (NodeType node = 0; node < num_nodes; node++) {
+    list.push_back(node);
+  }
+  auto g3 = theGroup()->newGroupSparse(
+    std::make_unique<region::List>(list)
+  );
+  EXPECT_NE(g1, g3);
+  EXPECT_TRUE(theGroup()->inGroup(g3));
+
+  // Re-creating after delete derives the same ID and reuses the tree
+  theGroup()->deleteGroupSparse(g1);
+  auto g4 = theGroup()->newGroupSparse(
+    std::make_unique<region::Range>(0, num_nodes)
+  );
+  EXPECT_EQ(g1, g4);
+  EXPECT_EQ(cache.getHits(), hits + 2);
+
+  theGroup()->deleteGroupSparse(g3);
+  theGroup()->deleteGroupSparse(g4);
+}
+
+/// A list region with a chosen hash, to force collisions
+struct FixedHashList : region::List {
+  FixedHashList(ListType const& in_list, std::size_t in_hash)
+    : region::List(in_list), fixed_hash_(in_hash)
+  { }
+
+  std::size_t hash() override { return fixed_hash_; }
+
+private:
+  std::size_t fixed_hash_ = 0;
+};
+
+TEST_F(TestGroup, test_group_sparse_collision_aborts) {
+  auto const& num_nodes = theContext()->getNumNodes();
+  region::Region::ListType all, first;
+  for (NodeType node = 0; node < num_nodes; node++) {
+    all.push_back(node);
+  }
+  first.push_back(0);
+
+  std::size_t const hash = 0x5A5A5A5A5A5Aull;
+  auto g1 = theGroup()->newGroupSparse(
+    std::make_unique<FixedHashList>(all, hash)
+  );
+
+  // Same hash, different members: the cached tree does not match
+  EXPECT_THROW(
+    theGroup()->newGroupSparse(std::make_unique<FixedHashList>(first, hash)),
+    std::runtime_error
+  );
+
+  // A hash differing only in the bits the ID drops: same ID, other region
+  std::size_t const high_bit = std::size_t{1} << 60;
+  EXPECT_THROW(
+    theGroup()->newGroupSparse(
+      std::make_unique<FixedHashList>(first, hash | high_bit)
+    ),
+    std::runtime_error
+  );
+
+  // The same region again is still the same group
+  auto g2 = theGroup()->newGroupSparse(
+    std::make_unique<FixedHashList>(all, hash)
+  );
+  EXPECT_EQ(g1, g2);
+  theGroup()->deleteGroupSparse(g1);
+}
+
 }}} // end namespace vt::tests::unit
@@ -0,0 +1,212 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                       test_graph_partitioner.nompi.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <vt/vrt/collection/balance/graphpartlb/graph_partitioner.h>
+
+#include "test_harness.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace vt { namespace tests { namespace unit {
+
+using TestGraphPartitioner = TestHarness;
+using PartGraph = vt::vrt::collection::lb::PartGraph;
+using MultilevelPartitioner = vt::vrt::collection::lb::MultilevelPartitioner;
+
+/**
+ * Build an n x n grid with unit edges; \c home_of and \c load_of give the
+ * home rank and load of each vertex
+ */
+template <typename HomeT, typename LoadT>
+PartGraph buildGrid(int n, HomeT&& home_of, LoadT&& load_of) {
+  PartGraph graph;
+  for (int i = 0; i < n * n; i++) {
+    graph.addVertex(load_of(i), home_of(i));
+  }
+  for (int y = 0; y < n; y++) {
+    for (int x = 0; x < n; x++) {
+      auto const v = static_cast<PartGraph::VertexType>(y * n + x);
+      if (x + 1 < n) {
+        graph.addEdge(v, v + 1, 1.0);
+      }
+      if (y + 1 < n) {
+        graph.addEdge(v, v + n, 1.0);
+      }
+    }
+  }
+  graph.finalize();
+  return graph;
+}
+
+LoadType maxPartLoad(
+  PartGraph const& graph, std::vector<NodeType> const& part, int num_parts
+) {
+  std::vector<LoadType> loads(num_parts, 0.);
+  for (PartGraph::VertexType v = 0; v < graph.getNumVertices(); v++) {
+    loads[part[v]] += graph.getLoad(v);
+  }
+  return *std::max_element(loads.begin(), loads.end());
+}
+
+TEST_F(TestGraphPartitioner, test_graph_partitioner_finalize_merges_edges) {
+  PartGraph graph;
+  auto a = graph.addVertex(1., 0);
+  auto b = graph.addVertex(2., 1);
+  graph.addEdge(a, b, 1.);
+  graph.addEdge(b, a, 2.);
+  graph.addEdge(a, a, 5.);
+  graph.finalize();
+
+  ASSERT_EQ(graph.getEdges(a).size(), 1u);
+  EXPECT_DOUBLE_EQ(std::get<1>(graph.getEdges(a)[0]), 3.);
+  EXPECT_DOUBLE_EQ(graph.getTotalLoad(), 3.);
+  EXPECT_DOUBLE_EQ(graph.getEdgeCut({0, 1}), 3.);
+  EXPECT_DOUBLE_EQ(graph.getEdgeCut({0, 0}), 0.);
+}
+
+TEST_F(TestGraphPartitioner, test_graph_partitioner_reduces_edge_cut) {
+  int const n = 16;
+  int const num_parts = 4;
+  double const tolerance = 0.05;
+
+  // Round-robin placement is balanced but cuts almost every edge
+  auto graph = buildGrid(
+    n, [&](int i) { return static_cast<NodeType>(i % num_parts); },
+    [](int) { return 1.0; }
+  );
+  std::vector<NodeType> home(graph.getNumVertices());
+  for (PartGraph::VertexType v = 0; v < home.size(); v++) {
+    home[v] = graph.getHome(v);
+  }
+
+  MultilevelPartitioner partitioner{num_parts, tolerance, 4 * num_parts, 8};
+  auto part = partitioner.partition(graph);
+
+  ASSERT_EQ(part.size(), graph.getNumVertices());
+  EXPECT_LT(graph.getEdgeCut(part), graph.getEdgeCut(home) / 2);
+  EXPECT_LE(
+    maxPartLoad(graph, part, num_parts),
+    graph.getTotalLoad() / num_parts * (1.0 + tolerance)
+  );
+}
+
+TEST_F(TestGraphPartitioner, test_graph_partitioner_balances_and_is_stable) {
+  int const n = 32;
+  int const num_parts = 8;
+  double const tolerance = 0.05;
+
+  // Everything starts on rank 0 with a heavy corner
+  auto graph = buildGrid(
+    n, [](int) { return static_cast<NodeType>(0); },
+    [&](int i) { return i % n < 4 and i / n < 4 ? 4.0 : 1.0; }
+  );
+
+  MultilevelPartitioner partitioner{num_parts, tolerance, 4 * num_parts, 8};
+  auto part = partitioner.partition(graph);
+
+  // The bound may be off by at most one heavy vertex
+  EXPECT_LE(
+    maxPartLoad(graph, part, num_parts),
+    graph.getTotalLoad() / num_parts * (1.0 + tolerance) + 4.0
+  );
+  EXPECT_EQ(part, partitioner.partition(graph));
+}
+
+TEST_F(TestGraphPartitioner, test_graph_partitioner_fm_escapes_local_min) {
+  int const num_parts = 2;
+
+  // The pair x-y sits on rank 0 but talks to rank 1. Moving either one alone
+  // makes the cut worse; moving both removes it
+  PartGraph graph;
+  auto x = graph.addVertex(0.5, 0);
+  auto y = graph.addVertex(0.5, 0);
+  auto a = graph.addVertex(1., 0);
+  auto b = graph.addVertex(1., 0);
+  auto c = graph.addVertex(1., 0);
+  auto p = graph.addVertex(1., 1);
+  auto q = graph.addVertex(1., 1);
+  auto d = graph.addVertex(1., 1);
+  graph.addEdge(x, y, 10.);
+  graph.addEdge(x, p, 6.);
+  graph.addEdge(y, q, 6.);
+  graph.addEdge(a, b, 5.);
+  graph.addEdge(b, c, 5.);
+  graph.addEdge(p, d, 10.);
+  graph.addEdge(q, d, 10.);
+  graph.finalize();
+
+  // Coarsen no further than the input graph, so only refinement runs
+  MultilevelPartitioner partitioner{num_parts, 0.5, 16, 4};
+  auto part = partitioner.partition(graph);
+
+  EXPECT_EQ(part[x], 1);
+  EXPECT_EQ(part[y], 1);
+  EXPECT_DOUBLE_EQ(graph.getEdgeCut(part), 0.);
+}
+
+TEST_F(TestGraphPartitioner, test_graph_partitioner_keeps_fixed_vertices) {
+  int const num_parts = 2;
+
+  // A heavy chain on rank 0 where every other vertex is fixed
+  PartGraph graph;
+  for (int i = 0; i < 16; i++) {
+    graph.addVertex(1., 0, i % 2 == 0);
+  }
+  for (PartGraph::VertexType v = 0; v + 1 < 16; v++) {
+    graph.addEdge(v, v + 1, 1.);
+  }
+  graph.finalize();
+
+  MultilevelPartitioner partitioner{num_parts, 0.05, 2, 4};
+  auto part = partitioner.partition(graph);
+
+  for (PartGraph::VertexType v = 0; v < graph.getNumVertices(); v++) {
+    if (graph.isFixed(v)) {
+      EXPECT_EQ(part[v], 0);
+    }
+  }
+  EXPECT_LE(maxPartLoad(graph, part, num_parts), 12.);
+}
+
+}}} // end namespace vt::tests::unit
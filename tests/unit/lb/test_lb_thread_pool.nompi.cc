@@ -0,0 +1,103 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                         test_lb_thread_pool.nompi.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <vt/vrt/collection/balance/baselb/lb_thread_pool.h>
+
+#include "test_harness.h"
+
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace vt { namespace tests { namespace unit {
+
+using TestLBThreadPool = TestHarness;
+using LBThreadPool = vt::vrt::collection::lb::LBThreadPool;
+
+TEST_F(TestLBThreadPool, test_lb_thread_pool_parallel_for) {
+  for (int threads = 1; threads <= 4; threads++) {
+    LBThreadPool pool{threads};
+    EXPECT_EQ(pool.getNumThreads(), threads);
+
+    for (std::size_t n : {0, 1, 3, 1000}) {
+      std::vector<int> hits(n, 0);
+      pool.parallelFor(n, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+          hits[i]++;
+        }
+      });
+      for (std::size_t i = 0; i < n; i++) {
+        EXPECT_EQ(hits[i], 1);
+      }
+    }
+  }
+}
+
+TEST_F(TestLBThreadPool, test_lb_thread_pool_sort_is_stable) {
+  using ElmType = std::pair<int, std::size_t>;
+  auto comp = [](ElmType const& a, ElmType const& b) {
+    return a.first > b.first;
+  };
+
+  for (int threads = 1; threads <= 5; threads++) {
+    LBThreadPool pool{threads};
+
+    for (std::size_t n : {0, 2, 7, 5003}) {
+      std::mt19937 gen(static_cast<unsigned>(n));
+      std::uniform_int_distribution<int> dist(0, 15);
+
+      // Many equal keys, tagged with their position, to observe stability
+      std::vector<ElmType> elms;
+      for (std::size_t i = 0; i < n; i++) {
+        elms.emplace_back(dist(gen), i);
+      }
+      auto expected = elms;
+
+      pool.sort(elms.begin(), elms.end(), comp);
+      std::stable_sort(expected.begin(), expected.end(), comp);
+      EXPECT_EQ(elms, expected);
+    }
+  }
+}
+
+}}} /* end namespace vt::tests::unit */
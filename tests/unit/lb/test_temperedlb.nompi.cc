@@ -45,8 +45,14 @@
 #include <vt/vrt/collection/balance/baselb/baselb.h>
 #include <vt/vrt/collection/balance/temperedlb/temperedlb.h>
 #include <vt/vrt/collection/balance/temperedwmin/temperedwmin.h>
+#include <vt/vrt/collection/balance/rank_topology.h>
+#include <vt/elm/elm_id_bits.h>
 
 #include "test_harness.h"
+#include "test_helpers.h"
+
+#include <filesystem>
+#include <memory>
 
 namespace vt { namespace tests { namespace unit {
 
@@ -226,4 +232,120 @@ TEST_F(TestTemperedLB, test_temperedwmin_ordering_smallobjects_largest) {
   orderUsingTargetLoadAndVerify(order, target_load, soln, true);
 }
 
+///////////////////////////////////////////////////////////////////////////
+
+using RankTopology = vt::vrt::collection::balance::RankTopology;
+using ClusterInfo = vt::vrt::collection::lb::ClusterInfo;
+using NodeInfo = vt::vrt::collection::lb::NodeInfo;
+
+// Exposes the work model of TemperedLB
+struct TemperedLBWorkModel : vt::vrt::collection::lb::TemperedLB {
+  using TemperedLB::addCommEdge;
+  using TemperedLB::computeWorkAfterClusterSwap;
+  using TemperedLB::computeWorkBreakdown;
+  using TemperedLB::interRankFactor;
+  using TemperedLB::setTopology;
+  using TemperedLB::setWorkCoefficients;
+};
+
+// Rank 0 shares a NUMA domain with rank 1, a physical node with rank 2, and
+// nothing with rank 3
+std::shared_ptr<RankTopology const> makeTopology() {
+  return std::make_shared<RankTopology const>(
+    std::vector<int>{0, 0, 0, 1}, std::vector<int>{0, 0, 1, 0}
+  );
+}
+
+TEST_F(TestTemperedLB, test_temperedlb_topology_scales_work_breakdown) {
+  using vt::elm::ElmIDBits;
+
+  TemperedLBWorkModel lb;
+  lb.setWorkCoefficients(1.0, 1.0, 0.0, 0.0);
+  lb.setTopology(makeTopology(), 0.25, 0.5);
+
+  EXPECT_DOUBLE_EQ(lb.interRankFactor(0, 1), 0.25);
+  EXPECT_DOUBLE_EQ(lb.interRankFactor(0, 2), 0.5);
+  EXPECT_DOUBLE_EQ(lb.interRankFactor(0, 3), 1.0);
+
+  // One object on rank 0 sends 100 bytes to and receives 40 bytes from an
+  // object on each other rank
+  auto const obj = ElmIDBits::createCollectionImpl(true, 1, 0, 0);
+  for (NodeType rank = 1; rank < 4; rank++) {
+    auto const other =
+      ElmIDBits::createCollectionImpl(true, 1 + rank, rank, rank);
+    lb.addCommEdge(obj, other, 100.0);
+    lb.addCommEdge(other, obj, 40.0);
+  }
+
+  auto const w = lb.computeWorkBreakdown(0, {{obj, 2.0}});
+  EXPECT_DOUBLE_EQ(w.inter_send_vol, 100.0 * (0.25 + 0.5 + 1.0));
+  EXPECT_DOUBLE_EQ(w.inter_recv_vol, 40.0 * (0.25 + 0.5 + 1.0));
+  EXPECT_DOUBLE_EQ(w.intra_send_vol, 0.0);
+  EXPECT_DOUBLE_EQ(w.work, 2.0 + 175.0);
+
+  // Without a topology every inter-rank byte is charged in full
+  lb.setTopology(nullptr, 0.25, 0.5);
+  auto const full = lb.computeWorkBreakdown(0, {{obj, 2.0}});
+  EXPECT_DOUBLE_EQ(full.inter_send_vol, 300.0);
+  EXPECT_DOUBLE_EQ(full.work, 2.0 + 300.0);
+}
+
+TEST_F(TestTemperedLB, test_temperedlb_topology_scales_cluster_swap) {
+  TemperedLBWorkModel lb;
+  lb.setWorkCoefficients(1.0, 1.0, 0.0, 0.0);
+  lb.setTopology(makeTopology(), 0.25, 0.5);
+
+  // Rank 0 holds one cluster that sends 100 and receives 40 bytes from each
+  // other rank
+  ClusterInfo to_remove;
+  to_remove.load = 2.0;
+  for (NodeType rank = 1; rank < 4; rank++) {
+    to_remove.inter_send_vol[rank] = 100.0;
+    to_remove.inter_recv_vol[rank] = 40.0;
+  }
+
+  NodeInfo info;
+  info.load = 2.0;
+  info.inter_send_vol = 175.0;
+  info.inter_recv_vol = 70.0;
+  info.work = 2.0 + 175.0;
+
+  // It is swapped for a cluster that sends 80 bytes to rank 2, on the same
+  // physical node
+  ClusterInfo to_add;
+  to_add.load = 1.0;
+  to_add.inter_send_vol[2] = 80.0;
+
+  EXPECT_DOUBLE_EQ(
+    lb.computeWorkAfterClusterSwap(0, info, to_remove, to_add),
+    1.0 + 80.0 * 0.5
+  );
+
+  // Swapped for one that sends to rank 1 instead, in the same NUMA domain
+  to_add.inter_send_vol.clear();
+  to_add.inter_send_vol[1] = 80.0;
+  EXPECT_DOUBLE_EQ(
+    lb.computeWorkAfterClusterSwap(0, info, to_remove, to_add),
+    1.0 + 80.0 * 0.25
+  );
+}
+
+TEST_F(TestTemperedLB, test_rank_topology_read_numa_domain) {
+  namespace fs = std::filesystem;
+
+  // A sysfs-like CPU directory: cpu1 is in NUMA node 3, cpu2 names no node
+  // and there is no cpu7
+  auto const dir = fs::temp_directory_path() / getUniqueFilename();
+  fs::create_directories(dir / "cpu1" / "node3");
+  fs::create_directories(dir / "cpu2" / "cache");
+
+#if defined(__linux__)
+  EXPECT_EQ(RankTopology::readNumaDomain(dir.string(), 1), 3);
+#endif
+  EXPECT_EQ(RankTopology::readNumaDomain(dir.string(), 2), 0);
+  EXPECT_EQ(RankTopology::readNumaDomain(dir.string(), 7), 0);
+
+  fs::remove_all(dir);
+}
+
 }}} // end namespace vt::tests::unit
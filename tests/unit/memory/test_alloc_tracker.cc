@@ -0,0 +1,149 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                            test_alloc_tracker.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <gtest/gtest.h>
+
+#include "test_parallel_harness.h"
+#include "vt/utils/memory/alloc_tracker.h"
+#include "vt/utils/memory/memory_usage.h"
+
+#include <memory>
+#include <vector>
+
+namespace vt { namespace tests { namespace unit {
+
+using namespace vt::util::memory;
+
+#if vt_check_enabled(alloc_tracking)
+
+static constexpr std::size_t const alloc_bytes = 1 << 20;
+static std::unique_ptr<std::vector<char>> held = nullptr;
+
+struct TestMsg : vt::Message {};
+
+struct TestAllocTracker : TestParallelHarness {
+  void addAdditionalArgs() override {
+    static char vt_alloc_tracking[]{"--vt_alloc_tracking"};
+    addArgs(vt_alloc_tracking);
+  }
+
+  static void allocHandler([[maybe_unused]] TestMsg* msg) {
+    held = std::make_unique<std::vector<char>>(alloc_bytes);
+  }
+
+  static int64_t handlerLiveBytes() {
+    int64_t live = 0;
+    for (auto&& s : AllocTracker::getStats()) {
+      if (s.key.kind == AllocContextKind::Handler) {
+        live = std::max(live, s.live_bytes);
+      }
+    }
+    return live;
+  }
+};
+
+TEST_F(TestAllocTracker, test_alloc_tracker_attributes_handler) {
+  ASSERT_TRUE(AllocTracker::isEnabled());
+
+  auto const this_node = theContext()->getNode();
+  runInEpochCollective([&]{
+    auto msg = vt::makeMessage<TestMsg>();
+    theMsg()->sendMsg<allocHandler>(this_node, msg);
+  });
+
+  // The vector outlives the handler, so its bytes stay charged to it
+  EXPECT_GE(handlerLiveBytes(), static_cast<int64_t>(alloc_bytes));
+  EXPECT_NE(theMemUsage()->getAllocSummary(5), "");
+
+  // Freeing outside the handler is charged back to the handler
+  held.reset();
+  EXPECT_LT(handlerLiveBytes(), static_cast<int64_t>(alloc_bytes));
+}
+
+TEST_F(TestAllocTracker, test_alloc_tracker_reuses_released_slots) {
+  ASSERT_TRUE(AllocTracker::isEnabled());
+
+  auto const elementKey = [](uint64_t id) {
+    return AllocContextKey{AllocContextKind::Collection, 0xA110C0000ull + id};
+  };
+  auto const runElement = [](AllocContextKey key, std::size_t bytes) {
+    AllocTracker::pushContext(key);
+    auto v = std::make_unique<std::vector<char>>(bytes);
+    AllocTracker::popContext();
+    return v;
+  };
+
+  // Elements that free what they allocate hand their slot to the next one
+  runElement(elementKey(0), 64);
+  AllocTracker::releaseContext(elementKey(0));
+  auto const num_slots = AllocTracker::getStats().size();
+  for (uint64_t i = 1; i < 100; i++) {
+    runElement(elementKey(i), 64);
+    AllocTracker::releaseContext(elementKey(i));
+  }
+  EXPECT_EQ(AllocTracker::getStats().size(), num_slots);
+
+  // A released element with live blocks keeps its slot and its counts until
+  // they are freed
+  auto kept = runElement(elementKey(100), alloc_bytes);
+  AllocTracker::releaseContext(elementKey(100));
+  EXPECT_EQ(AllocTracker::getLiveBytes(elementKey(100)), 0);
+  auto const findLive = [&]{
+    int64_t live = -1;
+    for (auto&& s : AllocTracker::getStats()) {
+      if (s.key == elementKey(100)) {
+        live = s.live_bytes;
+      }
+    }
+    return live;
+  };
+  EXPECT_GE(findLive(), static_cast<int64_t>(alloc_bytes));
+
+  kept.reset();
+  EXPECT_EQ(findLive(), 0);
+  AllocTracker::resetPhase();
+}
+
+#endif /*vt_check_enabled(alloc_tracking)*/
+
+}}} /* end namespace vt::tests::unit */
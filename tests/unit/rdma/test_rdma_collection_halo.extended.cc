@@ -0,0 +1,209 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                    test_rdma_collection_halo.extended.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <gtest/gtest.h>
+
+#include "test_parallel_harness.h"
+#include "test_helpers.h"
+#include "vt/vrt/collection/manager.h"
+
+namespace vt { namespace tests { namespace unit {
+
+#if vt_check_enabled(rdma_tests)
+
+static constexpr int const halo_num_elms = 16;
+static constexpr int const halo_width = 4;
+static bool halo_triggered_lb = false;
+
+struct TestHaloCol : vt::Collection<TestHaloCol, vt::Index1D> {
+  TestHaloCol() = default;
+
+  struct TestMsg : vt::CollectionMessage<TestHaloCol> { };
+
+  static double value(int x, std::size_t region, int iter) {
+    return iter * 1000 + x * 10 + static_cast<double>(region);
+  }
+
+  void makeHalo(TestMsg*) {
+    auto proxy = this->getCollectionProxy();
+    auto idx = this->getIndex();
+    auto const x = idx.x();
+
+    vt::rdma::HaloLayout layout;
+    west_ = layout.addRegion("west", halo_width);
+    east_ = layout.addRegion("east", halo_width);
+    halo_ = proxy.template makeHaloRDMA<double>(idx, layout);
+
+    // My east edge is the west ghost of my right neighbor and vice versa
+    auto const right = x + 1 < halo_num_elms ? x + 1 : 0;
+    auto const left = x > 0 ? x - 1 : halo_num_elms - 1;
+    halo_.addNeighbor(vt::Index1D(right), "west");
+    halo_.addNeighbor(vt::Index1D(left), "east");
+  }
+
+  void exchange(TestMsg*) {
+    auto const x = this->getIndex().x();
+    iter_++;
+    halo_.exchange(
+      [&](vt::Index1D, std::size_t region, double* buf, std::size_t count) {
+        EXPECT_EQ(count, static_cast<std::size_t>(halo_width));
+        for (std::size_t i = 0; i < count; i++) {
+          buf[i] = value(x, region, iter_);
+        }
+      }
+    );
+    EXPECT_EQ(halo_.getNumNeighbors(), 2u);
+    EXPECT_LE(halo_.getNumTargetRanks(), 2u);
+  }
+
+  void checkGhosts(TestMsg*) {
+    auto const x = this->getIndex().x();
+    auto const right = x + 1 < halo_num_elms ? x + 1 : 0;
+    auto const left = x > 0 ? x - 1 : halo_num_elms - 1;
+
+    halo_.readGhost("west", [&](double const* data, std::size_t count) {
+      EXPECT_EQ(count, static_cast<std::size_t>(halo_width));
+      for (std::size_t i = 0; i < count; i++) {
+        EXPECT_EQ(data[i], value(left, west_, iter_));
+      }
+    });
+    halo_.readGhost(east_, [&](double const* data, std::size_t count) {
+      EXPECT_EQ(count, static_cast<std::size_t>(halo_width));
+      for (std::size_t i = 0; i < count; i++) {
+        EXPECT_EQ(data[i], value(right, east_, iter_));
+      }
+    });
+  }
+
+  void migrateObjs(TestMsg*) {
+    auto idx = this->getIndex();
+    if (idx.x() % 2 == 0) {
+      auto node = vt::theContext()->getNode();
+      auto num = vt::theContext()->getNumNodes();
+      auto next = node + 1 < num ? node + 1 : 0;
+      this->migrate(next);
+    }
+  }
+
+  void runLBHooksForRDMA(TestMsg*) {
+    if (not halo_triggered_lb) {
+      halo_triggered_lb = true;
+      vt::thePhase()->runHooksManual(vt::phase::PhaseHook::EndPostMigration);
+    }
+  }
+
+  void destroyHalo(TestMsg*) {
+    auto proxy = this->getCollectionProxy();
+    proxy.destroyHaloRDMA(halo_);
+  }
+
+  template <typename SerializerT>
+  void serialize(SerializerT& s) {
+    vt::Collection<TestHaloCol, vt::Index1D>::serialize(s);
+    s | halo_ | west_ | east_ | iter_;
+  }
+
+private:
+  vt::HaloRDMA<double, vt::Index1D> halo_;
+  std::size_t west_ = 0;
+  std::size_t east_ = 0;
+  int iter_ = 0;
+};
+
+struct TestRDMAHaloCollection : TestParallelHarness { };
+
+TEST_F(TestRDMAHaloCollection, test_rdma_halo_exchange_and_migrate) {
+  SET_MAX_NUM_NODES_CONSTRAINT(CMAKE_DETECTED_MAX_NUM_NODES);
+
+  using MsgType = TestHaloCol::TestMsg;
+
+  halo_triggered_lb = false;
+
+  CollectionProxy<TestHaloCol, Index1D> proxy;
+
+  runInEpochCollective([&]{
+    auto range = vt::Index1D(halo_num_elms);
+    proxy = theCollection()->constructCollective<TestHaloCol>(
+      range, "test_rdma_halo_exchange_and_migrate"
+    );
+  });
+
+  runInEpochCollective([=]{
+    proxy.template broadcastCollective<MsgType, &TestHaloCol::makeHalo>();
+  });
+
+  for (int i = 0; i < 2; i++) {
+    runInEpochCollective([=]{
+      proxy.template broadcastCollective<MsgType, &TestHaloCol::exchange>();
+    });
+    runInEpochCollective([=]{
+      proxy.template broadcastCollective<MsgType, &TestHaloCol::checkGhosts>();
+    });
+  }
+
+  runInEpochCollective([=]{
+    proxy.template broadcastCollective<MsgType, &TestHaloCol::migrateObjs>();
+  });
+
+  runInEpochCollective([=]{
+    proxy.template broadcastCollective<
+      MsgType, &TestHaloCol::runLBHooksForRDMA
+    >();
+  });
+
+  // The neighbors have moved, so the plan must be re-resolved
+  runInEpochCollective([=]{
+    proxy.template broadcastCollective<MsgType, &TestHaloCol::exchange>();
+  });
+  runInEpochCollective([=]{
+    proxy.template broadcastCollective<MsgType, &TestHaloCol::checkGhosts>();
+  });
+
+  runInEpochCollective([=]{
+    proxy.template broadcastCollective<MsgType, &TestHaloCol::destroyHalo>();
+  });
+}
+
+#endif /*vt_check_enabled(rdma_tests)*/
+
+}}} /* end namespace vt::tests::unit */
@@ -72,13 +72,23 @@ TYPED_TEST_P(TestRDMAHandle, test_rdma_handle_basic_5) {
   test_rdma_handle_5<TypeParam>();
 }
 
+TYPED_TEST_P(TestRDMAHandle, test_rdma_handle_basic_6) {
+  test_rdma_handle_6<TypeParam>();
+}
+
+TYPED_TEST_P(TestRDMAHandle, test_rdma_handle_basic_7) {
+  test_rdma_handle_7<TypeParam>();
+}
+
 REGISTER_TYPED_TEST_SUITE_P(
   TestRDMAHandle,
   test_rdma_handle_basic_1,
   test_rdma_handle_basic_2,
   test_rdma_handle_basic_3,
   test_rdma_handle_basic_4,
-  test_rdma_handle_basic_5
+  test_rdma_handle_basic_5,
+  test_rdma_handle_basic_6,
+  test_rdma_handle_basic_7
 );
 
 INSTANTIATE_TYPED_TEST_SUITE_P(
@@ -81,13 +81,23 @@ TYPED_TEST_P(TestRDMAHandle, test_rdma_handle_extended_5) {
   test_rdma_handle_5<TypeParam>();
 }
 
+TYPED_TEST_P(TestRDMAHandle, test_rdma_handle_extended_6) {
+  test_rdma_handle_6<TypeParam>();
+}
+
+TYPED_TEST_P(TestRDMAHandle, test_rdma_handle_extended_7) {
+  test_rdma_handle_7<TypeParam>();
+}
+
 REGISTER_TYPED_TEST_SUITE_P(
   TestRDMAHandle,
   test_rdma_handle_extended_1,
   test_rdma_handle_extended_2,
   test_rdma_handle_extended_3,
   test_rdma_handle_extended_4,
-  test_rdma_handle_extended_5
+  test_rdma_handle_extended_5,
+  test_rdma_handle_extended_6,
+  test_rdma_handle_extended_7
 );
 
 INSTANTIATE_TYPED_TEST_SUITE_P(
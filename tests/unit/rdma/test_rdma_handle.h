@@ -282,6 +282,143 @@ void test_rdma_handle_5() {
   proxy.destroyHandleRDMA(handle);
 }
 
+template<typename TypeParam>
+void test_rdma_handle_6() {
+  std::size_t size = 10;
+
+  using T = TypeParam;
+  auto proxy = TestObjGroup::construct();
+  vt::HandleRDMA<T> handle = proxy.get()->makeHandle<T>(size, true);
+
+  vt::theSched()->runSchedulerWhile([handle]{ return not handle.ready(); });
+
+  auto rank = vt::theContext()->getNode();
+  int space = 100;
+  UpdateData<T>::init(handle, space, size, rank);
+
+  // Barrier to order following locks
+  vt::theCollective()->barrier();
+
+  auto num = vt::theContext()->getNumNodes();
+  auto next = rank + 1 < num ? rank + 1 : 0;
+
+  {
+    std::vector<std::unique_ptr<T[]>> ptrs;
+    auto batch = handle.makeBatch();
+    for (vt::NodeType node = 0; node < num; node++) {
+      ptrs.emplace_back(std::make_unique<T[]>(size));
+      for (std::size_t i = 0; i < size; i++) {
+        batch.get(node, &ptrs[node][i], 1, i);
+      }
+    }
+
+    // Waiting on one future completes only its target
+    auto ptr = std::make_unique<T[]>(1);
+    auto req = batch.rget(next, ptr.get(), 1, size-1);
+    req.wait();
+    UpdateData<T>::test(std::move(ptr), space, 1, next, size-1);
+    EXPECT_EQ(batch.getNumFlushes(), 1u);
+
+    batch.end();
+    EXPECT_FALSE(batch.isOpen());
+    EXPECT_EQ(batch.getNumOps(), num * size + 1);
+    EXPECT_EQ(batch.getNumFlushes(), static_cast<std::size_t>(num));
+
+    for (vt::NodeType node = 0; node < num; node++) {
+      UpdateData<T>::test(std::move(ptrs[node]), space, size, node, 0);
+    }
+  }
+
+  // Barrier to allow gets to finish
+  vt::theCollective()->barrier();
+
+  {
+    auto ptr = std::make_unique<T[]>(size);
+    UpdateData<T>::setMem(ptr.get(), space, size, rank, size/2);
+    auto batch = handle.makeBatch();
+    for (std::size_t i = size/2; i < size; i++) {
+      batch.put(next, &ptr[i], 1, i);
+    }
+    batch.end();
+  }
+
+  // Barrier to allow puts to finish
+  vt::theCollective()->barrier();
+
+  {
+    auto ptr = std::make_unique<T[]>(size);
+    auto ptr2 = std::make_unique<T[]>(size);
+    handle.get(next, ptr.get(), size, 0, vt::Lock::Shared);
+    for (std::size_t i  = 0; i < size; i++) {
+      ptr2[i] = ptr[i];
+    }
+    UpdateData<T>::test(std::move(ptr), space, size/2, next, 0);
+    UpdateData<T>::test(std::move(ptr2), space, size/2, rank, size/2);
+  }
+
+  vt::theCollective()->barrier();
+  proxy.destroyHandleRDMA(handle);
+}
+
+template<typename TypeParam>
+void test_rdma_handle_7() {
+  std::size_t size = 10;
+
+  using T = TypeParam;
+  auto proxy = TestObjGroup::construct();
+  vt::HandleRDMA<T> handle = proxy.get()->makeHandle<T>(size, true);
+
+  vt::theSched()->runSchedulerWhile([handle]{ return not handle.ready(); });
+
+  auto rank = vt::theContext()->getNode();
+  int space = 100;
+  UpdateData<T>::init(handle, space, size, rank);
+
+  // Pages smaller than the window, so reads span several pages
+  handle.enableReadCache(4);
+
+  // Barrier to order following locks
+  vt::theCollective()->barrier();
+
+  auto num = vt::theContext()->getNumNodes();
+  auto next = rank + 1 < num ? rank + 1 : 0;
+
+  // Read twice: the second pass is served from the cache
+  for (int pass = 0; pass < 2; pass++) {
+    auto ptr = std::make_unique<T[]>(size);
+    for (std::size_t i = 0; i < size; i++) {
+      handle.get(next, &ptr[i], 1, i, vt::Lock::Shared);
+    }
+    UpdateData<T>::test(std::move(ptr), space, size, next, 0);
+  }
+
+  // Barrier to allow gets to finish
+  vt::theCollective()->barrier();
+
+  // Writing to a target drops its cached pages
+  int new_space = 200;
+  {
+    auto ptr = std::make_unique<T[]>(size);
+    UpdateData<T>::setMem(ptr.get(), new_space, size, next, 0);
+    handle.put(next, ptr.get(), size, 0, vt::Lock::Exclusive);
+  }
+
+  // Barrier to allow puts to finish
+  vt::theCollective()->barrier();
+
+  {
+    auto ptr = std::make_unique<T[]>(size/2);
+    handle.get(next, ptr.get(), size/2, size/2, vt::Lock::Shared);
+    for (std::size_t i = 0; i < size/2; i++) {
+      EXPECT_EQ(ptr[i], static_cast<T>(new_space * next + size/2 + i));
+    }
+  }
+
+  vt::theCollective()->barrier();
+  handle.disableReadCache();
+  proxy.destroyHandleRDMA(handle);
+}
+
 }}} /* end namespace vt::tests::unit */
 
 #endif /*INCLUDED_UNIT_RDMA_TEST_RDMA_HANDLE_H*/
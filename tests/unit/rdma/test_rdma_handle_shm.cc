@@ -0,0 +1,136 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                           test_rdma_handle_shm.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <gtest/gtest.h>
+
+#include "test_rdma_common.h"
+#include "test_rdma_handle.h"
+
+namespace vt { namespace tests { namespace unit {
+
+#if vt_check_enabled(rdma_tests)
+
+struct TestRDMAHandleShm : TestParallelHarness {
+  void addAdditionalArgs() override {
+    static char vt_rdma_shm[]{"--vt_rdma_shm"};
+    addArgs(vt_rdma_shm);
+  }
+};
+
+TEST_F(TestRDMAHandleShm, test_rdma_handle_shm_get_put_accum) {
+  using T = int;
+  std::size_t size = 10;
+
+  EXPECT_NE(vt::theHandleRDMA()->getShmNode(), nullptr);
+
+  auto proxy = TestObjGroup::construct();
+  vt::HandleRDMA<T> handle = proxy.get()->makeHandle<T>(size, true);
+
+  vt::theSched()->runSchedulerWhile([handle]{ return not handle.ready(); });
+
+  auto rank = vt::theContext()->getNode();
+  int space = 100;
+  UpdateData<T>::init(handle, space, size, rank);
+
+  // Barrier to order following locks
+  vt::theCollective()->barrier();
+
+  auto num = vt::theContext()->getNumNodes();
+  auto next = rank + 1 < num ? rank + 1 : 0;
+
+  // Reads of every rank, whether it shares this node or not
+  for (vt::NodeType node = 0; node < num; node++) {
+    auto ptr = std::make_unique<T[]>(size);
+    handle.get(node, ptr.get(), size, 0, vt::Lock::Shared);
+    UpdateData<T>::test(std::move(ptr), space, size, node, 0);
+  }
+
+  // Barrier to allow gets to finish
+  vt::theCollective()->barrier();
+
+  {
+    auto ptr = std::make_unique<T[]>(size/2);
+    UpdateData<T>::setMem(ptr.get(), space, size/2, rank, 0);
+    handle.put(next, ptr.get(), size/2, 0, vt::Lock::Exclusive);
+  }
+
+  // Barrier to allow puts to finish
+  vt::theCollective()->barrier();
+
+  {
+    auto ptr = std::make_unique<T[]>(size);
+    handle.get(next, ptr.get(), size, 0, vt::Lock::Shared);
+    for (std::size_t i = 0; i < size/2; i++) {
+      EXPECT_EQ(ptr[i], static_cast<T>(space * rank + i));
+    }
+    for (std::size_t i = size/2; i < size; i++) {
+      EXPECT_EQ(ptr[i], static_cast<T>(space * next + i));
+    }
+  }
+
+  vt::theCollective()->barrier();
+
+  // Every rank adds to the last slot of rank 0: direct under an exclusive
+  // lock for ranks on its node, MPI otherwise
+  {
+    T one = 1;
+    handle.accum(0, &one, 1, size - 1, MPI_SUM, vt::Lock::Exclusive);
+    handle.fetchOp(0, 1, size - 2, MPI_SUM, vt::Lock::Exclusive);
+  }
+
+  vt::theCollective()->barrier();
+
+  if (rank == 0) {
+    auto ptr = std::make_unique<T[]>(size);
+    handle.get(0, ptr.get(), size, 0, vt::Lock::Shared);
+    EXPECT_EQ(ptr[size - 1], static_cast<T>(size - 1 + num));
+    EXPECT_EQ(ptr[size - 2], static_cast<T>(size - 2 + num));
+  }
+
+  vt::theCollective()->barrier();
+  proxy.destroyHandleRDMA(handle);
+}
+
+#endif /*vt_check_enabled(rdma_tests)*/
+
+}}} /* end namespace vt::tests::unit */
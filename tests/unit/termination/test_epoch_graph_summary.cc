@@ -0,0 +1,96 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                         test_epoch_graph_summary.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <gtest/gtest.h>
+
+#include "test_parallel_harness.h"
+
+#include "vt/termination/termination.h"
+
+namespace vt { namespace tests { namespace unit {
+
+using TestEpochGraphSummaryLive = TestParallelHarness;
+
+TEST_F(TestEpochGraphSummaryLive, test_epoch_graph_summary_counts_once) {
+  auto const this_node = theContext()->getNode();
+
+  int const num_collective = 5;
+  std::vector<EpochType> epochs;
+  for (int i = 0; i < num_collective; i++) {
+    epochs.push_back(theTerm()->makeEpochCollective("summary-coll"));
+  }
+  auto const parent = epochs.back();
+  auto const ds = theTerm()->makeEpochRootedDS(
+    term::ParentEpochCapture{parent}, "summary-ds"
+  );
+
+  auto summary = theTerm()->makeGraphSummary(0);
+  auto const& classes = summary.getClasses();
+  auto const& links = summary.getLinks();
+
+  // Collective epochs are live everywhere but only counted on node 0; the DS
+  // epoch is counted on the node that created it
+  if (this_node == 0) {
+    EXPECT_EQ(classes.at("summary-coll (C)"), num_collective);
+  } else {
+    EXPECT_EQ(classes.find("summary-coll (C)"), classes.end());
+  }
+  EXPECT_EQ(classes.at("summary-ds (DS)"), 1);
+  EXPECT_EQ(
+    links.at(std::make_pair("summary-coll (C)", "summary-ds (DS)")), 1
+  );
+
+  // This node's DS epoch and, on node 0, the global and collective epochs
+  auto const expected = 1 + (this_node == 0 ? 1 + num_collective : 0);
+  EXPECT_EQ(summary.getNumEpochs(), expected);
+
+  theTerm()->finishedEpoch(ds);
+  for (auto&& ep : epochs) {
+    theTerm()->finishedEpoch(ep);
+  }
+  for (auto&& ep : epochs) {
+    vt::runSchedulerThrough(ep);
+  }
+}
+
+}}} // end namespace vt::tests::unit
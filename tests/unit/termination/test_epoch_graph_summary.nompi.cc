@@ -0,0 +1,122 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                      test_epoch_graph_summary.nompi.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <gtest/gtest.h>
+
+#include "test_harness.h"
+
+#include "vt/termination/graph/epoch_graph_summary.h"
+#include "vt/termination/term_common.h"
+#include "vt/epoch/epoch_manip.h"
+
+namespace vt { namespace tests { namespace unit {
+
+using TestEpochGraphSummary = TestHarness;
+
+using termination::graph::EpochGraphSummary;
+
+static EpochType makeTestEpoch(EpochType::ImplType seq) {
+  auto epoch = epoch::EpochManip::generateEpoch(false);
+  epoch::EpochManip::setSeq(epoch, seq);
+  return epoch;
+}
+
+TEST_F(TestEpochGraphSummary, test_epoch_graph_summary_collapse_by_label) {
+  EpochGraphSummary summary{0};
+  auto const global = EpochGraphSummary::classify(
+    term::any_epoch_sentinel, "Global"
+  );
+  summary.addEpochs(global);
+
+  // Many epochs with a handful of labels, each with a labeled child
+  int const num_epochs = 1000;
+  EpochType::ImplType seq = 1;
+  for (int i = 0; i < num_epochs; i++) {
+    auto const parent = EpochGraphSummary::classify(
+      makeTestEpoch(seq++), i % 2 == 0 ? "even" : "odd"
+    );
+    auto const child = EpochGraphSummary::classify(
+      makeTestEpoch(seq++), "child"
+    );
+    summary.addEpochs(parent);
+    summary.addEpochs(child);
+    summary.addLinks(global, parent);
+    summary.addLinks(parent, child);
+  }
+
+  auto const& classes = summary.getClasses();
+  EXPECT_EQ(classes.size(), std::size_t{4});
+  EXPECT_EQ(summary.getNumEpochs(), 2 * num_epochs + 1);
+  EXPECT_EQ(classes.at("Global"), 1);
+  EXPECT_EQ(classes.at("even (C)"), num_epochs / 2);
+  EXPECT_EQ(classes.at("odd (C)"), num_epochs / 2);
+  EXPECT_EQ(classes.at("child (C)"), num_epochs);
+
+  auto const& links = summary.getLinks();
+  EXPECT_EQ(links.size(), std::size_t{4});
+  EXPECT_EQ(links.at(std::make_pair("Global", "even (C)")), num_epochs / 2);
+  EXPECT_EQ(links.at(std::make_pair("odd (C)", "child (C)")), num_epochs / 2);
+}
+
+TEST_F(TestEpochGraphSummary, test_epoch_graph_summary_bounded_merge) {
+  std::size_t const max_classes = 8;
+
+  EpochGraphSummary a{max_classes};
+  EpochGraphSummary b{max_classes};
+  for (int i = 0; i < 20; i++) {
+    a.addEpochs(fmt::format("a{}", i));
+    b.addEpochs(fmt::format("b{}", i), 2);
+    b.addLinks("b0", fmt::format("b{}", i));
+  }
+
+  // Everything past the bound is folded into a single overflow class
+  EXPECT_EQ(a.getClasses().size(), max_classes + 1);
+  EXPECT_EQ(a.getNumEpochs(), 20);
+
+  auto merged = a + b;
+  EXPECT_EQ(merged.getClasses().size(), max_classes + 1);
+  EXPECT_EQ(merged.getNumEpochs(), 20 + 40);
+  EXPECT_LE(merged.getLinks().size(), (max_classes + 1) * (max_classes + 1));
+}
+
+}}} // end namespace vt::tests::unit
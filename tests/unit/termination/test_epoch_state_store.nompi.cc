@@ -0,0 +1,176 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                       test_epoch_state_store.nompi.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <gtest/gtest.h>
+
+#include "test_harness.h"
+
+#include "vt/termination/epoch_state_store.h"
+#include "vt/epoch/epoch_manip.h"
+
+#include <map>
+
+namespace vt { namespace tests { namespace unit {
+
+using TestEpochStateStore = TestHarness;
+
+static EpochType makeTestEpoch(bool is_rooted, EpochType::ImplType seq) {
+  auto epoch = epoch::EpochManip::generateEpoch(
+    is_rooted, is_rooted ? NodeType{3} : uninitialized_destination
+  );
+  epoch::EpochManip::setSeq(epoch, seq);
+  return epoch;
+}
+
+TEST_F(TestEpochStateStore, test_epoch_state_store_insert_erase) {
+  term::EpochStateStore<int> store;
+  std::map<EpochType::ImplType, int> expected;
+
+  for (EpochType::ImplType seq = 1; seq < 200; seq++) {
+    for (bool is_rooted : {false, true}) {
+      auto const ep = makeTestEpoch(is_rooted, seq);
+      store.emplace(ep, static_cast<int>(seq));
+      expected[*ep] = static_cast<int>(seq);
+    }
+  }
+
+  EXPECT_EQ(store.size(), expected.size());
+
+  // Erase out of order: every third epoch first, then the remainder
+  for (EpochType::ImplType seq = 1; seq < 200; seq += 3) {
+    for (bool is_rooted : {false, true}) {
+      auto const ep = makeTestEpoch(is_rooted, seq);
+      ASSERT_NE(store.find(ep), nullptr);
+      EXPECT_EQ(*store.find(ep), static_cast<int>(seq));
+      store.erase(ep);
+      EXPECT_FALSE(store.contains(ep));
+      expected.erase(*ep);
+    }
+  }
+
+  EXPECT_EQ(store.size(), expected.size());
+
+  std::size_t visited = 0;
+  store.forEach([&](EpochType ep, int& val) {
+    auto iter = expected.find(*ep);
+    ASSERT_NE(iter, expected.end());
+    EXPECT_EQ(iter->second, val);
+    visited++;
+  });
+  EXPECT_EQ(visited, expected.size());
+
+  for (auto&& elm : expected) {
+    store.erase(EpochType{elm.first});
+  }
+  EXPECT_EQ(store.size(), 0U);
+  EXPECT_TRUE(store.empty());
+}
+
+TEST_F(TestEpochStateStore, test_epoch_state_store_out_of_window) {
+  using StoreType = term::EpochStateStore<int>;
+  StoreType store;
+
+  auto const first = makeTestEpoch(false, 10);
+  auto const far = makeTestEpoch(false, 10 + StoreType::max_window_span * 2);
+  auto const before = makeTestEpoch(false, 5);
+
+  store.emplace(first, 1);
+  store.emplace(far, 2);
+  store.emplace(before, 3);
+
+  // Emplacing an existing epoch returns the existing value
+  EXPECT_EQ(store.emplace(first, 100), 1);
+
+  EXPECT_EQ(store.size(), 3U);
+  EXPECT_EQ(*store.find(first), 1);
+  EXPECT_EQ(*store.find(far), 2);
+  EXPECT_EQ(*store.find(before), 3);
+
+  store.erase(first);
+  store.erase(far);
+  store.erase(before);
+  EXPECT_EQ(store.size(), 0U);
+  EXPECT_EQ(store.find(far), nullptr);
+}
+
+TEST_F(TestEpochStateStore, test_epoch_state_store_for_each_insert) {
+  using StoreType = term::EpochStateStore<int>;
+  StoreType store;
+
+  std::map<EpochType::ImplType, int> visits;
+  for (EpochType::ImplType seq = 100; seq < 110; seq++) {
+    auto const ep = makeTestEpoch(false, seq);
+    store.emplace(ep, static_cast<int>(seq));
+    visits[*ep] = 0;
+  }
+  auto const far = makeTestEpoch(false, 100 + StoreType::max_window_span * 2);
+  store.emplace(far, 1);
+  visits[*far] = 0;
+
+  // Grow the slab at the front (shifting every slot) and fill the overflow
+  // from inside the traversal
+  bool inserted = false;
+  store.forEach([&](EpochType ep, int&) {
+    if (not inserted) {
+      inserted = true;
+      for (EpochType::ImplType seq = 50; seq < 100; seq++) {
+        store.emplace(makeTestEpoch(false, seq), 0);
+      }
+      for (EpochType::ImplType i = 1; i < 64; i++) {
+        store.emplace(
+          makeTestEpoch(false, 100 + StoreType::max_window_span * (2 + i)), 0
+        );
+      }
+    }
+    auto iter = visits.find(*ep);
+    if (iter != visits.end()) {
+      iter->second++;
+    }
+  });
+
+  for (auto&& elm : visits) {
+    EXPECT_EQ(elm.second, 1) << "epoch " << elm.first;
+  }
+}
+
+}}} // end namespace vt::tests::unit
@@ -0,0 +1,129 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                            test_term_adaptive.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <gtest/gtest.h>
+
+#include "test_parallel_harness.h"
+#include "data_message.h"
+#include "test_helpers.h"
+
+#include "vt/phase/phase_manager.h"
+
+#include <vector>
+
+namespace vt { namespace tests { namespace unit {
+
+using namespace vt;
+using namespace vt::tests::unit;
+
+static int num_recv = 0;
+
+struct TestTermAdaptive : TestParallelHarness {
+  using TestMsgType = TestStaticBytesNormalMsg<64>;
+
+  virtual void SetUp() override {
+    TestParallelHarness::SetUp();
+    theConfig()->vt_term_adaptive = true;
+    num_recv = 0;
+  }
+
+  virtual void TearDown() override {
+    theConfig()->vt_term_adaptive = false;
+    theConfig()->vt_term_batch_waves = false;
+    TestParallelHarness::TearDown();
+  }
+
+  static void handler([[maybe_unused]] TestMsgType* msg) {
+    num_recv++;
+
+    // Keep the scheduler busy so waves are held back
+    if (num_recv % 8 != 0) {
+      auto const this_node = theContext()->getNode();
+      auto const num_nodes = theContext()->getNumNodes();
+      NodeType const next = this_node + 1 < num_nodes ? this_node + 1 : 0;
+      theMsg()->sendMsg<handler>(next, makeMessage<TestMsgType>());
+    }
+  }
+
+  static void runEpochs(int num_epochs) {
+    auto const this_node = theContext()->getNode();
+    auto const num_nodes = theContext()->getNumNodes();
+    NodeType const next = this_node + 1 < num_nodes ? this_node + 1 : 0;
+
+    std::vector<EpochType> epochs;
+    for (int i = 0; i < num_epochs; i++) {
+      epochs.push_back(theTerm()->makeEpochCollective());
+    }
+
+    for (auto&& epoch : epochs) {
+      theMsg()->pushEpoch(epoch);
+      for (int j = 0; j < 4; j++) {
+        theMsg()->sendMsg<handler>(next, makeMessage<TestMsgType>());
+      }
+      theMsg()->popEpoch(epoch);
+      theTerm()->finishedEpoch(epoch);
+    }
+
+    for (auto&& epoch : epochs) {
+      vt::runSchedulerThrough(epoch);
+    }
+  }
+};
+
+TEST_F(TestTermAdaptive, test_term_adaptive_busy_epochs) {
+  runEpochs(16);
+  EXPECT_GT(num_recv, 0);
+}
+
+TEST_F(TestTermAdaptive, test_term_adaptive_batched_across_phases) {
+  theConfig()->vt_term_batch_waves = true;
+
+  for (int phase = 0; phase < 3; phase++) {
+    runEpochs(8);
+    thePhase()->nextPhaseCollective();
+  }
+
+  EXPECT_GT(num_recv, 0);
+}
+
+}}} // end namespace vt::tests::unit
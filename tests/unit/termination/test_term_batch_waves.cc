@@ -0,0 +1,149 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                           test_term_batch_waves.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <gtest/gtest.h>
+
+#include "test_parallel_harness.h"
+#include "data_message.h"
+#include "test_helpers.h"
+
+#include <vector>
+
+namespace vt { namespace tests { namespace unit {
+
+using namespace vt;
+using namespace vt::tests::unit;
+
+static int num_recv = 0;
+
+struct TestTermBatchWaves : TestParallelHarness {
+  using TestMsgType = TestStaticBytesNormalMsg<64>;
+
+  virtual void SetUp() override {
+    TestParallelHarness::SetUp();
+    theConfig()->vt_term_batch_waves = true;
+    num_recv = 0;
+  }
+
+  virtual void TearDown() override {
+    theConfig()->vt_term_batch_waves = false;
+    TestParallelHarness::TearDown();
+  }
+
+  static void handler([[maybe_unused]] TestMsgType* msg) {
+    num_recv++;
+  }
+};
+
+TEST_F(TestTermBatchWaves, test_term_batch_waves_overlapping_collective) {
+  auto const this_node = theContext()->getNode();
+  auto const num_nodes = theContext()->getNumNodes();
+  NodeType const next = this_node + 1 < num_nodes ? this_node + 1 : 0;
+
+  int const num_epochs = 64;
+  int const num_msgs = 4;
+
+  // Keep all epochs active at once so their waves overlap
+  std::vector<EpochType> epochs;
+  for (int i = 0; i < num_epochs; i++) {
+    epochs.push_back(theTerm()->makeEpochCollective());
+  }
+
+  for (auto&& epoch : epochs) {
+    for (int j = 0; j < num_msgs; j++) {
+      auto msg = makeMessage<TestMsgType>();
+      envelopeSetEpoch(msg->env, epoch);
+      theMsg()->sendMsg<handler>(next, msg);
+    }
+  }
+
+  for (auto&& epoch : epochs) {
+    theTerm()->finishedEpoch(epoch);
+  }
+
+  for (auto&& epoch : epochs) {
+    vt::runSchedulerThrough(epoch);
+  }
+
+  EXPECT_EQ(num_recv, num_epochs * num_msgs);
+}
+
+TEST_F(TestTermBatchWaves, test_term_batch_waves_rooted_and_collective) {
+  SET_MIN_NUM_NODES_CONSTRAINT(2);
+
+  auto const this_node = theContext()->getNode();
+  auto const num_nodes = theContext()->getNumNodes();
+  NodeType const next = this_node + 1 < num_nodes ? this_node + 1 : 0;
+
+  int const num_epochs = 32;
+
+  std::vector<EpochType> epochs;
+  for (int i = 0; i < num_epochs; i++) {
+    epochs.push_back(theTerm()->makeEpochCollective());
+    epochs.push_back(
+      theTerm()->makeEpochRootedWave(term::ParentEpochCapture{no_epoch})
+    );
+  }
+
+  for (auto&& epoch : epochs) {
+    auto msg = makeMessage<TestMsgType>();
+    envelopeSetEpoch(msg->env, epoch);
+    theMsg()->sendMsg<handler>(next, msg);
+    theTerm()->finishedEpoch(epoch);
+  }
+
+  for (auto&& epoch : epochs) {
+    vt::runSchedulerThrough(epoch);
+  }
+
+  EXPECT_EQ(num_recv, static_cast<int>(epochs.size()));
+
+  vt::theSched()->runSchedulerWhile(
+    []{ return not vt::rt->isTerminated() or not vt::theSched()->isIdle();
+  });
+
+  EXPECT_LT(theTerm()->getEpochState().size(), std::size_t{2});
+  EXPECT_EQ(theTerm()->getEpochWaitSet().size(), std::size_t{0});
+}
+
+}}} // end namespace vt::tests::unit